@@ -0,0 +1,112 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BackgroundWriter.cpp
+ */
+
+#include "BackgroundWriter.hpp"
+
+#include "common/Logger.hpp"
+#include "common/TimingMacros.hpp"
+
+namespace geosx
+{
+
+BackgroundWriter & BackgroundWriter::get()
+{
+  static BackgroundWriter writer;
+  return writer;
+}
+
+BackgroundWriter::BackgroundWriter():
+  m_thread(),
+  m_mutex(),
+  m_writeQueued(),
+  m_writeCompleted(),
+  m_writes(),
+  m_numInFlight( 0 ),
+  m_stop( false )
+{}
+
+BackgroundWriter::~BackgroundWriter()
+{
+  {
+    std::lock_guard< std::mutex > lock( m_mutex );
+    m_stop = true;
+  }
+  m_writeQueued.notify_one();
+
+  if( m_thread.joinable() )
+  {
+    m_thread.join();
+  }
+}
+
+void BackgroundWriter::push( std::function< void() > write, integer const maxInFlight )
+{
+  GEOSX_MARK_FUNCTION;
+  GEOSX_ERROR_IF_LE( maxInFlight, 0 );
+
+  std::unique_lock< std::mutex > lock( m_mutex );
+  if( !m_thread.joinable() )
+  {
+    m_thread = std::thread( &BackgroundWriter::run, this );
+  }
+
+  m_writeCompleted.wait( lock, [&] { return m_numInFlight < maxInFlight; } );
+  m_writes.push_back( std::move( write ) );
+  ++m_numInFlight;
+  lock.unlock();
+
+  m_writeQueued.notify_one();
+}
+
+void BackgroundWriter::wait()
+{
+  GEOSX_MARK_FUNCTION;
+  std::unique_lock< std::mutex > lock( m_mutex );
+  m_writeCompleted.wait( lock, [&] { return m_numInFlight == 0; } );
+}
+
+integer BackgroundWriter::numInFlight()
+{
+  std::lock_guard< std::mutex > lock( m_mutex );
+  return m_numInFlight;
+}
+
+void BackgroundWriter::run()
+{
+  std::unique_lock< std::mutex > lock( m_mutex );
+  while( true )
+  {
+    m_writeQueued.wait( lock, [&] { return m_stop || !m_writes.empty(); } );
+    if( m_writes.empty() )
+    {
+      return;
+    }
+
+    std::function< void() > const write = std::move( m_writes.front() );
+    m_writes.pop_front();
+
+    lock.unlock();
+    write();
+    lock.lock();
+
+    --m_numInFlight;
+    m_writeCompleted.notify_all();
+  }
+}
+
+} /* namespace geosx */
@@ -0,0 +1,111 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BackgroundWriter.hpp
+ */
+
+#ifndef GEOSX_COMMON_BACKGROUNDWRITER_HPP_
+#define GEOSX_COMMON_BACKGROUNDWRITER_HPP_
+
+#include "common/DataTypes.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace geosx
+{
+
+/**
+ * @class BackgroundWriter
+ *
+ * A dedicated I/O thread writing output snapshots while the simulation continues.
+ *
+ * The writes are executed one at a time, in the order in which they were pushed, so that
+ * the libraries used to write the files (HDF5 in particular) are only called from one thread
+ * at a time. A write must only use data that it owns (a snapshot of the fields to write) and
+ * must not communicate. Code calling a file library from the main thread must call wait() first.
+ */
+class BackgroundWriter
+{
+public:
+
+  /**
+   * @brief Get the process-wide background writer.
+   * @return the background writer
+   */
+  static BackgroundWriter & get();
+
+  /// Destructor, completes the pending writes.
+  ~BackgroundWriter();
+
+  BackgroundWriter( BackgroundWriter const & ) = delete;
+  BackgroundWriter( BackgroundWriter && ) = delete;
+  BackgroundWriter & operator=( BackgroundWriter const & ) = delete;
+  BackgroundWriter & operator=( BackgroundWriter && ) = delete;
+
+  /**
+   * @brief Queue a write, blocking while too many writes are in flight.
+   * @param write the write, owning the data it writes
+   * @param maxInFlight the maximum number of writes queued or being executed,
+   *                    including this one, when this function returns
+   */
+  void push( std::function< void() > write, integer const maxInFlight );
+
+  /**
+   * @brief Block until all the queued writes are completed.
+   */
+  void wait();
+
+  /**
+   * @brief Get the number of writes queued or being executed.
+   * @return the number of writes in flight
+   */
+  integer numInFlight();
+
+private:
+
+  BackgroundWriter();
+
+  /// The loop executed by the I/O thread.
+  void run();
+
+  /// The I/O thread, started with the first write.
+  std::thread m_thread;
+
+  /// The mutex protecting the queue.
+  std::mutex m_mutex;
+
+  /// Notified when a write is queued or the writer is stopped.
+  std::condition_variable m_writeQueued;
+
+  /// Notified when a write is completed.
+  std::condition_variable m_writeCompleted;
+
+  /// The writes not yet started.
+  std::deque< std::function< void() > > m_writes;
+
+  /// The number of writes queued or being executed.
+  integer m_numInFlight;
+
+  /// Whether the I/O thread must exit once the queue is empty.
+  bool m_stop;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_COMMON_BACKGROUNDWRITER_HPP_ */
@@ -0,0 +1,75 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/BackgroundWriter.hpp"
+
+#include <atomic>
+#include <chrono>
+
+using namespace geosx;
+
+TEST( BackgroundWriter, WritesInOrder )
+{
+  BackgroundWriter & writer = BackgroundWriter::get();
+
+  std::vector< int > written;
+  for( int i = 0; i < 100; ++i )
+  {
+    writer.push( [i, &written]() { written.push_back( i ); }, 4 );
+    EXPECT_LE( writer.numInFlight(), 4 );
+  }
+
+  writer.wait();
+  EXPECT_EQ( writer.numInFlight(), 0 );
+
+  ASSERT_EQ( written.size(), 100 );
+  for( int i = 0; i < 100; ++i )
+  {
+    EXPECT_EQ( written[i], i );
+  }
+}
+
+TEST( BackgroundWriter, BoundsWritesInFlight )
+{
+  BackgroundWriter & writer = BackgroundWriter::get();
+
+  std::atomic< bool > release( false );
+  std::atomic< int > numWritten( 0 );
+  auto const slowWrite = [&]()
+  {
+    while( !release )
+    {
+      std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+    ++numWritten;
+  };
+
+  writer.push( slowWrite, 2 );
+  writer.push( slowWrite, 2 );
+  EXPECT_EQ( writer.numInFlight(), 2 );
+
+  // The third write must wait for the first one to complete.
+  std::thread pusher( [&]() { writer.push( slowWrite, 2 ); } );
+  std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+  EXPECT_EQ( writer.numInFlight(), 2 );
+  EXPECT_EQ( numWritten, 0 );
+
+  release = true;
+  pusher.join();
+  writer.wait();
+  EXPECT_EQ( numWritten, 3 );
+  EXPECT_EQ( writer.numInFlight(), 0 );
+}
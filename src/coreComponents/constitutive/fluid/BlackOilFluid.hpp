@@ -63,7 +63,7 @@ protected:
 
 private:
 
-  void createFluid() override;
+  std::unique_ptr< PVTPackage::MultiphaseSystem > createFluid() const override;
 
   // Black-oil phase/component description
   array1d< real64 > m_surfaceDensities;
@@ -92,7 +92,7 @@ CompositionalMultiphaseFluid::deliverClone( string const & name,
   std::unique_ptr< ConstitutiveBase > clone = MultiFluidPVTPackageWrapper::deliverClone( name, parent );
   CompositionalMultiphaseFluid & fluid = dynamicCast< CompositionalMultiphaseFluid & >( *clone );
 
-  fluid.createFluid();
+  fluid.createFluids();
   return clone;
 }
 
@@ -135,7 +135,7 @@ void CompositionalMultiphaseFluid::PostProcessInput()
 #undef COMPFLUID_CHECK_INPUT_LENGTH
 }
 
-void CompositionalMultiphaseFluid::createFluid()
+std::unique_ptr< PVTPackage::MultiphaseSystem > CompositionalMultiphaseFluid::createFluid() const
 {
   localIndex const NC = numFluidComponents();
   localIndex const NP = numFluidPhases();
@@ -153,11 +153,10 @@ void CompositionalMultiphaseFluid::createFluid()
 
   ComponentProperties const compProps( NC, components, Mw, Tc, Pc, Omega );
 
-  m_fluid = std::make_unique< PVTPackage::CompositionalMultiphaseSystem >( phases,
-                                                                           eos,
-                                                                           PVTPackage::COMPOSITIONAL_FLASH_TYPE::NEGATIVE_OIL_GAS,
-                                                                           compProps );
-
+  return std::make_unique< PVTPackage::CompositionalMultiphaseSystem >( phases,
+                                                                        eos,
+                                                                        PVTPackage::COMPOSITIONAL_FLASH_TYPE::NEGATIVE_OIL_GAS,
+                                                                        compProps );
 }
 
 REGISTER_CATALOG_ENTRY( ConstitutiveBase, CompositionalMultiphaseFluid, std::string const &, Group * const )
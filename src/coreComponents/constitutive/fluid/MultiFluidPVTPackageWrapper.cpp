@@ -35,7 +35,7 @@ namespace constitutive
 
 MultiFluidPVTPackageWrapper::MultiFluidPVTPackageWrapper( std::string const & name, Group * const parent )
   : MultiFluidBase( name, parent ),
-  m_fluid( nullptr )
+  m_fluids()
 {}
 
 MultiFluidPVTPackageWrapper::~MultiFluidPVTPackageWrapper()
@@ -71,7 +71,16 @@ void MultiFluidPVTPackageWrapper::PostProcessInput()
 void MultiFluidPVTPackageWrapper::InitializePostSubGroups( Group * const group )
 {
   MultiFluidBase::InitializePostSubGroups( group );
-  createFluid();
+  createFluids();
+}
+
+void MultiFluidPVTPackageWrapper::createFluids()
+{
+  m_fluids.clear();
+  for( int thread = 0; thread < getMaxHostThreads(); ++thread )
+  {
+    m_fluids.emplace_back( createFluid() );
+  }
 }
 
 std::unique_ptr< ConstitutiveBase >
@@ -86,6 +95,14 @@ MultiFluidPVTPackageWrapper::deliverClone( string const & name,
   return clone;
 }
 
+PVTPackage::MultiphaseSystem & MultiFluidPVTPackageWrapperUpdate::threadFluid() const
+{
+  int const thread = getHostThreadIndex();
+  GEOSX_ERROR_IF_GE_MSG( thread, LvArray::integerConversion< int >( m_fluids.size() ),
+                         "More threads than PVTPackage fluid copies, the OpenMP thread count grew after the fluid was created" );
+  return *m_fluids[thread];
+}
+
 void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
                                                  real64 temperature,
                                                  arraySlice1d< real64 const, 0 > const & composition,
@@ -125,17 +142,18 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
   }
 
   // 2. Trigger PVTPackage compute and get back phase split
-  m_fluid.Update( pressure, temperature, compMoleFrac );
+  PVTPackage::MultiphaseSystem & fluid = threadFluid();
+  fluid.Update( pressure, temperature, compMoleFrac );
 
-  GEOSX_WARNING_IF( m_fluid.getState() != PVTPackage::MultiphaseSystem::State::SUCCESS,
+  GEOSX_WARNING_IF( fluid.getState() != PVTPackage::MultiphaseSystem::State::SUCCESS,
                     "Phase equilibrium calculations not converged" );
 
-  PVTPackage::MultiphaseSystemProperties const & split = m_fluid.get_MultiphaseSystemProperties();
+  PVTPackage::MultiphaseSystemProperties const & split = fluid.get_MultiphaseSystemProperties();
 
   // 3. Extract phase split and phase properties from PVTPackage
   for( localIndex ip = 0; ip < NP; ++ip )
   {
-    PVTPackage::PhaseProperties const & props = m_fluid.get_PhaseProperties( m_phaseTypes[ip] );
+    PVTPackage::PhaseProperties const & props = fluid.get_PhaseProperties( m_phaseTypes[ip] );
     auto const & frac = split.PhaseMoleFraction.at( m_phaseTypes[ip] );
     auto const & comp = props.MoleComposition;
     auto const & dens = m_useMass ? props.MassDensity : props.MoleDensity;
@@ -158,7 +176,7 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
     // 4.1.1. Compute mass of each phase and total mass (on a 1-mole basis)
     for( localIndex ip = 0; ip < NP; ++ip )
     {
-      PVTPackage::PhaseProperties const & props = m_fluid.get_PhaseProperties( m_phaseTypes[ip] );
+      PVTPackage::PhaseProperties const & props = fluid.get_PhaseProperties( m_phaseTypes[ip] );
       auto const & phaseMW = props.MolecularWeight;
       phaseFrac[ip] *= phaseMW.value;
       totalMass += phaseFrac[ip];
@@ -174,7 +192,7 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
     // 4.2. Convert phase compositions
     for( localIndex ip = 0; ip < NP; ++ip )
     {
-      PVTPackage::PhaseProperties const & props = m_fluid.get_PhaseProperties( m_phaseTypes[ip] );
+      PVTPackage::PhaseProperties const & props = fluid.get_PhaseProperties( m_phaseTypes[ip] );
       real64 const phaseMWInv = 1.0 / props.MolecularWeight.value;
 
       for( localIndex ic = 0; ic < NC; ++ic )
@@ -308,17 +326,22 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
   }
 
   // 2. Trigger PVTPackage compute and get back phase split
-  m_fluid.Update( pressure, temperature, compMoleFrac );
-
-  GEOSX_WARNING_IF( m_fluid.getState() != PVTPackage::MultiphaseSystem::State::SUCCESS,
+  // TODO: the flash starts from scratch for every cell. A warm start from the equilibrium ratios and
+  //       phase presence of the previous Newton iteration, stored per cell, and a way to skip the
+  //       stability test far from the phase boundary, need an entry point that PVTPackage does not provide:
+  //       MultiphaseSystem::Update only takes the pressure, the temperature and the feed composition.
+  PVTPackage::MultiphaseSystem & fluid = threadFluid();
+  fluid.Update( pressure, temperature, compMoleFrac );
+
+  GEOSX_WARNING_IF( fluid.getState() != PVTPackage::MultiphaseSystem::State::SUCCESS,
                     "Phase equilibrium calculations not converged" );
 
-  PVTPackage::MultiphaseSystemProperties const & split = m_fluid.get_MultiphaseSystemProperties();
+  PVTPackage::MultiphaseSystemProperties const & split = fluid.get_MultiphaseSystemProperties();
 
   // 3. Extract phase split, phase properties and derivatives from PVTPackage
   for( localIndex ip = 0; ip < NP; ++ip )
   {
-    PVTPackage::PhaseProperties const & props = m_fluid.get_PhaseProperties( m_phaseTypes[ip] );
+    PVTPackage::PhaseProperties const & props = fluid.get_PhaseProperties( m_phaseTypes[ip] );
 
     auto const & frac = split.PhaseMoleFraction.at( m_phaseTypes[ip] );
     auto const & comp = props.MoleComposition;
@@ -364,7 +387,7 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
     // 4.1.1. Compute mass of each phase and total mass (on a 1-mole basis)
     for( localIndex ip = 0; ip < NP; ++ip )
     {
-      PVTPackage::PhaseProperties const & props = m_fluid.get_PhaseProperties( m_phaseTypes[ip] );
+      PVTPackage::PhaseProperties const & props = fluid.get_PhaseProperties( m_phaseTypes[ip] );
 
       auto const & phaseMW = props.MolecularWeight;
       real64 const nu = phaseFrac.value[ip];
@@ -401,7 +424,7 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
     // 4.2. Convert phase compositions
     for( localIndex ip = 0; ip < NP; ++ip )
     {
-      PVTPackage::PhaseProperties const & props = m_fluid.get_PhaseProperties( m_phaseTypes[ip] );
+      PVTPackage::PhaseProperties const & props = fluid.get_PhaseProperties( m_phaseTypes[ip] );
 
       auto const & phaseMW = props.MolecularWeight;
       real64 const phaseMWInv = 1.0 / phaseMW.value;
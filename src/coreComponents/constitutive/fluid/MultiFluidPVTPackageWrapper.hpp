@@ -22,6 +22,7 @@
 #include "constitutive/fluid/MultiFluidBase.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace PVTPackage
 {
@@ -37,13 +38,14 @@ namespace constitutive
 
 /**
  * @brief Kernel wrapper class for MultiFluidPVTPackage.
- * @note Not thread-safe, do not use with any parallel launch policy.
+ * @note Host-only. PVTPackage systems keep the state of the last flash, so each thread of a
+ *       parallelHostPolicy loop runs the flash on its own copy of the system.
  */
 class MultiFluidPVTPackageWrapperUpdate final : public MultiFluidBaseUpdate
 {
 public:
 
-  MultiFluidPVTPackageWrapperUpdate( PVTPackage::MultiphaseSystem & fluid,
+  MultiFluidPVTPackageWrapperUpdate( std::vector< std::unique_ptr< PVTPackage::MultiphaseSystem > > const & fluids,
                                      arrayView1d< PVTPackage::PHASE_TYPE > const & phaseTypes,
                                      arrayView1d< real64 const > const & componentMolarWeight,
                                      bool useMass,
@@ -89,7 +91,7 @@ public:
                             dTotalDensity_dPressure,
                             dTotalDensity_dTemperature,
                             dTotalDensity_dGlobalCompFraction ),
-    m_fluid( fluid ),
+    m_fluids( fluids ),
     m_phaseTypes( phaseTypes )
   {}
 
@@ -172,7 +174,14 @@ public:
 
 private:
 
-  PVTPackage::MultiphaseSystem & m_fluid;
+  /**
+   * @brief Get the PVTPackage system of the calling thread.
+   * @return the system
+   */
+  PVTPackage::MultiphaseSystem & threadFluid() const;
+
+  /// PVTPackage systems, one per host thread
+  std::vector< std::unique_ptr< PVTPackage::MultiphaseSystem > > const & m_fluids;
 
   arrayView1d< PVTPackage::PHASE_TYPE > m_phaseTypes;
 
@@ -199,7 +208,7 @@ public:
    */
   KernelWrapper createKernelWrapper()
   {
-    return KernelWrapper( *m_fluid,
+    return KernelWrapper( m_fluids,
                           m_phaseTypes,
                           m_componentMolarWeight,
                           m_useMass,
@@ -231,11 +240,17 @@ protected:
 
   virtual void InitializePostSubGroups( Group * const group ) override;
 
-  /// function that populates m_fluid ptr; to be overriden by derived classes
-  virtual void createFluid() = 0;
+  /**
+   * @brief Create a PVTPackage system for the fluid; to be overriden by derived classes.
+   * @return the system
+   */
+  virtual std::unique_ptr< PVTPackage::MultiphaseSystem > createFluid() const = 0;
+
+  /// Populate m_fluids with one PVTPackage system per host thread
+  void createFluids();
 
-  /// PVTPackage fluid object
-  std::unique_ptr< PVTPackage::MultiphaseSystem > m_fluid;
+  /// PVTPackage fluid objects, one per host thread since a system holds the state of its last flash
+  std::vector< std::unique_ptr< PVTPackage::MultiphaseSystem > > m_fluids;
 
   /// PVTPackage phase labels
   array1d< PVTPackage::PHASE_TYPE > m_phaseTypes;
@@ -46,7 +46,7 @@ namespace constitutive
 
 /**
  * @brief Kernel wrapper class for MultiPhaseMultiComponentFluid.
- * @note Not thread-safe, do not use with any parallel launch policy.
+ * @note Thread-safe on the host, not device-capable.
  */
 class MultiPhaseMultiComponentFluidUpdate final : public MultiFluidBaseUpdate
 {
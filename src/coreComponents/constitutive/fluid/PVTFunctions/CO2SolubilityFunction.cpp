@@ -129,10 +129,10 @@ void CO2Solubility( real64 const & T, real64 const & P, real64 & V_r, real64 (*f
   }
 }
 
-void CalculateCO2Solubility( real64_array const & pressure, real64_array const & temperature, real64 const & salinity, real64_array2d const & solubiltiy )
+real64 CalculateCO2Solubility( real64 const & pressure, real64 const & temperature, real64 const & salinity )
 {
 
-  real64 T, P, V_r, m, logK, y_CO2;
+  real64 V_r, logK, y_CO2;
 
   constexpr real64 mu[] =
   {28.9447706, -0.0354581768, -4770.67077, 1.02782768e-5, 33.8126098, 9.04037140e-3, -1.14934031e-3, -0.307405726, -0.0907301486, 9.32713393e-4, 0};
@@ -141,25 +141,30 @@ void CalculateCO2Solubility( real64_array const & pressure, real64_array const &
 
   constexpr real64 zeta[] = {3.36389723e-4, -1.98298980e-5, 0, 0, 0, 0, 0, 2.12220830e-3, -5.24873303e-3, 0, 0};
 
-  m = salinity;
+  real64 const m = salinity;
+  real64 const P = pressure / P_Pa_f;
+  real64 const T = temperature;
 
-  for( localIndex i = 0; i < pressure.size(); ++i )
-  {
+  CO2Solubility( T, P, V_r, &ff );
 
-    P = pressure[i] / P_Pa_f;
+  logK = Par( T+T_K_f, P, mu ) - logF( T, P, V_r ) + 2*Par( T+T_K_f, P, lambda )*m + Par( T+T_K_f, P, zeta )*m*m;
 
-    for( localIndex j = 0; j < temperature.size(); ++j )
-    {
+  y_CO2 = (P - PWater( T ))/P;
 
-      T = temperature[j];
+  return y_CO2 * P / exp( logK );
 
-      CO2Solubility( T, P, V_r, &ff );
+}
 
-      logK = Par( T+T_K_f, P, mu ) - logF( T, P, V_r ) + 2*Par( T+T_K_f, P, lambda )*m + Par( T+T_K_f, P, zeta )*m*m;
+void CalculateCO2Solubility( real64_array const & pressure, real64_array const & temperature, real64 const & salinity, real64_array2d const & solubiltiy )
+{
 
-      y_CO2 = (P - PWater( T ))/P;
+  for( localIndex i = 0; i < pressure.size(); ++i )
+  {
 
-      solubiltiy[i][j] = y_CO2 * P / exp( logK );
+    for( localIndex j = 0; j < temperature.size(); ++j )
+    {
+
+      solubiltiy[i][j] = CalculateCO2Solubility( pressure[i], temperature[j], salinity );
 
     }
 
@@ -309,6 +314,8 @@ void CO2SolubilityFunction::MakeTable( string_array const & inputPara )
 
   real64_array2d solubilities( nP, nT );
 
+  m_salinity = m;
+
   CalculateCO2Solubility( pressures, temperatures, m, solubilities );
 
   m_CO2SolubilityTable = std::make_shared< XYTable >( "CO2SolubilityTable", pressures, temperatures, solubilities );
@@ -328,7 +335,17 @@ void CO2SolubilityFunction::Partition( EvalVarArgs const & pressure, EvalVarArgs
   T.m_der[1] = 1.0;
 
   //solubiltiy mol/kg(water)  X = Csat/W
-  solubility = m_CO2SolubilityTable->Value( P, T );
+  if( m_CO2SolubilityTable->InRange( P.m_var, T.m_var ) || P.m_var <= 0.0 )
+  {
+    solubility = m_CO2SolubilityTable->Value( P, T );
+  }
+  else
+  {
+    // Outside the table the correlation is evaluated instead of extrapolated, with a finite-difference derivative
+    real64 const dP = 1e-6 * P.m_var;
+    solubility = CalculateCO2Solubility( P.m_var, T.m_var, m_salinity );
+    solubility.m_der[0] = ( CalculateCO2Solubility( P.m_var + dP, T.m_var, m_salinity ) - solubility.m_var ) / dP;
+  }
 
   real64 const waterMW = m_componentMolarWeight[m_waterIndex];
 
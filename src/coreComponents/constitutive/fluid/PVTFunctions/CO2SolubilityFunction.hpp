@@ -53,7 +53,8 @@ private:
 
   void MakeTable( const string_array & inputPara );
 
-  TableFunctionPtr m_CO2SolubilityTable;
+  std::shared_ptr< XYTable > m_CO2SolubilityTable;
+  real64 m_salinity;
   localIndex m_CO2Index;
   localIndex m_waterIndex;
   localIndex m_phaseGasIndex;
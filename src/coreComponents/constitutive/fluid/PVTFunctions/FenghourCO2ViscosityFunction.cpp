@@ -114,7 +114,17 @@ void FenghourCO2ViscosityFunction::Evaluation( EvalVarArgs const & pressure, Eva
   T.m_var = temperature.m_var;
   T.m_der[1] = 1.0;
 
-  viscosity = m_CO2ViscosityTable->Value( P, T );
+  if( m_CO2ViscosityTable->InRange( P.m_var, T.m_var ) || P.m_var <= 0.0 )
+  {
+    viscosity = m_CO2ViscosityTable->Value( P, T );
+  }
+  else
+  {
+    // Outside the table the correlation is evaluated instead of extrapolated, with a finite-difference derivative
+    real64 const dP = 1e-6 * P.m_var;
+    viscosity = CalculateCO2Viscosity( P.m_var, T.m_var );
+    viscosity.m_der[0] = ( CalculateCO2Viscosity( P.m_var + dP, T.m_var ) - viscosity.m_var ) / dP;
+  }
 
   value.m_var = viscosity.m_var;
   value.m_der[0] = viscosity.m_der[0];
@@ -148,6 +158,13 @@ void FenghourCO2ViscosityFunction::FenghourCO2Viscosity( real64 const & Tcent, r
   vis = 1e-6 * (vlimit + vxcess + vcrit);
 }
 
+real64 FenghourCO2ViscosityFunction::CalculateCO2Viscosity( real64 const pressure, real64 const temperature )
+{
+  real64 viscosity;
+  FenghourCO2Viscosity( temperature, SpanWagnerCO2DensityFunction::CalculateCO2Density( pressure, temperature ), viscosity );
+  return viscosity;
+}
+
 void FenghourCO2ViscosityFunction::CalculateCO2Viscosity( real64_array const & pressure, real64_array const & temperature, real64_array2d const & density,
                                                           real64_array2d const & viscosity )
 {
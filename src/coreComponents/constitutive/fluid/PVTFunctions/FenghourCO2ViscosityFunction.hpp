@@ -52,6 +52,14 @@ public:
                            arraySlice1d< EvalVarArgs const > const & phaseComposition,
                            EvalVarArgs & value, bool useMass = 0 ) const override;
 
+  /**
+   * @brief Evaluate the Fenghour correlation at a point, without the table.
+   * @param pressure the pressure (Pa)
+   * @param temperature the temperature (C)
+   * @return the CO2 viscosity (Pa.s)
+   */
+  static real64 CalculateCO2Viscosity( real64 const pressure, real64 const temperature );
+
 
 private:
 
@@ -60,9 +68,9 @@ private:
   void CalculateCO2Viscosity( real64_array const & pressure, real64_array const & temperature, real64_array2d const & density,
                               real64_array2d const & viscosity );
 
-  void FenghourCO2Viscosity( real64 const & Tcent, real64 const & den, real64 & vis );
+  static void FenghourCO2Viscosity( real64 const & Tcent, real64 const & den, real64 & vis );
 
-  TableFunctionPtr m_CO2ViscosityTable;
+  std::shared_ptr< XYTable > m_CO2ViscosityTable;
 };
 
 }
@@ -231,7 +231,17 @@ void SpanWagnerCO2DensityFunction::Evaluation( EvalVarArgs const & pressure, Eva
   T.m_var = temperature.m_var;
   T.m_der[1] = 1.0;
 
-  density = m_CO2DensityTable->Value( P, T );
+  if( m_CO2DensityTable->InRange( P.m_var, T.m_var ) || P.m_var <= 0.0 )
+  {
+    density = m_CO2DensityTable->Value( P, T );
+  }
+  else
+  {
+    // Outside the table the correlation is evaluated instead of extrapolated, with a finite-difference derivative
+    real64 const dP = 1e-6 * P.m_var;
+    density = CalculateCO2Density( P.m_var, T.m_var );
+    density.m_der[0] = ( CalculateCO2Density( P.m_var + dP, T.m_var ) - density.m_var ) / dP;
+  }
 
   real64 CO2MW = m_componentMolarWeight[m_CO2Index];
 
@@ -271,6 +281,15 @@ void SpanWagnerCO2DensityFunction::CalculateCO2Density( real64_array const & pre
   }
 }
 
+real64 SpanWagnerCO2DensityFunction::CalculateCO2Density( real64 const pressure, real64 const temperature )
+{
+  constexpr real64 T_K_f = 273.15;
+
+  real64 density;
+  SpanWagnerCO2Density( temperature + T_K_f, pressure, density, &f );
+  return density;
+}
+
 void SpanWagnerCO2DensityFunction::SpanWagnerCO2Density( real64 const & T, real64 const & P, real64 & rho, real64 (*f)( real64 const & x1, real64 const & x2,
                                                                                                                         real64 const & x3 ))
 {
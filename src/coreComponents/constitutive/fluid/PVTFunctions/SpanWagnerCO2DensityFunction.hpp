@@ -54,6 +54,14 @@ public:
 
   static void CalculateCO2Density( real64_array const & pressure, real64_array const & temperature, real64_array2d const & density );
 
+  /**
+   * @brief Evaluate the Span-Wagner correlation at a point, without the table.
+   * @param pressure the pressure (Pa)
+   * @param temperature the temperature (C)
+   * @return the CO2 mass density (kg/m3)
+   */
+  static real64 CalculateCO2Density( real64 const pressure, real64 const temperature );
+
 private:
 
   void MakeTable( string_array const & inputPara );
@@ -61,7 +69,7 @@ private:
   static void SpanWagnerCO2Density( real64 const & T, real64 const & P, real64 & rho, real64 (*f)( real64 const & x1, real64 const & x2, real64 const & x3 ));
 
 
-  TableFunctionPtr m_CO2DensityTable;
+  std::shared_ptr< XYTable > m_CO2DensityTable;
   localIndex m_CO2Index;
 
 };
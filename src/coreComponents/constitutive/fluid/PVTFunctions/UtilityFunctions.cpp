@@ -19,15 +19,57 @@
 
 #include "constitutive/fluid/PVTFunctions/UtilityFunctions.hpp"
 
+#include <algorithm>
+
 namespace geosx
 {
 
 namespace PVTProps
 {
 
+real64 uniformAxisInverseSpacing( real64_array const & axis )
+{
+  localIndex const n = axis.size();
+  if( n < 2 )
+  {
+    return 0.0;
+  }
+
+  real64 const spacing = ( axis[n-1] - axis[0] ) / ( n - 1 );
+  for( localIndex i = 0; i < n - 1; ++i )
+  {
+    if( fabs( axis[i+1] - axis[i] - spacing ) > 1e-6 * spacing )
+    {
+      return 0.0;
+    }
+  }
+  return spacing > 0.0 ? 1.0 / spacing : 0.0;
+}
+
+localIndex findAxisInterval( real64_array const & axis, real64 const invSpacing, real64 const x )
+{
+  if( invSpacing > 0.0 )
+  {
+    // the coordinates accumulate round-off errors, so the guess is corrected
+    localIndex i = static_cast< localIndex >( ( x - axis[0] ) * invSpacing );
+    i = std::max( localIndex( 0 ), std::min( i, axis.size() - 2 ) );
+    while( x <= axis[i] )
+    {
+      --i;
+    }
+    while( x > axis[i+1] )
+    {
+      ++i;
+    }
+    return i;
+  }
+
+  return std::lower_bound( axis.data(), axis.data() + axis.size(), x ) - axis.data() - 1;
+}
+
 EvalArgs2D XYTable::Value( EvalArgs2D const & x, EvalArgs2D const & y ) const
 {
-  localIndex_array xIndices( 2 ), yIndices( 2 );
+  localIndex xIndices[2], yIndices[2];
 
   //find i index
 
@@ -41,14 +83,7 @@ EvalArgs2D XYTable::Value( EvalArgs2D const & x, EvalArgs2D const & y ) const
   }
   else
   {
-    for( localIndex i = 1; i < m_x.size(); ++i )
-    {
-      if( x <= m_x[i] )
-      {
-        xIndices[0] = i - 1;
-        break;
-      }
-    }
+    xIndices[0] = findAxisInterval( m_x, m_xInvSpacing, x.m_var );
   }
 
   xIndices[1] = xIndices[0] + 1;
@@ -67,15 +102,7 @@ EvalArgs2D XYTable::Value( EvalArgs2D const & x, EvalArgs2D const & y ) const
   }
   else
   {
-    for( localIndex i = 1; i < m_y.size(); ++i )
-    {
-
-      if( y <= m_y[i] )
-      {
-        yIndices[0] = i - 1;
-        break;
-      }
-    }
+    yIndices[0] = findAxisInterval( m_y, m_yInvSpacing, y.m_var );
   }
 
   yIndices[1] = yIndices[0] + 1;
@@ -106,14 +133,7 @@ T XTable::GetValue( T const & x ) const
   }
   else
   {
-    for( localIndex i = 1; i < m_x.size(); ++i )
-    {
-      if( x <= m_x[i] )
-      {
-        idx = i - 1;
-        break;
-      }
-    }
+    idx = findAxisInterval( m_x, m_xInvSpacing, x.m_var );
   }
 
   T weight = (x - m_x[idx]) / (m_x[idx + 1] - m_x[idx]);
@@ -433,12 +433,30 @@ public:
 
 typedef std::shared_ptr< TableFunctionBase > TableFunctionPtr;
 
+/**
+ * @brief Compute the inverse of the spacing of a uniformly spaced table axis.
+ * @param axis the coordinates of the axis, in increasing order
+ * @return the inverse of the spacing, or zero if the axis is not uniformly spaced
+ */
+real64 uniformAxisInverseSpacing( real64_array const & axis );
+
+/**
+ * @brief Find the interval of a table axis containing a coordinate.
+ * @param axis the coordinates of the axis, in increasing order
+ * @param invSpacing the inverse of the spacing of the axis (see uniformAxisInverseSpacing)
+ * @param x the coordinate, with axis[0] < x <= axis[axis.size()-1]
+ * @return the index i such that axis[i] < x <= axis[i+1]
+ *
+ * The interval of a uniformly spaced axis is computed directly, the other axes are searched by bisection.
+ */
+localIndex findAxisInterval( real64_array const & axis, real64 const invSpacing, real64 const x );
+
 class XYTable : public TableFunctionBase
 {
 public:
 
   XYTable( std::string const & tableName, real64_array const & x, real64_array const & y, real64_array2d const & value ): m_tableName( tableName ), m_x( x ),
-    m_y( y ), m_value( value ) {}
+    m_y( y ), m_value( value ), m_xInvSpacing( uniformAxisInverseSpacing( x ) ), m_yInvSpacing( uniformAxisInverseSpacing( y ) ) {}
 
   ~XYTable(){}
 
@@ -476,6 +494,17 @@ public:
 
   virtual EvalArgs2D Value( EvalArgs2D const & x, EvalArgs2D const & y ) const;
 
+  /**
+   * @brief Check whether a point lies in the range of the table, where Value() interpolates.
+   * @param x the first coordinate
+   * @param y the second coordinate
+   * @return @p true if the point is inside the table, @p false if Value() would extrapolate
+   */
+  bool InRange( real64 const x, real64 const y ) const
+  {
+    return x >= m_x[0] && x <= m_x[m_x.size()-1] && y >= m_y[0] && y <= m_y[m_y.size()-1];
+  }
+
   virtual void Print() const
   {}
 
@@ -486,13 +515,17 @@ private:
   real64_array m_y;
   real64_array2d m_value;
 
+  real64 m_xInvSpacing;
+  real64 m_yInvSpacing;
+
 };
 
 class XTable : public TableFunctionBase
 {
 public:
 
-  XTable( string const & tableName, real64_array const & x, real64_array const & value ): m_tableName( tableName ), m_x( x ), m_value( value ) {}
+  XTable( string const & tableName, real64_array const & x, real64_array const & value ): m_tableName( tableName ), m_x( x ), m_value( value ),
+    m_xInvSpacing( uniformAxisInverseSpacing( x ) ) {}
   ~XTable(){}
 
   real64_array & XArray()
@@ -541,6 +574,8 @@ private:
   real64_array m_x;
   real64_array m_value;
 
+  real64 m_xInvSpacing;
+
 };
 
 } // namespace PVTProps
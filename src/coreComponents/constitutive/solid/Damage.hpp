@@ -49,9 +49,9 @@ public:
   using UPDATE_BASE::HyperElastic;
 
   GEOSX_HOST_DEVICE inline
-  virtual void GetStiffness( localIndex const k,
-                             localIndex const q,
-                             real64 (& c)[6][6] ) const override final
+  void GetStiffness( localIndex const k,
+                     localIndex const q,
+                     real64 (& c)[6][6] ) const
   {
     UPDATE_BASE::GetStiffness( k, q, c );
     real64 const damageFactor = ( 1.0 - m_damage( k, q ) )*( 1.0 - m_damage( k, q ) );
@@ -77,8 +77,8 @@ public:
 
 
   GEOSX_HOST_DEVICE
-  virtual real64 calculateStrainEnergyDensity( localIndex const k,
-                                               localIndex const q ) const override final
+  real64 calculateStrainEnergyDensity( localIndex const k,
+                                       localIndex const q ) const
   {
     real64 const sed = UPDATE_BASE::calculateStrainEnergyDensity( k, q );
     if( sed > m_strainEnergyDensity( k, q ) )
@@ -89,9 +89,9 @@ public:
   }
 
   GEOSX_HOST_DEVICE
-  virtual void getStress( localIndex const k,
-                          localIndex const q,
-                          real64 (& stress)[6] ) const override
+  void getStress( localIndex const k,
+                  localIndex const q,
+                  real64 (& stress)[6] ) const
   {
     real64 const damageFactor = ( 1.0 - m_damage( k, q ) )*( 1.0 - m_damage( k, q ) );
 
@@ -74,12 +74,12 @@ public:
 
 
   /**
-   * @copydoc SolidBase::GetStiffness
+   * @copydoc SolidBaseUpdates::GetStiffness
    */
   GEOSX_HOST_DEVICE inline
-  virtual void GetStiffness( localIndex const k,
-                             localIndex const q,
-                             real64 (& c)[6][6] ) const override
+  void GetStiffness( localIndex const k,
+                     localIndex const q,
+                     real64 (& c)[6][6] ) const
   {
     GEOSX_UNUSED_VAR( q );
     real64 const G = m_shearModulus[k];
@@ -144,34 +144,34 @@ public:
   }
 
   GEOSX_HOST_DEVICE
-  virtual void SmallStrainNoState( localIndex const k,
-                                   real64 const ( &voigtStrain )[ 6 ],
-                                   real64 ( &stress )[ 6 ] ) const override final;
+  void SmallStrainNoState( localIndex const k,
+                           real64 const ( &voigtStrain )[ 6 ],
+                           real64 ( &stress )[ 6 ] ) const;
 
   GEOSX_HOST_DEVICE
-  virtual void SmallStrain( localIndex const k,
-                            localIndex const q,
-                            real64 const ( &voigtStrainInc )[ 6 ] ) const override final;
+  void SmallStrain( localIndex const k,
+                    localIndex const q,
+                    real64 const ( &voigtStrainInc )[ 6 ] ) const;
 
   GEOSX_HOST_DEVICE
-  virtual void HypoElastic( localIndex const k,
-                            localIndex const q,
-                            real64 const ( &Ddt )[ 6 ],
-                            real64 const ( &Rot )[ 3 ][ 3 ] ) const override final;
+  void HypoElastic( localIndex const k,
+                    localIndex const q,
+                    real64 const ( &Ddt )[ 6 ],
+                    real64 const ( &Rot )[ 3 ][ 3 ] ) const;
 
   GEOSX_HOST_DEVICE
-  virtual void HyperElastic( localIndex const k,
-                             real64 const (&FmI)[3][3],
-                             real64 ( &stress )[ 6 ] ) const override final;
+  void HyperElastic( localIndex const k,
+                     real64 const (&FmI)[3][3],
+                     real64 ( &stress )[ 6 ] ) const;
 
   GEOSX_HOST_DEVICE
-  virtual void HyperElastic( localIndex const k,
-                             localIndex const q,
-                             real64 const (&FmI)[3][3] ) const override final;
+  void HyperElastic( localIndex const k,
+                     localIndex const q,
+                     real64 const (&FmI)[3][3] ) const;
 
   GEOSX_HOST_DEVICE
-  virtual real64 calculateStrainEnergyDensity( localIndex const k,
-                                               localIndex const q ) const override;
+  real64 calculateStrainEnergyDensity( localIndex const k,
+                                       localIndex const q ) const;
 
 private:
   /// A reference to the ArrayView holding the bulk modulus for each element.
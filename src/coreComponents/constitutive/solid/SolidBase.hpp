@@ -42,6 +42,13 @@ namespace constitutive
  * of the data indicates the distinction from a parameter and a state variable,
  * with the parameters being "T const" and the state variables being "T".
  *
+ * The state update functions are not virtual. The kernels are instantiated
+ * for the concrete update type (see ConstitutivePassThru), so that the calls
+ * are resolved at compile time and the updates can be fully inlined, and the
+ * wrappers carry no virtual table pointer when they are captured in device
+ * lambdas. Derived classes provide the functions declared (and deleted) here
+ * by hiding them.
+ *
  * @note If an allocation occurs on  the underlying Array after a KernelWrapper
  * is created, then the ArrayView members of that KernelWrapper are silently
  * invalid.
@@ -81,10 +88,16 @@ protected:
   SolidBaseUpdates & operator=( SolidBaseUpdates && ) =  delete;
 
 public:
+  /**
+   * @brief Get the stress at a given element and quadrature point.
+   * @param[in] k The element index.
+   * @param[in] q The quadrature point index.
+   * @param[out] stress The stress in Voigt notation.
+   */
   GEOSX_HOST_DEVICE
-  virtual void getStress( localIndex const k,
-                          localIndex const q,
-                          real64 (& stress)[6] ) const
+  void getStress( localIndex const k,
+                  localIndex const q,
+                  real64 (& stress)[6] ) const
   {
     stress[0] = this->m_stress( k, q, 0 );
     stress[1] = this->m_stress( k, q, 1 );
@@ -97,7 +110,7 @@ public:
   /// A reference the material stress at quadrature points.
   arrayView3d< real64, solid::STRESS_USD > const m_stress;
 
-private:
+protected:
   /**
    * Return the stiffness at a given element and quadrature point.
    * @param k The element index.
@@ -105,9 +118,9 @@ private:
    * @param c The stiffness array in Voigt notation.
    */
   GEOSX_HOST_DEVICE
-  virtual void GetStiffness( localIndex const k,
-                             localIndex const q,
-                             real64 ( &c )[6][6] ) const = 0;
+  void GetStiffness( localIndex const k,
+                     localIndex const q,
+                     real64 ( &c )[6][6] ) const = delete;
 
   /**
    * @brief Calculate stress using input generated under small strain
@@ -117,9 +130,9 @@ private:
    * @param[out] stress Pointer to the stress data in Voigt notation.
    */
   GEOSX_HOST_DEVICE
-  virtual void SmallStrainNoState( localIndex const k,
-                                   real64 const ( &voigtStrain )[ 6 ],
-                                   real64 ( &stress )[ 6 ] ) const = 0;
+  void SmallStrainNoState( localIndex const k,
+                           real64 const ( &voigtStrain )[ 6 ],
+                           real64 ( &stress )[ 6 ] ) const = delete;
 
   /**
    * @brief Update the constitutive state using input generated under small
@@ -130,9 +143,9 @@ private:
    *                                 notation.
    */
   GEOSX_HOST_DEVICE
-  virtual void SmallStrain( localIndex const k,
-                            localIndex const q,
-                            real64 const ( &voigtStrainInc )[ 6 ] ) const = 0;
+  void SmallStrain( localIndex const k,
+                    localIndex const q,
+                    real64 const ( &voigtStrainInc )[ 6 ] ) const = delete;
 
   /**
    * @brief Hypoelastic update to the constitutive state using input generated
@@ -144,10 +157,10 @@ private:
    * @param[in] Rot The incremental rotation tensor
    */
   GEOSX_HOST_DEVICE
-  virtual void HypoElastic( localIndex const k,
-                            localIndex const q,
-                            real64 const ( &Ddt )[ 6 ],
-                            real64 const ( &Rot )[ 3 ][ 3 ] ) const = 0;
+  void HypoElastic( localIndex const k,
+                    localIndex const q,
+                    real64 const ( &Ddt )[ 6 ],
+                    real64 const ( &Rot )[ 3 ][ 3 ] ) const = delete;
 
   /**
    * @brief Hyper-elastic stress update
@@ -156,9 +169,9 @@ private:
    * @param[out] stress Pointer to the stress data in Voigt notation.
    */
   GEOSX_HOST_DEVICE
-  virtual void HyperElastic( localIndex const k,
-                             real64 const (&FmI)[3][3],
-                             real64 ( &stress )[ 6 ] ) const = 0;
+  void HyperElastic( localIndex const k,
+                     real64 const (&FmI)[3][3],
+                     real64 ( &stress )[ 6 ] ) const = delete;
 
   /**
    * @brief Hyper-elastic state update
@@ -167,14 +180,19 @@ private:
    * @param[in] FmI The deformation gradient minus Identity
    */
   GEOSX_HOST_DEVICE
-  virtual void HyperElastic( localIndex const k,
-                             localIndex const q,
-                             real64 const (&FmI)[3][3] ) const = 0;
+  void HyperElastic( localIndex const k,
+                     localIndex const q,
+                     real64 const (&FmI)[3][3] ) const = delete;
 
+  /**
+   * @brief Calculate the strain energy density at a given element and quadrature point.
+   * @param[in] k The element index.
+   * @param[in] q The quadrature point index.
+   * @return The strain energy density.
+   */
   GEOSX_HOST_DEVICE
-  virtual real64 calculateStrainEnergyDensity( localIndex const k,
-                                               localIndex const q ) const = 0;
-
+  real64 calculateStrainEnergyDensity( localIndex const k,
+                                       localIndex const q ) const = delete;
 
 };
 
@@ -92,6 +92,12 @@ void stressCheck( real64 const stressV[6], real64 const stressV2[6] )
   ASSERT_DOUBLE_EQ( stressV2[5], stressV[5] );
 }
 
+TEST( LinearElasticAnisotropicTests, testKernelWrapperIsNotPolymorphic )
+{
+  // the updates are resolved at compile time in the kernels and carry no virtual table pointer
+  static_assert( !std::is_polymorphic< LinearElasticAnisotropic::KernelWrapper >::value, "unexpected virtual function" );
+}
+
 TEST( LinearElasticAnisotropicTests, testStateUpdatePoint )
 {
   LinearElasticAnisotropic cm( "model", nullptr );
@@ -17,6 +17,7 @@
 #include "gtest/gtest.h"
 
 #include "constitutive/ConstitutiveManager.hpp"
+#include "constitutive/solid/Damage.hpp"
 #include "constitutive/solid/LinearElasticIsotropic.hpp"
 
 #include "dataRepository/xmlWrapper.hpp"
@@ -48,6 +49,13 @@ TEST( LinearElasticIsotropicTests, testAllocation )
   EXPECT_EQ( stress.size( 2 ), 6 );
 }
 
+TEST( LinearElasticIsotropicTests, testKernelWrapperIsNotPolymorphic )
+{
+  // the updates are resolved at compile time in the kernels and carry no virtual table pointer
+  static_assert( !std::is_polymorphic< LinearElasticIsotropic::KernelWrapper >::value, "unexpected virtual function" );
+  static_assert( !std::is_polymorphic< Damage< LinearElasticIsotropic >::KernelWrapper >::value, "unexpected virtual function" );
+}
+
 TEST( LinearElasticIsotropicTests, testStateUpdatePoint )
 {
   LinearElasticIsotropic cm( "model", nullptr );
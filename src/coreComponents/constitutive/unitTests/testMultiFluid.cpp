@@ -18,6 +18,10 @@
 #include "common/TimingMacros.hpp"
 #include "constitutive/fluid/multiFluidSelector.hpp"
 #include "constitutive/fluid/MultiFluidUtils.hpp"
+#include "constitutive/fluid/PVTFunctions/CO2SolubilityFunction.hpp"
+#include "constitutive/fluid/PVTFunctions/FenghourCO2ViscosityFunction.hpp"
+#include "constitutive/fluid/PVTFunctions/SpanWagnerCO2DensityFunction.hpp"
+#include "constitutive/fluid/PVTFunctions/UtilityFunctions.hpp"
 #include "physicsSolvers/fluidFlow/unitTests/testCompFlowUtils.hpp"
 
 // TPL includes
@@ -267,6 +271,56 @@ void testNumericalDerivatives( MultiFluidBase & fluid,
   } );
 }
 
+void testParallelUpdate( MultiFluidBase & fluid,
+                         real64 const P,
+                         real64 const T,
+                         arraySlice1d< real64 const > const & composition,
+                         real64 const relTol )
+{
+  localIndex const numCells = 64;
+  Group cells( "cells", nullptr );
+  cells.resize( numCells );
+
+  // clones of the fluid updated serially and in parallel over cells of increasing pressure
+  std::unique_ptr< ConstitutiveBase > serialFluidPtr = fluid.deliverClone( "serialFluid", nullptr );
+  std::unique_ptr< ConstitutiveBase > parallelFluidPtr = fluid.deliverClone( "parallelFluid", nullptr );
+  MultiFluidBase & serialFluid = *serialFluidPtr->group_cast< MultiFluidBase * >();
+  MultiFluidBase & parallelFluid = *parallelFluidPtr->group_cast< MultiFluidBase * >();
+  serialFluid.allocateConstitutiveData( &cells, 1 );
+  parallelFluid.allocateConstitutiveData( &cells, 1 );
+
+  constitutive::constitutiveUpdatePassThru( serialFluid, [&] ( auto & castedFluid )
+  {
+    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+    forAll< serialPolicy >( numCells, [=] ( localIndex const k )
+    {
+      fluidWrapper.Update( k, 0, P * ( 1.0 + 0.01 * k ), T, composition );
+    } );
+  } );
+
+  constitutive::constitutiveUpdatePassThru( parallelFluid, [&] ( auto & castedFluid )
+  {
+    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+    forAll< parallelHostPolicy >( numCells, [=] ( localIndex const k )
+    {
+      fluidWrapper.Update( k, 0, P * ( 1.0 + 0.01 * k ), T, composition );
+    } );
+  } );
+
+  arrayView3d< real64 const > const & serialPhaseFrac = serialFluid.phaseFraction();
+  arrayView3d< real64 const > const & parallelPhaseFrac = parallelFluid.phaseFraction();
+  arrayView3d< real64 const > const & serialPhaseDens = serialFluid.phaseDensity();
+  arrayView3d< real64 const > const & parallelPhaseDens = parallelFluid.phaseDensity();
+  for( localIndex k = 0; k < numCells; ++k )
+  {
+    for( localIndex ip = 0; ip < fluid.numFluidPhases(); ++ip )
+    {
+      checkRelativeError( parallelPhaseFrac[k][0][ip], serialPhaseFrac[k][0][ip], relTol, "phaseFrac" );
+      checkRelativeError( parallelPhaseDens[k][0][ip], serialPhaseDens[k][0][ip], relTol, "phaseDens" );
+    }
+  }
+}
+
 MultiFluidBase * makeCompositionalFluid( string const & name, Group & parent )
 {
   auto fluid = parent.RegisterGroup< CompositionalMultiphaseFluid >( name );
@@ -356,6 +410,18 @@ TEST_F( CompositionalFluidTest, numericalDerivativesMass )
   testNumericalDerivatives( *fluid, P, T, comp, eps, relTol );
 }
 
+TEST_F( CompositionalFluidTest, parallelUpdateMatchesSerial )
+{
+  fluid->setMassFlag( false );
+
+  real64 const P = 5e6;
+  real64 const T = 297.15;
+  array1d< real64 > comp( 4 );
+  comp[0] = 0.099; comp[1] = 0.3; comp[2] = 0.6; comp[3] = 0.001;
+
+  testParallelUpdate( *fluid, P, T, comp.toSliceConst(), 1e-10 );
+}
+
 MultiFluidBase * makeLiveOilFluid( string const & name, Group * parent )
 {
   auto fluid = parent->RegisterGroup< BlackOilFluid >( name );
@@ -498,6 +564,18 @@ TEST_F( LiveOilFluidTest, numericalDerivativesMass )
   testNumericalDerivatives( *fluid, P, T, comp, eps, relTol, absTol );
 }
 
+TEST_F( LiveOilFluidTest, parallelUpdateMatchesSerial )
+{
+  fluid->setMassFlag( true );
+
+  real64 const P = 5e6;
+  real64 const T = 297.15;
+  array1d< real64 > comp( 3 );
+  comp[0] = 0.1; comp[1] = 0.3; comp[2] = 0.6;
+
+  testParallelUpdate( *fluid, P, T, comp.toSliceConst(), 1e-10 );
+}
+
 class DeadOilFluidTest : public ::testing::Test
 {
 protected:
@@ -560,6 +638,168 @@ TEST_F( DeadOilFluidTest, numericalDerivativesMass )
   testNumericalDerivatives( *fluid, P, T, comp, eps, relTol, absTol );
 }
 
+TEST( PVTTableTest, findAxisIntervalMatchesLinearSearch )
+{
+  // axis built by accumulation, as the CO2-brine tables are, and a non-uniform axis
+  real64_array uniformAxis;
+  for( real64 P = 1e6; P <= 5e7; P += 1e6 )
+  {
+    uniformAxis.emplace_back( P );
+  }
+  real64_array nonUniformAxis;
+  for( localIndex i = 0; i < 20; ++i )
+  {
+    nonUniformAxis.emplace_back( 1e6 * i * i );
+  }
+
+  EXPECT_GT( PVTProps::uniformAxisInverseSpacing( uniformAxis ), 0.0 );
+  EXPECT_EQ( PVTProps::uniformAxisInverseSpacing( nonUniformAxis ), 0.0 );
+
+  for( real64_array const * const axis : { &uniformAxis, &nonUniformAxis } )
+  {
+    real64 const invSpacing = PVTProps::uniformAxisInverseSpacing( *axis );
+    localIndex const n = axis->size();
+
+    // the nodes, the midpoints and the points just above the nodes
+    real64_array coords;
+    for( localIndex i = 1; i < n; ++i )
+    {
+      coords.emplace_back( (*axis)[i] );
+      coords.emplace_back( 0.5 * ( (*axis)[i-1] + (*axis)[i] ) );
+      coords.emplace_back( (*axis)[i-1] + 1e-9 * ( (*axis)[i] - (*axis)[i-1] ) );
+    }
+
+    for( real64 const x : coords )
+    {
+      localIndex expected = 0;
+      while( x > (*axis)[expected+1] )
+      {
+        ++expected;
+      }
+      EXPECT_EQ( PVTProps::findAxisInterval( *axis, invSpacing, x ), expected );
+    }
+  }
+}
+
+/**
+ * @brief Build the input of a CO2-brine function tabulated over [1e6, 1.5e7] Pa and [94, 96] C.
+ * @param keyword the keyword of the function
+ * @param name the name of the function
+ * @return the input strings
+ */
+string_array makeCO2BrineInput( char const * const keyword, char const * const name )
+{
+  string_array inputPara;
+  for( char const * const para : { keyword, name, "1e6", "1.5e7", "5e4", "94", "96", "1", "0" } )
+  {
+    inputPara.emplace_back( para );
+  }
+  return inputPara;
+}
+
+/**
+ * @brief Evaluate a CO2-brine PVT function at a pressure and a temperature.
+ * @param function the function
+ * @param pressure the pressure (Pa)
+ * @param temperature the temperature (C)
+ * @return the value, with the pressure derivative
+ */
+PVTProps::EvalVarArgs evaluateCO2BrineFunction( PVTProps::PVTFunction const & function,
+                                                 real64 const pressure,
+                                                 real64 const temperature )
+{
+  PVTProps::EvalVarArgs P( pressure );
+  P.m_der[0] = 1.0;
+  PVTProps::EvalVarArgs const T( temperature );
+  stackArray2d< PVTProps::EvalVarArgs, 2 > phaseComposition( 1, 2 );
+  PVTProps::EvalVarArgs value;
+  function.Evaluation( P, T, phaseComposition[0], value, true );
+  return value;
+}
+
+TEST( PVTTableTest, CO2BrineFunctionsEvaluateCorrelationsOutsideTables )
+{
+  string_array componentNames;
+  componentNames.emplace_back( "CO2" );
+  componentNames.emplace_back( "Water" );
+  real64_array componentMolarWeight;
+  componentMolarWeight.emplace_back( 44e-3 );
+  componentMolarWeight.emplace_back( 18e-3 );
+
+  PVTProps::SpanWagnerCO2DensityFunction const density( makeCO2BrineInput( "DensityFun", "SpanWagnerCO2Density" ),
+                                                        componentNames, componentMolarWeight );
+  PVTProps::FenghourCO2ViscosityFunction const viscosity( makeCO2BrineInput( "ViscosityFun", "FenghourCO2Viscosity" ),
+                                                          componentNames, componentMolarWeight );
+
+  real64 const T = 95.0;
+
+  // Inside the tables the values are interpolated between exact nodes
+  {
+    real64 const P = 1.0012e7;
+    EXPECT_NEAR( evaluateCO2BrineFunction( density, P, T ).m_var,
+                 PVTProps::SpanWagnerCO2DensityFunction::CalculateCO2Density( P, T ), 1e-3 * evaluateCO2BrineFunction( density, P, T ).m_var );
+    EXPECT_NEAR( evaluateCO2BrineFunction( viscosity, P, T ).m_var,
+                 PVTProps::FenghourCO2ViscosityFunction::CalculateCO2Viscosity( P, T ), 1e-3 * evaluateCO2BrineFunction( viscosity, P, T ).m_var );
+  }
+
+  // Above the tables the correlations are evaluated instead of extrapolated, with consistent derivatives
+  for( real64 const P : { 2e7, 3.5e7 } )
+  {
+    real64 const dP = 1e-4 * P;
+
+    PVTProps::EvalVarArgs const rho = evaluateCO2BrineFunction( density, P, T );
+    EXPECT_DOUBLE_EQ( rho.m_var, PVTProps::SpanWagnerCO2DensityFunction::CalculateCO2Density( P, T ) );
+    real64 const dRho_dP = ( PVTProps::SpanWagnerCO2DensityFunction::CalculateCO2Density( P + dP, T ) -
+                             PVTProps::SpanWagnerCO2DensityFunction::CalculateCO2Density( P - dP, T ) ) / ( 2.0 * dP );
+    EXPECT_NEAR( rho.m_der[0], dRho_dP, 1e-3 * fabs( dRho_dP ) );
+
+    PVTProps::EvalVarArgs const mu = evaluateCO2BrineFunction( viscosity, P, T );
+    EXPECT_DOUBLE_EQ( mu.m_var, PVTProps::FenghourCO2ViscosityFunction::CalculateCO2Viscosity( P, T ) );
+    real64 const dMu_dP = ( PVTProps::FenghourCO2ViscosityFunction::CalculateCO2Viscosity( P + dP, T ) -
+                            PVTProps::FenghourCO2ViscosityFunction::CalculateCO2Viscosity( P - dP, T ) ) / ( 2.0 * dP );
+    EXPECT_NEAR( mu.m_der[0], dMu_dP, 1e-3 * fabs( dMu_dP ) );
+  }
+}
+
+TEST( PVTTableTest, CO2SolubilityIsContinuousAtTableBoundary )
+{
+  string_array componentNames;
+  componentNames.emplace_back( "CO2" );
+  componentNames.emplace_back( "Water" );
+  string_array phaseNames;
+  phaseNames.emplace_back( "gas" );
+  phaseNames.emplace_back( "liquid" );
+  real64_array componentMolarWeight;
+  componentMolarWeight.emplace_back( 44e-3 );
+  componentMolarWeight.emplace_back( 18e-3 );
+
+  PVTProps::CO2SolubilityFunction const flash( makeCO2BrineInput( "FlashModel", "CO2Solubility" ),
+                                               phaseNames, componentNames, componentMolarWeight );
+
+  // The fraction of CO2 dissolved in the liquid phase of a two-phase mixture, from the last table node
+  // to the correlation evaluated just above it
+  auto dissolvedCO2 = [&]( real64 const pressure )
+  {
+    PVTProps::EvalVarArgs P( pressure );
+    P.m_der[0] = 1.0;
+    PVTProps::EvalVarArgs const T( 95.0 );
+    stackArray1d< PVTProps::EvalVarArgs, 2 > compFraction( 2 );
+    compFraction[0] = 0.5;
+    compFraction[1] = 0.5;
+    stackArray1d< PVTProps::EvalVarArgs, 2 > phaseFraction( 2 );
+    stackArray2d< PVTProps::EvalVarArgs, 4 > phaseCompFraction( 2, 2 );
+    flash.Partition( P, T, compFraction, phaseFraction, phaseCompFraction );
+    return phaseCompFraction[1][0].m_var;
+  };
+
+  real64 lastNode = 1e6;
+  while( lastNode + 5e4 <= 1.5e7 )
+  {
+    lastNode += 5e4;
+  }
+  EXPECT_NEAR( dissolvedCO2( lastNode * ( 1.0 + 1e-9 ) ), dissolvedCO2( lastNode ), 1e-6 * dissolvedCO2( lastNode ) );
+}
+
 int main( int argc, char * * argv )
 {
   ::testing::InitGoogleTest( &argc, argv );
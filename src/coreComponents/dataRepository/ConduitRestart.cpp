@@ -19,6 +19,7 @@
 // Source includes
 #include "ConduitRestart.hpp"
 #include "mpiCommunications/MpiWrapper.hpp"
+#include "common/BackgroundWriter.hpp"
 #include "common/TimingMacros.hpp"
 #include "common/Path.hpp"
 
@@ -33,7 +34,27 @@ namespace dataRepository
 conduit::Node rootConduitNode;
 
 
-std::string writeRootFile( conduit::Node & root, std::string const & rootPath )
+void writeNode( conduit::Node const & node, std::string const & path, integer const maxAsyncWrites )
+{
+  if( maxAsyncWrites <= 0 )
+  {
+    // HDF5 is not thread-safe, the writes queued by other outputs must complete first.
+    BackgroundWriter::get().wait();
+    conduit::relay::io::save( node, path, "hdf5" );
+    return;
+  }
+
+  // Stage a copy of the data, the tree may reference the data of the wrappers through external pointers.
+  std::shared_ptr< conduit::Node > const snapshot = std::make_shared< conduit::Node >();
+  node.compact_to( *snapshot );
+  BackgroundWriter::get().push( [snapshot, path]()
+  {
+    conduit::relay::io::save( *snapshot, path, "hdf5" );
+  }, maxAsyncWrites );
+}
+
+
+std::string writeRootFile( conduit::Node & root, std::string const & rootPath, integer const maxAsyncWrites )
 {
   std::string rootDirName, rootFileName;
   splitPath( rootPath, rootDirName, rootFileName );
@@ -51,7 +72,7 @@ std::string writeRootFile( conduit::Node & root, std::string const & rootPath )
     root[ "number_of_trees" ] = 1;
     root[ "tree_pattern" ] = "/";
 
-    conduit::relay::io::save( root, rootPath + ".root", "hdf5" );
+    writeNode( root, rootPath + ".root", maxAsyncWrites );
   }
 
   MpiWrapper::Barrier( MPI_COMM_GEOSX );
@@ -62,51 +83,243 @@ std::string writeRootFile( conduit::Node & root, std::string const & rootPath )
 }
 
 
-std::string readRootNode( std::string const & rootPath )
+namespace
+{
+
+/// The pattern of the file names of the restart being read, including the directory.
+std::string restartFilePattern;
+
+/// The pattern of the tree paths in the files of the restart being read, empty if each file holds one tree.
+std::string restartTreePattern;
+
+/// The number of ranks that wrote the restart being read.
+int restartNumberOfRanks = -1;
+
+/// The number of ranks whose trees are aggregated in each file of the restart being read.
+int restartRanksPerFile = 1;
+
+std::string rankTreePath( int const writerRank )
+{
+  char buffer[ 1024 ];
+  GEOSX_ERROR_IF_GE( std::snprintf( buffer, 1024, restartFilePattern.data(), writerRank / restartRanksPerFile ), 1024 );
+  std::string path = buffer;
+
+  if( !restartTreePattern.empty() )
+  {
+    GEOSX_ERROR_IF_GE( std::snprintf( buffer, 1024, restartTreePattern.data(), writerRank ), 1024 );
+    path += std::string( ":" ) + buffer;
+  }
+  return path;
+}
+
+/**
+ * @brief Write the trees of groups of ranks to one file per group.
+ * @param path the path of the restart
+ * @param ranksPerFile the number of ranks per group
+ * @param maxAsyncWrites the maximum number of writes in flight in the background, 0 to write synchronously
+ *
+ * The trees are serialized and gathered on the first rank of each group, which writes them
+ * under a "rank_%07d" child of the file root.
+ */
+void writeAggregatedTree( std::string const & path, int const ranksPerFile, integer const maxAsyncWrites )
+{
+  int const rank = MpiWrapper::Comm_rank();
+  int const numRanks = MpiWrapper::Comm_size();
+  int const fileIndex = rank / ranksPerFile;
+
+  std::string rootDirName, rootFileName;
+  splitPath( path, rootDirName, rootFileName );
+
+  if( rank == 0 )
+  {
+    makeDirsForPath( path );
+
+    conduit::Node root;
+    root[ "protocol/name" ] = "hdf5";
+    root[ "protocol/version" ] = CONDUIT_VERSION;
+
+    root[ "number_of_files" ] = ( numRanks + ranksPerFile - 1 ) / ranksPerFile;
+    root[ "file_pattern" ] = rootFileName + "/group_%07d.hdf5";
+
+    root[ "number_of_trees" ] = numRanks;
+    root[ "tree_pattern" ] = "rank_%07d";
+    root[ "ranks_per_file" ] = ranksPerFile;
+
+    writeNode( root, path + ".root", maxAsyncWrites );
+  }
+
+  MpiWrapper::Barrier( MPI_COMM_GEOSX );
+
+  MPI_Comm groupComm = MpiWrapper::Comm_split( MPI_COMM_GEOSX, fileIndex, rank );
+  int const groupRank = MpiWrapper::Comm_rank( groupComm );
+  int const groupSize = MpiWrapper::Comm_size( groupComm );
+
+  // The aggregator writes its own tree directly.
+  std::string schema;
+  std::vector< conduit::uint8 > data;
+  if( groupRank > 0 )
+  {
+    conduit::Schema compactSchema;
+    rootConduitNode.schema().compact_to( compactSchema );
+    schema = compactSchema.to_json();
+    rootConduitNode.serialize( data );
+  }
+
+  // The trees of a group can add up to more than INT_MAX bytes, so they are received
+  // rank by rank at 64-bit offsets rather than with a single gatherv.
+  std::size_t const sizes[ 2 ] = { schema.size(), data.size() };
+  std::vector< std::size_t > groupSizes( 2 * groupSize );
+  MpiWrapper::gather( sizes, 2, groupSizes.data(), 2, 0, groupComm );
+
+  std::vector< std::size_t > schemaOffsets( groupSize + 1, 0 );
+  std::vector< std::size_t > dataOffsets( groupSize + 1, 0 );
+  for( int r = 0; r < groupSize; ++r )
+  {
+    schemaOffsets[r + 1] = schemaOffsets[r] + groupSizes[ 2 * r ];
+    dataOffsets[r + 1] = dataOffsets[r] + groupSizes[ 2 * r + 1 ];
+  }
+
+  int const schemaTag = 0;
+  int const dataTag = 1;
+  std::vector< char > groupSchemas;
+  std::vector< conduit::uint8 > groupData;
+  std::vector< MPI_Request > requests;
+  if( groupRank == 0 )
+  {
+    groupSchemas.resize( schemaOffsets[ groupSize ] );
+    groupData.resize( dataOffsets[ groupSize ] );
+    requests.resize( 2 * ( groupSize - 1 ) );
+    for( int r = 1; r < groupSize; ++r )
+    {
+      MpiWrapper::iRecv( groupSchemas.data() + schemaOffsets[r],
+                         LvArray::integerConversion< int >( groupSizes[ 2 * r ] ),
+                         r, schemaTag, groupComm, &requests[ 2 * ( r - 1 ) ] );
+      MpiWrapper::iRecv( groupData.data() + dataOffsets[r],
+                         LvArray::integerConversion< int >( groupSizes[ 2 * r + 1 ] ),
+                         r, dataTag, groupComm, &requests[ 2 * ( r - 1 ) + 1 ] );
+    }
+  }
+  else
+  {
+    requests.resize( 2 );
+    MpiWrapper::iSend( schema.data(), LvArray::integerConversion< int >( sizes[ 0 ] ), 0, schemaTag, groupComm, &requests[ 0 ] );
+    MpiWrapper::iSend( data.data(), LvArray::integerConversion< int >( sizes[ 1 ] ), 0, dataTag, groupComm, &requests[ 1 ] );
+  }
+  MpiWrapper::Waitall( LvArray::integerConversion< int >( requests.size() ), requests.data(), MPI_STATUSES_IGNORE );
+
+  if( groupRank == 0 )
+  {
+    conduit::Node fileRoot;
+    for( int r = 0; r < groupSize; ++r )
+    {
+      char treeName[ 32 ];
+      std::snprintf( treeName, 32, "rank_%07d", rank + r );
+      if( r == 0 )
+      {
+        fileRoot[ treeName ].set_external( rootConduitNode );
+      }
+      else
+      {
+        std::string const treeSchema( groupSchemas.data() + schemaOffsets[r], groupSizes[ 2 * r ] );
+        conduit::Generator( treeSchema, "conduit_json", groupData.data() + dataOffsets[r] ).walk( fileRoot[ treeName ] );
+      }
+    }
+
+    char buffer[ 1024 ];
+    GEOSX_ERROR_IF_GE( std::snprintf( buffer, 1024, "%s/group_%07d.hdf5", path.data(), fileIndex ), 1024 );
+    GEOSX_LOG_RANK( "Writing out restart file of " << groupSize << " ranks at " << buffer );
+    writeNode( fileRoot, buffer, maxAsyncWrites );
+  }
+
+  MpiWrapper::Comm_free( groupComm );
+}
+
+} // namespace
+
+void readRootNode( std::string const & rootPath )
 {
-  std::string rankFilePattern;
   if( MpiWrapper::Comm_rank() == 0 )
   {
     conduit::Node node;
     conduit::relay::io::load( rootPath + ".root", "hdf5", node );
 
-    int const nFiles = node.fetch_child( "number_of_files" ).value();
-    GEOSX_ERROR_IF_NE( nFiles, MpiWrapper::Comm_size() );
+    restartNumberOfRanks = node.fetch_child( "number_of_files" ).value();
+    restartRanksPerFile = 1;
+    restartTreePattern.clear();
+    if( node.has_child( "ranks_per_file" ) )
+    {
+      restartRanksPerFile = node.fetch_child( "ranks_per_file" ).value();
+      restartNumberOfRanks = node.fetch_child( "number_of_trees" ).value();
+      restartTreePattern = node.fetch_child( "tree_pattern" ).as_string();
+    }
+    GEOSX_ERROR_IF_LE( restartNumberOfRanks, 0 );
 
     std::string const filePattern = node.fetch_child( "file_pattern" ).as_string();
 
     std::string rootDirName, rootFileName;
     splitPath( rootPath, rootDirName, rootFileName );
 
-    rankFilePattern = rootDirName + "/" + filePattern;
-    GEOSX_LOG_RANK_VAR( rankFilePattern );
+    restartFilePattern = rootDirName + "/" + filePattern;
+    GEOSX_LOG_RANK_VAR( restartFilePattern );
   }
 
-  MpiWrapper::Broadcast( rankFilePattern, 0 );
-
-  char buffer[ 1024 ];
-  GEOSX_ERROR_IF_GE( std::snprintf( buffer, 1024, rankFilePattern.data(), MpiWrapper::Comm_rank() ), 1024 );
-  return buffer;
+  MpiWrapper::Broadcast( restartNumberOfRanks, 0 );
+  MpiWrapper::Broadcast( restartRanksPerFile, 0 );
+  MpiWrapper::Broadcast( restartFilePattern, 0 );
+  MpiWrapper::Broadcast( restartTreePattern, 0 );
 }
 
 /* Write out a restart file. */
-void writeTree( std::string const & path )
+void writeTree( std::string const & path, int const ranksPerFile, integer const maxAsyncWrites )
 {
   GEOSX_MARK_FUNCTION;
 
+  if( ranksPerFile > 1 )
+  {
+    writeAggregatedTree( path, ranksPerFile, maxAsyncWrites );
+    return;
+  }
+
   conduit::Node root;
-  std::string const filePathForRank = writeRootFile( root, path );
+  std::string const filePathForRank = writeRootFile( root, path, maxAsyncWrites );
   GEOSX_LOG_RANK( "Writing out restart file at " << filePathForRank );
-  conduit::relay::io::save( rootConduitNode, filePathForRank, "hdf5" );
+  writeNode( rootConduitNode, filePathForRank, maxAsyncWrites );
 }
 
 
 void loadTree( std::string const & path )
 {
   GEOSX_MARK_FUNCTION;
-  std::string const filePathForRank = readRootNode( path );
-  GEOSX_LOG_RANK( "Reading in restart file at " << filePathForRank );
-  conduit::relay::io::load( filePathForRank, "hdf5", rootConduitNode );
+  BackgroundWriter::get().wait();
+  readRootNode( path );
+
+  int const rank = MpiWrapper::Comm_rank();
+  int const numRanks = MpiWrapper::Comm_size();
+  if( restartNumberOfRanks != numRanks )
+  {
+    GEOSX_LOG_RANK_0( "The restart was written by " << restartNumberOfRanks << " ranks and is read by " << numRanks <<
+                      " ranks, the mesh data will be redistributed." );
+  }
+
+  // When the number of ranks differs, the tree read here only provides the rank independent data,
+  // the mesh data is redistributed from all the trees after the mesh has been regenerated.
+  std::string const treePathForRank = rankTreePath( rank % restartNumberOfRanks );
+  GEOSX_LOG_RANK( "Reading in restart file at " << treePathForRank );
+  conduit::relay::io::load( treePathForRank, "hdf5", rootConduitNode );
+}
+
+
+int getRestartNumberOfRanks()
+{
+  return restartNumberOfRanks;
+}
+
+
+void loadRestartRankTree( int const writerRank, conduit::Node & node )
+{
+  GEOSX_MARK_FUNCTION;
+  GEOSX_ERROR_IF( writerRank < 0 || writerRank >= restartNumberOfRanks, "Invalid restart rank " << writerRank );
+  conduit::relay::io::load( rankTreePath( writerRank ), "hdf5", node );
 }
 
 } /* end namespace dataRepository */
@@ -88,12 +88,18 @@ using conduitTypeInfo = internal::conduitTypeInfo< std::remove_const_t< std::rem
 
 extern conduit::Node rootConduitNode;
 
-std::string writeRootFile( conduit::Node & root, std::string const & rootPath );
+void writeNode( conduit::Node const & node, std::string const & path, integer const maxAsyncWrites );
 
-void writeTree( std::string const & path );
+std::string writeRootFile( conduit::Node & root, std::string const & rootPath, integer const maxAsyncWrites = 0 );
+
+void writeTree( std::string const & path, int const ranksPerFile = 1, integer const maxAsyncWrites = 0 );
 
 void loadTree( std::string const & path );
 
+int getRestartNumberOfRanks();
+
+void loadRestartRankTree( int const writerRank, conduit::Node & node );
+
 } // namespace dataRepository
 } // namespace geosx
 
@@ -505,6 +505,15 @@ public:
 
   ///@}
 
+  /**
+   * @brief Get the Conduit node object associated with this wrapper.
+   * @return reference to inner conduit::Node member
+   */
+  conduit::Node & getConduitNode() const
+  {
+    return m_conduitNode;
+  }
+
 #if defined(USE_TOTALVIEW_OUTPUT)
   /**
    * @brief Virtual function to return the the typename for a Wrapper derived type that is
@@ -522,17 +531,6 @@ public:
 //  static int TV_ttf_display_type( const WrapperBase * wrapper);
 #endif
 
-protected:
-
-  /// @cond DO_NOT_DOCUMENT
-
-  conduit::Node & getConduitNode()
-  {
-    return m_conduitNode;
-  }
-
-  /// @endcond
-
 protected:
 
   /// Name of the object that is being wrapped
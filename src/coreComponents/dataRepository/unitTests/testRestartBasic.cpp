@@ -55,7 +55,7 @@ public:
     delete m_group;
   }
 
-  void test()
+  void test( int const ranksPerFile )
   {
     T value;
     fill( value, 100 );
@@ -65,7 +65,7 @@ public:
 
     // Write out the tree
     m_group->prepareToWrite();
-    writeTree( m_fileName );
+    writeTree( m_fileName, ranksPerFile );
     m_group->finishWriting();
 
     // Delete geosx tree and reset the conduit tree.
@@ -129,7 +129,12 @@ TYPED_TEST_SUITE( SingleWrapperTest, TestTypes, );
 
 TYPED_TEST( SingleWrapperTest, WriteAndRead )
 {
-  this->test();
+  this->test( 1 );
+}
+
+TYPED_TEST( SingleWrapperTest, WriteAndReadAggregated )
+{
+  this->test( 2 );
 }
 
 } // namespace testing
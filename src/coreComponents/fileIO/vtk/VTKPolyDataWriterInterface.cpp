@@ -14,6 +14,7 @@
 
 // Source includes
 #include "VTKPolyDataWriterInterface.hpp"
+#include "common/BackgroundWriter.hpp"
 #include "dataRepository/Group.hpp"
 
 // TPL includes
@@ -76,7 +77,8 @@ int ToVTKCellType( const string & elementType )
 VTKPolyDataWriterInterface::VTKPolyDataWriterInterface( string const & outputName ):
   m_outputFolder( outputName ),
   m_pvd( outputName + ".pvd" ),
-  m_previousCycle( -1 )
+  m_previousCycle( -1 ),
+  m_maxAsyncWrites( 0 )
 {
   int const mpiRank = MpiWrapper::Comm_rank( MPI_COMM_GEOSX );
   if( mpiRank == 0 )
@@ -494,7 +496,19 @@ void VTKPolyDataWriterInterface::WriteUnstructuredGrid( vtkSmartPointer< vtkUnst
   {
     vtuWriter->SetDataModeToAscii();
   }
-  vtuWriter->Write();
+
+  // The grid holds copies of the coordinates and the fields, it can be written while the simulation continues.
+  if( m_maxAsyncWrites > 0 )
+  {
+    BackgroundWriter::get().push( [vtuWriter]()
+    {
+      vtuWriter->Write();
+    }, m_maxAsyncWrites );
+  }
+  else
+  {
+    vtuWriter->Write();
+  }
 }
 
 string VTKPolyDataWriterInterface::GetTimeStepSubFolder( real64 time ) const
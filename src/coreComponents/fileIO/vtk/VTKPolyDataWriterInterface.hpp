@@ -77,6 +77,15 @@ public:
     m_outputMode = mode;
   }
 
+  /*!
+   * @brief Set the maximum number of unstructured grid files written in the background
+   * @param[in] maxAsyncWrites the maximum number of writes in flight, 0 to write synchronously
+   */
+  void SetMaxAsyncWrites( integer maxAsyncWrites )
+  {
+    m_maxAsyncWrites = maxAsyncWrites;
+  }
+
   /*!
    * @brief Main method of this class. Write all the files for one time step.
    * @details This method writes a .pvd file (if a previous one was created from a precedent time step,
@@ -285,6 +294,9 @@ private:
 
   /// Output mode, could be ASCII or BINARAY
   VTKOutputMode m_outputMode;
+
+  /// Maximum number of unstructured grid files written in the background
+  integer m_maxAsyncWrites;
 };
 
 } // namespace vtk
@@ -49,7 +49,10 @@ FiniteElementDiscretization::FiniteElementDiscretization( std::string const & na
     setDescription( "Specifier to indicate any specialized formuations. "
                     "For instance, one of the many enhanced assumed strain "
                     "methods of the Hexahedron parent shape would be indicated "
-                    "here" );
+                    "here. Options are:\n"
+                    "* default\n"
+                    "* UniformStrain - single integration point hexahedron with hourglass control, "
+                    "for explicit dynamics" );
 }
 
 FiniteElementDiscretization::~FiniteElementDiscretization()
@@ -59,7 +62,8 @@ FiniteElementDiscretization::~FiniteElementDiscretization()
 void FiniteElementDiscretization::PostProcessInput()
 {
   GEOSX_ERROR_IF( m_order!=1, "Higher order finite element spaces are currently not supported." );
-  GEOSX_ERROR_IF( m_formulation!="default", "Only standard element formulations are currently supported." );
+  GEOSX_ERROR_IF( m_formulation!="default" && m_formulation!="UniformStrain",
+                  "Only the default and UniformStrain element formulations are currently supported." );
 }
 
 std::unique_ptr< FiniteElementBase >
@@ -70,7 +74,14 @@ FiniteElementDiscretization::factory( string const & parentElementShape ) const
   {
     if( parentElementShape ==  finiteElement::ParentElementTypeStrings::Hexahedron )
     {
-      rval = std::make_unique< H1_Hexahedron_Lagrange1_GaussLegendre2 >();
+      if( m_formulation == "UniformStrain" )
+      {
+        rval = std::make_unique< H1_Hexahedron_Lagrange1_UniformStrain >();
+      }
+      else
+      {
+        rval = std::make_unique< H1_Hexahedron_Lagrange1_GaussLegendre2 >();
+      }
     }
     else if( parentElementShape == finiteElement::ParentElementTypeStrings::Tetrahedon )
     {
@@ -83,6 +83,15 @@ public:
   std::unique_ptr< finiteElement::FiniteElementBase >
   factory( string const & parentElementShape ) const;
 
+  /**
+   * @brief Check whether the hexahedra are integrated with the one-point uniform strain formulation.
+   * @return true if the formulation is UniformStrain
+   *
+   * The stiffness of these elements is rank-deficient without hourglass control, which is only
+   * available in the explicit solid mechanics kernels.
+   */
+  bool isUniformStrain() const { return m_formulation == "UniformStrain"; }
+
 private:
 
   struct viewKeyStruct
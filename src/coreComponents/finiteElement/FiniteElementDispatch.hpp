@@ -21,6 +21,7 @@
 
 
 #include "elementFormulations/H1_Hexahedron_Lagrange1_GaussLegendre2.hpp"
+#include "elementFormulations/H1_Hexahedron_Lagrange1_UniformStrain.hpp"
 #include "elementFormulations/H1_Pyramid_Lagrange1_Gauss5.hpp"
 #include "elementFormulations/H1_QuadrilateralFace_Lagrange1_GaussLegendre2.hpp"
 #include "elementFormulations/H1_Tetrahedron_Lagrange1_Gauss1.hpp"
@@ -68,6 +69,10 @@ dispatch3D( FiniteElementBase const & input,
   {
     lambda( *ptr4 );
   }
+  else if( auto const * const ptr5 = dynamic_cast< H1_Hexahedron_Lagrange1_UniformStrain const * >(&input) )
+  {
+    lambda( *ptr5 );
+  }
   else
   {
     GEOSX_ERROR( "finiteElement::dispatch3D() is not implemented for input of "<<typeid(input).name() );
@@ -96,6 +101,10 @@ dispatch3D( FiniteElementBase & input,
   {
     lambda( *ptr4 );
   }
+  else if( auto * const ptr5 = dynamic_cast< H1_Hexahedron_Lagrange1_UniformStrain * >(&input) )
+  {
+    lambda( *ptr5 );
+  }
   else
   {
     GEOSX_ERROR( "finiteElement::dispatch3D() is not implemented for input of "<<LvArray::system::demangleType( &input ) );
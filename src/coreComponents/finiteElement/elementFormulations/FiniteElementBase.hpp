@@ -79,6 +79,10 @@ public:
    */
   virtual ~FiniteElementBase() = default;
 
+  /// The number of hourglass modes that are not controlled by the quadrature
+  /// rule of the element. Reduced integration elements override this value.
+  constexpr static localIndex numHourglassModes = 0;
+
   /**
    * @brief Virtual getter for the number of quadrature points per element.
    * @return The number of quadrature points per element.
@@ -376,6 +380,47 @@ public:
                                          real64 ( &R )[NUM_SUPPORT_POINTS][3] );
 
 
+  /**
+   * @brief Add the hourglass control forces to the nodal forces of the
+   *   element.
+   * @tparam NUM_SUPPORT_POINTS The number of support points for the element.
+   * @tparam HOURGLASS_STATE_TYPE The type of the hourglass stiffness force
+   *   container.
+   * @param X Array containing the coordinates of the support points.
+   * @param vel Array containing the velocities of the support points.
+   * @param gradN The shape function derivatives.
+   * @param volume The volume of the element.
+   * @param dampingCoefficient The viscous hourglass control coefficient.
+   * @param stiffnessCoefficient The stiffness hourglass control coefficient.
+   * @param density The density of the material.
+   * @param modulus The P-wave modulus of the material.
+   * @param dt The time increment.
+   * @param hourglassStiffnessForce The generalized stiffness hourglass force.
+   * @param R The nodal forces to which the hourglass forces are added.
+   *
+   * Elements without hourglass modes have nothing to control, and this
+   * implementation does nothing. Reduced integration elements hide it with
+   * their own implementation.
+   */
+  template< int NUM_SUPPORT_POINTS,
+            typename HOURGLASS_STATE_TYPE >
+  GEOSX_HOST_DEVICE
+  static void addHourglassForce( real64 const (&X)[NUM_SUPPORT_POINTS][3],
+                                 real64 const (&vel)[NUM_SUPPORT_POINTS][3],
+                                 real64 const (&gradN)[NUM_SUPPORT_POINTS][3],
+                                 real64 const volume,
+                                 real64 const dampingCoefficient,
+                                 real64 const stiffnessCoefficient,
+                                 real64 const density,
+                                 real64 const modulus,
+                                 real64 const dt,
+                                 HOURGLASS_STATE_TYPE && hourglassStiffnessForce,
+                                 real64 ( &R )[NUM_SUPPORT_POINTS][3] )
+  {
+    GEOSX_UNUSED_VAR( X, vel, gradN, volume, dampingCoefficient, stiffnessCoefficient );
+    GEOSX_UNUSED_VAR( density, modulus, dt, hourglassStiffnessForce, R );
+  }
+
   /**
    * @brief Sets m_viewGradN equal to an input view.
    * @param source The view to assign to m_viewGradN.
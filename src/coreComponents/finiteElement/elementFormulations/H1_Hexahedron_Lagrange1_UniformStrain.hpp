@@ -0,0 +1,397 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file H1_Hexahedron_Lagrange1_UniformStrain.hpp
+ */
+
+#ifndef GEOSX_FINITEELEMENT_ELEMENTFORMULATIONS_H1HEXAHEDRONLAGRANGE1UNIFORMSTRAIN
+#define GEOSX_FINITEELEMENT_ELEMENTFORMULATIONS_H1HEXAHEDRONLAGRANGE1UNIFORMSTRAIN
+
+#include "FiniteElementBase.hpp"
+#include "LagrangeBasis1.hpp"
+
+
+namespace geosx
+{
+namespace finiteElement
+{
+
+/**
+ * This class contains the kernel accessible functions specific to the
+ * trilinear hexahedron with a single integration point, using the uniform
+ * strain (mean quadrature) formulation of Flanagan and Belytschko:
+ *
+ * D. P. Flanagan and T. Belytschko, "A uniform strain hexahedron and
+ * quadrilateral with orthogonal hourglass control", International Journal for
+ * Numerical Methods in Engineering, 17(5), 679-706, 1981.
+ *
+ * The shape function gradients are the volume averages of the trilinear shape
+ * function gradients over the element, and the quadrature weight is the exact
+ * volume of the element. The four hourglass modes that are not seen by the
+ * single integration point are controlled through addHourglassForce().
+ *
+ * The node numbering is the same as the one of
+ * H1_Hexahedron_Lagrange1_GaussLegendre2:
+ *
+ *                  6                   7                       ____________________
+ *                   o-----------------o                       |Node   xi0  xi1  xi2|
+ *                  /.                /|                       |=====  ===  ===  ===|
+ *                 / .               / |                       | 0     -1   -1   -1 |
+ *              4 o-----------------o 5|                       | 1      1   -1   -1 |
+ *                |  .              |  |                       | 2     -1    1   -1 |
+ *                |  .              |  |                       | 3      1    1   -1 |
+ *                |  .              |  |                       | 4     -1   -1    1 |
+ *                |  .              |  |                       | 5      1   -1    1 |
+ *                |2 o..............|..o 3       xi2           | 6     -1    1    1 |
+ *                | ,               | /          |             | 7      1    1    1 |
+ *                |,                |/           | / xi1       |____________________|
+ *                o-----------------o            |/
+ *               0                   1           ------ xi0
+ *
+ */
+class H1_Hexahedron_Lagrange1_UniformStrain final : public FiniteElementBase
+{
+public:
+  /// The number of nodes/support points per element.
+  constexpr static localIndex numNodes = LagrangeBasis1::TensorProduct3D::numSupportPoints;
+
+  /// The number of quadrature points per element.
+  constexpr static localIndex numQuadraturePoints = 1;
+
+  /// The number of hourglass modes of the element.
+  constexpr static localIndex numHourglassModes = 4;
+
+  virtual ~H1_Hexahedron_Lagrange1_UniformStrain() override
+  {}
+
+  virtual localIndex getNumQuadraturePoints() const override
+  {
+    return numQuadraturePoints;
+  }
+
+  virtual localIndex getNumSupportPoints() const override
+  {
+    return numNodes;
+  }
+
+  /**
+   * @brief Calculate shape functions values for each support point at a
+   *   quadrature point.
+   * @param q Index of the quadrature point.
+   * @param N An array to pass back the shape function values for each support
+   *   point.
+   */
+  GEOSX_HOST_DEVICE
+  static void calcN( localIndex const q,
+                     real64 ( &N )[numNodes] );
+
+  /**
+   * @brief Calculate the volume averaged shape functions derivatives wrt the
+   *   physical coordinates.
+   * @param q Index of the quadrature point.
+   * @param X Array containing the coordinates of the support points.
+   * @param gradN Array to contain the shape function derivatives for all
+   *   support points.
+   * @return The volume of the element.
+   */
+  GEOSX_HOST_DEVICE
+  static real64 calcGradN( localIndex const q,
+                           real64 const (&X)[numNodes][3],
+                           real64 ( &gradN )[numNodes][3] );
+
+  /**
+   * @brief Calculate the integration weights for a quadrature point.
+   * @param q Index of the quadrature point.
+   * @param X Array containing the coordinates of the support points.
+   * @return The volume of the element.
+   */
+  GEOSX_HOST_DEVICE
+  static real64 transformedQuadratureWeight( localIndex const q,
+                                             real64 const (&X)[numNodes][3] );
+
+  /**
+   * @brief Add the Flanagan-Belytschko hourglass control forces to the nodal
+   *   forces of the element.
+   * @tparam HOURGLASS_STATE_TYPE The type of the hourglass stiffness force
+   *   container, indexed as (mode, component).
+   * @param X Array containing the coordinates of the support points.
+   * @param vel Array containing the velocities of the support points.
+   * @param gradN The shape function derivatives returned by calcGradN().
+   * @param volume The volume of the element returned by calcGradN().
+   * @param dampingCoefficient The viscous hourglass control coefficient.
+   * @param stiffnessCoefficient The stiffness hourglass control coefficient.
+   * @param density The density of the material.
+   * @param modulus The P-wave modulus of the material.
+   * @param dt The time increment.
+   * @param hourglassStiffnessForce The generalized stiffness hourglass force,
+   *   which is incremented by this function.
+   * @param R The nodal forces to which the hourglass forces are added.
+   */
+  template< typename HOURGLASS_STATE_TYPE >
+  GEOSX_HOST_DEVICE
+  static void addHourglassForce( real64 const (&X)[numNodes][3],
+                                 real64 const (&vel)[numNodes][3],
+                                 real64 const (&gradN)[numNodes][3],
+                                 real64 const volume,
+                                 real64 const dampingCoefficient,
+                                 real64 const stiffnessCoefficient,
+                                 real64 const density,
+                                 real64 const modulus,
+                                 real64 const dt,
+                                 HOURGLASS_STATE_TYPE && hourglassStiffnessForce,
+                                 real64 ( &R )[numNodes][3] );
+
+private:
+
+  /**
+   * @brief Map from the counterclockwise node numbering used by Flanagan and
+   *   Belytschko to the node numbering of this element. The map is its own
+   *   inverse.
+   * @param a The node index.
+   * @return The mapped node index.
+   */
+  GEOSX_HOST_DEVICE
+  constexpr static localIndex counterClockwiseIndex( localIndex const a )
+  {
+    return ( a & 2 ) ? ( a ^ 1 ) : a;
+  }
+
+  /**
+   * @brief Value of an hourglass base vector at a support point.
+   * @param mode The hourglass mode, the base vectors are xi1*xi2, xi0*xi2,
+   *   xi0*xi1 and xi0*xi1*xi2.
+   * @param a The support point index.
+   * @return The value of the base vector of @p mode at @p a.
+   */
+  GEOSX_HOST_DEVICE
+  static real64 hourglassBaseVector( localIndex const mode,
+                                     localIndex const a );
+
+  /**
+   * @brief Calculate the integral of one component of the shape function
+   *   derivatives over the element, in the counterclockwise node numbering.
+   * @param y The coordinates of the support points in the first transverse
+   *   direction.
+   * @param z The coordinates of the support points in the second transverse
+   *   direction.
+   * @param b The integrals of the shape function derivatives.
+   */
+  GEOSX_HOST_DEVICE
+  static void integratedGradient( real64 const (&y)[numNodes],
+                                  real64 const (&z)[numNodes],
+                                  real64 ( &b )[numNodes] );
+};
+
+/// @cond Doxygen_Suppress
+
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+real64
+H1_Hexahedron_Lagrange1_UniformStrain::
+  hourglassBaseVector( localIndex const mode,
+                       localIndex const a )
+{
+  int ia, ib, ic;
+  LagrangeBasis1::TensorProduct3D::multiIndex( a, ia, ib, ic );
+  real64 const xi0 = LagrangeBasis1::parentSupportCoord( ia );
+  real64 const xi1 = LagrangeBasis1::parentSupportCoord( ib );
+  real64 const xi2 = LagrangeBasis1::parentSupportCoord( ic );
+
+  return mode == 0 ? xi1 * xi2 :
+         mode == 1 ? xi0 * xi2 :
+         mode == 2 ? xi0 * xi1 : xi0 * xi1 * xi2;
+}
+
+//*************************************************************************************************
+
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void
+H1_Hexahedron_Lagrange1_UniformStrain::
+  integratedGradient( real64 const (&y)[numNodes],
+                      real64 const (&z)[numNodes],
+                      real64 (& b)[numNodes] )
+{
+  constexpr real64 twelfth = 1.0 / 12.0;
+
+  b[0] = ( y[1]*((z[5]-z[2])-(z[3]-z[4])) + y[2]*(z[1]-z[3]) + y[3]*((z[2]-z[7])-(z[4]-z[1]))
+           + y[4]*((z[7]-z[5])-(z[1]-z[3])) + y[5]*(z[4]-z[1]) + y[7]*(z[3]-z[4]) ) * twelfth;
+
+  b[1] = ( y[2]*((z[6]-z[3])-(z[0]-z[5])) + y[3]*(z[2]-z[0]) + y[0]*((z[3]-z[4])-(z[5]-z[2]))
+           + y[5]*((z[4]-z[6])-(z[2]-z[0])) + y[6]*(z[5]-z[2]) + y[4]*(z[0]-z[5]) ) * twelfth;
+
+  b[2] = ( y[3]*((z[7]-z[0])-(z[1]-z[6])) + y[0]*(z[3]-z[1]) + y[1]*((z[0]-z[5])-(z[6]-z[3]))
+           + y[6]*((z[5]-z[7])-(z[3]-z[1])) + y[7]*(z[6]-z[3]) + y[5]*(z[1]-z[6]) ) * twelfth;
+
+  b[3] = ( y[0]*((z[4]-z[1])-(z[2]-z[7])) + y[1]*(z[0]-z[2]) + y[2]*((z[1]-z[6])-(z[7]-z[0]))
+           + y[7]*((z[6]-z[4])-(z[0]-z[2])) + y[4]*(z[7]-z[0]) + y[6]*(z[2]-z[7]) ) * twelfth;
+
+  b[4] = ( y[7]*((z[3]-z[6])-(z[5]-z[0])) + y[6]*(z[7]-z[5]) + y[5]*((z[6]-z[1])-(z[0]-z[7]))
+           + y[0]*((z[1]-z[3])-(z[7]-z[5])) + y[3]*(z[0]-z[7]) + y[1]*(z[5]-z[0]) ) * twelfth;
+
+  b[5] = ( y[4]*((z[0]-z[7])-(z[6]-z[1])) + y[7]*(z[4]-z[6]) + y[6]*((z[7]-z[2])-(z[1]-z[4]))
+           + y[1]*((z[2]-z[0])-(z[4]-z[6])) + y[0]*(z[1]-z[4]) + y[2]*(z[6]-z[1]) ) * twelfth;
+
+  b[6] = ( y[5]*((z[1]-z[4])-(z[7]-z[2])) + y[4]*(z[5]-z[7]) + y[7]*((z[4]-z[3])-(z[2]-z[5]))
+           + y[2]*((z[3]-z[1])-(z[5]-z[7])) + y[1]*(z[2]-z[5]) + y[3]*(z[7]-z[2]) ) * twelfth;
+
+  b[7] = ( y[6]*((z[2]-z[5])-(z[4]-z[3])) + y[5]*(z[6]-z[4]) + y[4]*((z[5]-z[0])-(z[3]-z[6]))
+           + y[3]*((z[0]-z[2])-(z[6]-z[4])) + y[2]*(z[3]-z[6]) + y[0]*(z[4]-z[3]) ) * twelfth;
+}
+
+//*************************************************************************************************
+
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void
+H1_Hexahedron_Lagrange1_UniformStrain::
+  calcN( localIndex const q,
+         real64 (& N)[numNodes] )
+{
+  GEOSX_UNUSED_VAR( q );
+
+  // single quadrature point at the center of the parent element
+  for( localIndex a = 0; a < numNodes; ++a )
+  {
+    N[a] = 0.125;
+  }
+}
+
+//*************************************************************************************************
+
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+real64
+H1_Hexahedron_Lagrange1_UniformStrain::
+  calcGradN( localIndex const q,
+             real64 const (&X)[numNodes][3],
+             real64 (& gradN)[numNodes][3] )
+{
+  GEOSX_UNUSED_VAR( q );
+
+  real64 x[numNodes], y[numNodes], z[numNodes];
+  for( localIndex a = 0; a < numNodes; ++a )
+  {
+    localIndex const nodeIndex = counterClockwiseIndex( a );
+    x[a] = X[nodeIndex][0];
+    y[a] = X[nodeIndex][1];
+    z[a] = X[nodeIndex][2];
+  }
+
+  real64 b[3][numNodes];
+  integratedGradient( y, z, b[0] );
+  integratedGradient( z, x, b[1] );
+  integratedGradient( x, y, b[2] );
+
+  real64 volume = 0.0;
+  for( localIndex a = 0; a < numNodes; ++a )
+  {
+    volume = volume + x[a] * b[0][a] + y[a] * b[1][a] + z[a] * b[2][a];
+  }
+  volume = volume / 3.0;
+
+  real64 const invVolume = 1.0 / volume;
+  for( localIndex a = 0; a < numNodes; ++a )
+  {
+    localIndex const nodeIndex = counterClockwiseIndex( a );
+    gradN[nodeIndex][0] = b[0][a] * invVolume;
+    gradN[nodeIndex][1] = b[1][a] * invVolume;
+    gradN[nodeIndex][2] = b[2][a] * invVolume;
+  }
+
+  return volume;
+}
+
+//*************************************************************************************************
+
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+real64
+H1_Hexahedron_Lagrange1_UniformStrain::
+  transformedQuadratureWeight( localIndex const q,
+                               real64 const (&X)[numNodes][3] )
+{
+  real64 gradN[numNodes][3];
+  return calcGradN( q, X, gradN );
+}
+
+//*************************************************************************************************
+
+template< typename HOURGLASS_STATE_TYPE >
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void
+H1_Hexahedron_Lagrange1_UniformStrain::
+  addHourglassForce( real64 const (&X)[numNodes][3],
+                     real64 const (&vel)[numNodes][3],
+                     real64 const (&gradN)[numNodes][3],
+                     real64 const volume,
+                     real64 const dampingCoefficient,
+                     real64 const stiffnessCoefficient,
+                     real64 const density,
+                     real64 const modulus,
+                     real64 const dt,
+                     HOURGLASS_STATE_TYPE && hourglassStiffnessForce,
+                     real64 (& R)[numNodes][3] )
+{
+  // 1/sqrt(8), normalization of the hourglass base vectors
+  constexpr real64 normalization = 0.353553390593273762;
+
+  real64 gradNSquared = 0.0;
+  for( localIndex a = 0; a < numNodes; ++a )
+  {
+    gradNSquared = gradNSquared + LvArray::tensorOps::l2NormSquared< 3 >( gradN[a] );
+  }
+
+  real64 const dampingFactor = dampingCoefficient * sqrt( density * modulus * gradNSquared / 6.0 ) * volume;
+  real64 const stiffnessFactor = stiffnessCoefficient * modulus * gradNSquared * volume / 3.0;
+
+  for( localIndex mode = 0; mode < numHourglassModes; ++mode )
+  {
+    // the hourglass shape vector is the base vector made orthogonal to the linear velocity field
+    real64 xGamma[3] = { 0.0, 0.0, 0.0 };
+    for( localIndex a = 0; a < numNodes; ++a )
+    {
+      LvArray::tensorOps::scaledAdd< 3 >( xGamma, X[a], hourglassBaseVector( mode, a ) );
+    }
+
+    real64 gamma[numNodes];
+    real64 qDot[3] = { 0.0, 0.0, 0.0 };
+    for( localIndex a = 0; a < numNodes; ++a )
+    {
+      gamma[a] = hourglassBaseVector( mode, a ) - LvArray::tensorOps::AiBi< 3 >( gradN[a], xGamma );
+      LvArray::tensorOps::scaledAdd< 3 >( qDot, vel[a], normalization * gamma[a] );
+    }
+
+    real64 Q[3];
+    for( int i = 0; i < 3; ++i )
+    {
+      hourglassStiffnessForce( mode, i ) += stiffnessFactor * dt * qDot[i];
+      Q[i] = normalization * ( dampingFactor * qDot[i] + hourglassStiffnessForce( mode, i ) );
+    }
+
+    for( localIndex a = 0; a < numNodes; ++a )
+    {
+      LvArray::tensorOps::scaledAdd< 3 >( R[a], Q, -gamma[a] );
+    }
+  }
+}
+
+/// @endcond
+
+}
+}
+
+#endif //GEOSX_FINITEELEMENT_ELEMENTFORMULATIONS_H1HEXAHEDRONLAGRANGE1UNIFORMSTRAIN
@@ -0,0 +1,199 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testH1_Hexahedron_Lagrange1_UniformStrain.cpp
+ */
+
+#include "finiteElement/elementFormulations/H1_Hexahedron_Lagrange1_GaussLegendre2.hpp"
+#include "finiteElement/elementFormulations/H1_Hexahedron_Lagrange1_UniformStrain.hpp"
+#include "managers/initialization.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace geosx;
+using namespace finiteElement;
+
+constexpr int numNodes = 8;
+
+/**
+ * @brief Coordinates of a distorted hexahedron.
+ * @param X The coordinates of the support points.
+ */
+GEOSX_HOST_DEVICE
+void distortedHexahedron( real64 (& X)[numNodes][3] )
+{
+  real64 const coords[numNodes][3] = {
+    { -1.0, -1.0, -1.0 },
+    {  1.2, -0.9, -1.1 },
+    { -0.8,  1.1, -1.0 },
+    {  1.1,  1.0, -0.9 },
+    { -1.1, -1.2,  0.9 },
+    {  0.9, -1.0,  1.0 },
+    { -1.0,  1.3,  1.1 },
+    {  1.0,  0.9,  1.2 }
+  };
+  LvArray::tensorOps::copy< numNodes, 3 >( X, coords );
+}
+
+template< typename POLICY >
+void testKernelDriver()
+{
+  array1d< real64 > arrVolume( 1 );
+  array1d< real64 > arrN( numNodes );
+  array2d< real64 > arrdNdX( numNodes, 3 );
+
+  arrayView1d< real64 > const & viewVolume = arrVolume;
+  arrayView1d< real64 > const & viewN = arrN;
+  arrayView2d< real64 > const & viewdNdX = arrdNdX;
+
+  forAll< POLICY >( 1,
+                    [=] GEOSX_HOST_DEVICE ( localIndex const )
+  {
+    real64 xCoords[numNodes][3];
+    distortedHexahedron( xCoords );
+
+    real64 N[numNodes] = {0};
+    H1_Hexahedron_Lagrange1_UniformStrain::calcN( 0, N );
+
+    real64 dNdX[numNodes][3] = {{0}};
+    viewVolume[0] = H1_Hexahedron_Lagrange1_UniformStrain::calcGradN( 0, xCoords, dNdX );
+
+    for( localIndex a=0; a<numNodes; ++a )
+    {
+      viewN[a] = N[a];
+      for( int i = 0; i < 3; ++i )
+      {
+        viewdNdX( a, i ) = dNdX[a][i];
+      }
+    }
+  } );
+
+  forAll< serialPolicy >( 1,
+                          [=] ( localIndex const )
+  {
+    real64 xCoords[numNodes][3];
+    distortedHexahedron( xCoords );
+
+    // The volume and the volume averaged shape function gradients are
+    // integrated exactly by the 2x2x2 Gauss-Legendre quadrature.
+    real64 volume = 0.0;
+    real64 meanGradN[numNodes][3] = {{0}};
+    for( localIndex q=0; q<H1_Hexahedron_Lagrange1_GaussLegendre2::numQuadraturePoints; ++q )
+    {
+      real64 dNdX[numNodes][3] = {{0}};
+      real64 const detJxW = H1_Hexahedron_Lagrange1_GaussLegendre2::calcGradN( q, xCoords, dNdX );
+      volume += detJxW;
+      LvArray::tensorOps::scaledAdd< numNodes, 3 >( meanGradN, dNdX, detJxW );
+    }
+
+    EXPECT_FLOAT_EQ( volume, viewVolume[0] );
+
+    for( localIndex a=0; a<numNodes; ++a )
+    {
+      EXPECT_FLOAT_EQ( 0.125, viewN[a] );
+      for( int i = 0; i < 3; ++i )
+      {
+        EXPECT_NEAR( meanGradN[a][i] / volume, viewdNdX[a][i], 1.0e-12 );
+      }
+    }
+  } );
+}
+
+TEST( FiniteElementShapeFunctions, testHourglassForce )
+{
+  real64 xCoords[numNodes][3];
+  distortedHexahedron( xCoords );
+
+  real64 dNdX[numNodes][3] = {{0}};
+  real64 const volume = H1_Hexahedron_Lagrange1_UniformStrain::calcGradN( 0, xCoords, dNdX );
+
+  // a linear velocity field does not excite the hourglass modes
+  real64 vel[numNodes][3];
+  for( localIndex a=0; a<numNodes; ++a )
+  {
+    vel[a][0] = 0.1 + 0.3 * xCoords[a][0] - 0.2 * xCoords[a][1] + 0.5 * xCoords[a][2];
+    vel[a][1] = -0.2 + 0.1 * xCoords[a][0] + 0.4 * xCoords[a][1] - 0.3 * xCoords[a][2];
+    vel[a][2] = 0.3 - 0.6 * xCoords[a][0] + 0.2 * xCoords[a][1] + 0.1 * xCoords[a][2];
+  }
+
+  array2d< real64 > hourglassStiffnessForce( H1_Hexahedron_Lagrange1_UniformStrain::numHourglassModes, 3 );
+  real64 R[numNodes][3] = {{0}};
+  H1_Hexahedron_Lagrange1_UniformStrain::addHourglassForce( xCoords, vel, dNdX, volume,
+                                                            0.1, 0.05, 2700.0, 1.0e10, 1.0e-6,
+                                                            hourglassStiffnessForce.toView(), R );
+
+  for( localIndex a=0; a<numNodes; ++a )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      EXPECT_NEAR( 0.0, R[a][i], 1.0e-6 );
+    }
+  }
+
+  // an hourglass velocity field is resisted, without any net force
+  for( localIndex a=0; a<numNodes; ++a )
+  {
+    vel[a][0] = ( ( a & 1 ) ? 1.0 : -1.0 ) * ( ( a & 2 ) ? 1.0 : -1.0 );
+    vel[a][1] = 0.0;
+    vel[a][2] = 0.0;
+  }
+
+  LvArray::tensorOps::fill< numNodes, 3 >( R, 0.0 );
+  H1_Hexahedron_Lagrange1_UniformStrain::addHourglassForce( xCoords, vel, dNdX, volume,
+                                                            0.1, 0.05, 2700.0, 1.0e10, 1.0e-6,
+                                                            hourglassStiffnessForce.toView(), R );
+
+  real64 power = 0.0;
+  real64 netForce[3] = { 0.0, 0.0, 0.0 };
+  for( localIndex a=0; a<numNodes; ++a )
+  {
+    power += LvArray::tensorOps::AiBi< 3 >( R[a], vel[a] );
+    LvArray::tensorOps::add< 3 >( netForce, R[a] );
+  }
+
+  EXPECT_LT( power, 0.0 );
+  for( int i = 0; i < 3; ++i )
+  {
+    EXPECT_NEAR( 0.0, netForce[i], 1.0e-6 * std::abs( power ) );
+  }
+}
+
+#ifdef USE_CUDA
+TEST( FiniteElementShapeFunctions, testKernelCuda )
+{
+  testKernelDriver< geosx::parallelDevicePolicy< 32 > >();
+}
+#endif
+TEST( FiniteElementShapeFunctions, testKernelHost )
+{
+  testKernelDriver< serialPolicy >();
+}
+
+
+
+using namespace geosx;
+int main( int argc, char * argv[] )
+{
+  testing::InitGoogleTest();
+
+  basicSetup( argc, argv, false );
+
+  int const result = RUN_ALL_TESTS();
+
+  basicCleanup();
+
+  return result;
+}
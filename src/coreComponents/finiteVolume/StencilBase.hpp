@@ -21,6 +21,8 @@
 
 #include "common/DataTypes.hpp"
 #include "codingUtilities/Utilities.hpp"
+#include "linearAlgebra/utilities/BlockRowAssembly.hpp"
+#include "mesh/ElementRegionManager.hpp"
 
 namespace geosx
 {
@@ -40,7 +42,9 @@ public:
     m_elementSubRegionIndices(),
     m_elementIndices(),
     m_weights(),
-    m_connectorIndices()
+    m_connectorIndices(),
+    m_assemblyMap(),
+    m_assemblyMapKey()
   {}
 
   /**
@@ -135,6 +139,42 @@ public:
    */
   typename LEAFCLASSTRAITS::WeightContainerViewConstType getWeights() const { return m_weights.toViewConst(); }
 
+  /**
+   * @brief Compute the positions of the stencil connections in the rows of a local matrix.
+   * @param[in] key the name of the linear system the map is computed for
+   * @param[in] dofNumber the global index of the first degree of freedom of each element
+   * @param[in] numDofPerElement the number of degrees of freedom of each element
+   * @param[in] rankOffset the global index of the first local row of the matrix
+   * @param[in] localMatrix the local matrix, with its final sparsity pattern
+   *
+   * For each stencil entry, each flux point i and each stencil point j, the map gives the position
+   * of the first degree of freedom of j in the row of the first degree of freedom of i. The degrees
+   * of freedom of an element are numbered consecutively and all the rows of an element have the same
+   * columns, so that this position gives access to the whole block of the element pair, and kernels
+   * can add their contributions without searching the columns. The position is -1 if the row is not
+   * locally owned or does not contain the column. The map stays valid until the stencil or the
+   * sparsity pattern change, and must be recomputed after each setup of the linear system.
+   */
+  void computeAssemblyMap( string const & key,
+                           ElementRegionManager::ElementViewConst< arrayView1d< globalIndex const > > const & dofNumber,
+                           localIndex const numDofPerElement,
+                           globalIndex const rankOffset,
+                           CRSMatrixView< real64 const, globalIndex const > const & localMatrix );
+
+  /**
+   * @brief Check if an up-to-date assembly map is available for a linear system.
+   * @param[in] key the name of the linear system
+   * @return true if the last assembly map was computed for @p key and matches the current stencil size
+   */
+  bool hasAssemblyMap( string const & key ) const
+  { return !m_assemblyMapKey.empty() && m_assemblyMapKey == key && m_assemblyMap.size( 0 ) == size(); }
+
+  /**
+   * @brief Const access to the assembly map.
+   * @return A view to const, of size (stencil entries, NUM_POINT_IN_FLUX, MAX_STENCIL_SIZE)
+   */
+  arrayView3d< localIndex const > getAssemblyMap() const { return m_assemblyMap.toViewConst(); }
+
 protected:
   /// The container for the element region indices for each point in each stencil
   typename LEAFCLASSTRAITS::IndexContainerType m_elementRegionIndices;
@@ -151,6 +191,12 @@ protected:
   /// The map that provides the stencil index given the index of the underlying connector object.
   map< localIndex, localIndex > m_connectorIndices;
 
+  /// The positions of the stencil points in the rows of the local matrix (see computeAssemblyMap)
+  array3d< localIndex > m_assemblyMap;
+
+  /// The name of the linear system the assembly map was computed for
+  string m_assemblyMapKey;
+
 };
 
 
@@ -185,6 +231,7 @@ void StencilBase< LEAFCLASSTRAITS, LEAFCLASS >::setName( string const & name )
   m_elementSubRegionIndices.setName( name + "/elementSubRegionIndices" );
   m_elementIndices.setName( name + "/elementIndices" );
   m_weights.setName( name + "/weights" );
+  m_assemblyMap.setName( name + "/assemblyMap" );
 }
 
 template< typename LEAFCLASSTRAITS, typename LEAFCLASS >
@@ -194,6 +241,59 @@ void StencilBase< LEAFCLASSTRAITS, LEAFCLASS >::move( LvArray::MemorySpace const
   m_elementSubRegionIndices.move( space, true );
   m_elementIndices.move( space, true );
   m_weights.move( space, true );
+  m_assemblyMap.move( space, true );
+}
+
+template< typename LEAFCLASSTRAITS, typename LEAFCLASS >
+void StencilBase< LEAFCLASSTRAITS, LEAFCLASS >::computeAssemblyMap( string const & key,
+                                                                    ElementRegionManager::ElementViewConst< arrayView1d< globalIndex const > > const & dofNumber,
+                                                                    localIndex const numDofPerElement,
+                                                                    globalIndex const rankOffset,
+                                                                    CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  LEAFCLASS const & stencil = static_cast< LEAFCLASS const & >( *this );
+  localIndex const numEntries = size();
+  localIndex const maxNumFluxElems = LEAFCLASSTRAITS::NUM_POINT_IN_FLUX;
+  localIndex const maxStencilSize = LEAFCLASSTRAITS::MAX_STENCIL_SIZE;
+
+  m_assemblyMap.move( LvArray::MemorySpace::CPU, true );
+  m_assemblyMap.resize( numEntries, maxNumFluxElems, maxStencilSize );
+  m_assemblyMap.template setValues< serialPolicy >( -1 );
+
+  typename LEAFCLASSTRAITS::IndexContainerViewConstType const & seri = m_elementRegionIndices.toViewConst();
+  typename LEAFCLASSTRAITS::IndexContainerViewConstType const & sesri = m_elementSubRegionIndices.toViewConst();
+  typename LEAFCLASSTRAITS::IndexContainerViewConstType const & sei = m_elementIndices.toViewConst();
+  arrayView3d< localIndex > const & assemblyMap = m_assemblyMap;
+
+  forAll< parallelHostPolicy >( numEntries, [=, &stencil]( localIndex const iconn )
+  {
+    localIndex const stencilSize = stencil.stencilSize( iconn );
+    localIndex const numFluxElems = stencilSize < maxNumFluxElems ? stencilSize : maxNumFluxElems;
+
+    for( localIndex i = 0; i < numFluxElems; ++i )
+    {
+      globalIndex const globalRow = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
+      localIndex const localRow = LvArray::integerConversion< localIndex >( globalRow - rankOffset );
+      if( localRow < 0 || localRow >= localMatrix.numRows() )
+      {
+        continue;
+      }
+
+      globalIndex const * const columns = localMatrix.getColumns( localRow ).dataIfContiguous();
+      localIndex const rowLength = localMatrix.numNonZeros( localRow );
+      for( localIndex j = 0; j < stencilSize; ++j )
+      {
+        globalIndex const col = dofNumber[seri( iconn, j )][sesri( iconn, j )][sei( iconn, j )];
+        localIndex const pos = findColumnPosition( columns, rowLength, col );
+        GEOSX_ERROR_IF( pos >= 0 && ( pos + numDofPerElement > rowLength ||
+                                      columns[pos + numDofPerElement - 1] != col + numDofPerElement - 1 ),
+                        "The degrees of freedom of element " << sei( iconn, j ) << " are not contiguous in row " << localRow );
+        assemblyMap( iconn, i, j ) = pos;
+      }
+    }
+  } );
+
+  m_assemblyMapKey = key;
 }
 
 
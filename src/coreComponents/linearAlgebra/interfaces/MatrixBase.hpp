@@ -21,6 +21,8 @@
 
 #include "linearAlgebra/common.hpp"
 #include "linearAlgebra/interfaces/LinearOperator.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
 //#include "LvArray/src/streamIO.hpp"
 
 namespace geosx
@@ -68,7 +70,8 @@ protected:
    */
   MatrixBase()
     : m_closed( true ),
-    m_assembled( false )
+    m_assembled( false ),
+    m_structureVersion( 0 )
   {}
 
   /**
@@ -139,6 +142,14 @@ protected:
    */
   inline bool insertable() const { return !closed() && !assembled(); }
 
+  /**
+   * @brief Query the version of the matrix storage
+   * @return a counter incremented every time the underlying matrix object is reset or re-created;
+   *         an unchanged version guarantees that objects referring to the storage (such as
+   *         preconditioners) are still valid and that the sparsity pattern is unchanged
+   */
+  inline integer structureVersion() const { return m_structureVersion; }
+
   /**
    * @brief Query matrix creation status
    * @return @p true if matrix has been created
@@ -220,7 +231,10 @@ protected:
    * @param comm The MPI communicator to use.
    *
    * @note Copies values, so that @p localMatrix does not need to retain its values after the call.
-   * @todo Replace generic implementation with more efficient ones in each package.
+   *
+   * The generic implementation inserts the rows one by one. Implementations may instead build
+   * the matrix from the whole sparsity pattern and, when called again with a local matrix having
+   * the same sparsity pattern, only copy the values (see copyLocalMatrixValues()).
    */
   virtual void create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
                        MPI_Comm const & comm )
@@ -278,6 +292,7 @@ protected:
   {
     m_assembled = false;
     m_closed = true;
+    ++m_structureVersion;
   }
 
   ///@}
@@ -937,12 +952,158 @@ protected:
     return os;
   }
 
+  /**
+   * @name Local matrix structure caching
+   *
+   * Helpers for the implementations of create() that only copy the values of a local
+   * matrix when its sparsity pattern is the one of the previous call. The derived classes
+   * also expose hasLocalMatrixStructure(), so that the users of a matrix can tell in advance
+   * whether create() keeps its storage.
+   */
+  ///@{
+
+  /**
+   * @brief Check whether a local matrix has the sparsity pattern recorded by setLocalMatrixStructure().
+   * @param localMatrix the local matrix
+   * @param comm the MPI communicator of the matrix
+   * @return @p true if the values of @p localMatrix can be copied without recreating the matrix on all ranks
+   */
+  bool hasLocalMatrixStructure( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                                MPI_Comm const & comm ) const
+  {
+    int sameStructure = ready() && m_localRowOffsets.size() == localMatrix.numRows() + 1;
+    if( sameStructure )
+    {
+      arrayView1d< localIndex const > const rowOffsets = m_localRowOffsets;
+      arrayView1d< globalIndex const > const columns = m_localColumns;
+
+      RAJA::ReduceMin< parallelHostReduce, int > rowsMatch( 1 );
+      forAll< parallelHostPolicy >( localMatrix.numRows(), [=] ( localIndex const localRow )
+      {
+        arraySlice1d< globalIndex const > const rowColumns = localMatrix.getColumns( localRow );
+        if( rowColumns.size() != rowOffsets[localRow + 1] - rowOffsets[localRow] )
+        {
+          rowsMatch.min( 0 );
+          return;
+        }
+        for( localIndex k = 0; k < rowColumns.size(); ++k )
+        {
+          if( rowColumns[k] != columns[rowOffsets[localRow] + k] )
+          {
+            rowsMatch.min( 0 );
+            return;
+          }
+        }
+      } );
+      sameStructure = rowsMatch.get();
+    }
+
+    // All ranks must take the same path since recreating the matrix is collective
+    return MpiWrapper::Min( sameStructure, comm ) == 1;
+  }
+
+  /**
+   * @brief Record the sparsity pattern of a local matrix and the storage position of its entries.
+   * @tparam LAMBDA type of the position function
+   * @param localMatrix the local matrix the parallel matrix has just been created from
+   * @param position function returning, for a local row and a global column index, the position of
+   *                 the entry in the storage of the parallel matrix (see copyLocalMatrixValues())
+   */
+  template< typename LAMBDA >
+  void setLocalMatrixStructure( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                                LAMBDA && position )
+  {
+    localIndex const numRows = localMatrix.numRows();
+    m_localRowOffsets.resize( numRows + 1 );
+    m_localRowOffsets[0] = 0;
+    for( localIndex localRow = 0; localRow < numRows; ++localRow )
+    {
+      m_localRowOffsets[localRow + 1] = m_localRowOffsets[localRow] + localMatrix.numNonZeros( localRow );
+    }
+
+    m_localColumns.resize( m_localRowOffsets[numRows] );
+    m_localValuePositions.resize( m_localRowOffsets[numRows] );
+    for( localIndex localRow = 0; localRow < numRows; ++localRow )
+    {
+      arraySlice1d< globalIndex const > const rowColumns = localMatrix.getColumns( localRow );
+      for( localIndex k = 0; k < rowColumns.size(); ++k )
+      {
+        localIndex const pos = position( localRow, rowColumns[k] );
+        GEOSX_LAI_ASSERT_MSG( pos >= 0, "Entry (" << localRow << ", " << rowColumns[k] << ") not found in the matrix" );
+        m_localColumns[m_localRowOffsets[localRow] + k] = rowColumns[k];
+        m_localValuePositions[m_localRowOffsets[localRow] + k] = pos;
+      }
+    }
+  }
+
+  /**
+   * @brief Forget the sparsity pattern recorded by setLocalMatrixStructure().
+   */
+  void clearLocalMatrixStructure()
+  {
+    m_localRowOffsets.clear();
+    m_localColumns.clear();
+    m_localValuePositions.clear();
+  }
+
+  /**
+   * @brief Copy the values of a local matrix into the storage of the parallel matrix.
+   * @param localMatrix the local matrix, with the sparsity pattern recorded by setLocalMatrixStructure()
+   * @param values the storage of the entries at positions lower than @p numValues
+   * @param numValues the size of @p values
+   * @param otherValues the storage of the entries at positions greater or equal to @p numValues
+   *
+   * The storage of the parallel matrix may be split in two arrays, as for matrices storing
+   * the off-processor columns in a separate block; the position of an entry in @p otherValues
+   * is then offset by @p numValues.
+   */
+  void copyLocalMatrixValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                              real64 * const values,
+                              localIndex const numValues,
+                              real64 * const otherValues ) const
+  {
+    arrayView1d< localIndex const > const rowOffsets = m_localRowOffsets;
+    arrayView1d< localIndex const > const positions = m_localValuePositions;
+
+    forAll< parallelHostPolicy >( localMatrix.numRows(), [=] ( localIndex const localRow )
+    {
+      arraySlice1d< real64 const > const rowValues = localMatrix.getEntries( localRow );
+      localIndex const offset = rowOffsets[localRow];
+      for( localIndex k = 0; k < rowValues.size(); ++k )
+      {
+        localIndex const pos = positions[offset + k];
+        if( pos < numValues )
+        {
+          values[pos] = rowValues[k];
+        }
+        else
+        {
+          otherValues[pos - numValues] = rowValues[k];
+        }
+      }
+    } );
+  }
+
+  ///@}
+
   /// Flag indicating whether the matrix is currently open for adding new entries
   bool m_closed;
 
   /// Flag indicating whether the matrix (sparsity pattern) has been assembled
   bool m_assembled;
 
+  /// Counter of the resets of the matrix storage
+  integer m_structureVersion;
+
+  /// Offsets of the rows in @p m_localColumns and @p m_localValuePositions
+  array1d< localIndex > m_localRowOffsets;
+
+  /// Column indices of the local matrix the parallel matrix was last created from
+  array1d< globalIndex > m_localColumns;
+
+  /// Position of the entries of the local matrix in the storage of the parallel matrix
+  array1d< localIndex > m_localValuePositions;
+
 };
 
 } // namespace geosx
@@ -204,6 +204,112 @@ void HypreMatrix::createWithLocalSize( localIndex const localRows,
               m_ij_mat );
 }
 
+void HypreMatrix::create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                          MPI_Comm const & comm )
+{
+  localMatrix.move( LvArray::MemorySpace::CPU, false );
+
+  // Same sparsity pattern as the previous call: only copy the values in the diagonal and off-diagonal blocks
+  if( hasLocalMatrixStructure( localMatrix, comm ) )
+  {
+    hypre_CSRMatrix * const prt_diag_CSR = hypre_ParCSRMatrixDiag( m_parcsr_mat );
+    hypre_CSRMatrix * const prt_offdiag_CSR = hypre_ParCSRMatrixOffd( m_parcsr_mat );
+    copyLocalMatrixValues( localMatrix,
+                           hypre_CSRMatrixData( prt_diag_CSR ),
+                           hypre_CSRMatrixNumNonzeros( prt_diag_CSR ),
+                           hypre_CSRMatrixData( prt_offdiag_CSR ) );
+    return;
+  }
+
+  reset();
+
+  HYPRE_Int const nrows = LvArray::integerConversion< HYPRE_Int >( localMatrix.numRows() );
+  HYPRE_BigInt const ilower = MpiWrapper::PrefixSum< HYPRE_BigInt >( nrows );
+  HYPRE_BigInt const iupper = ilower + nrows - 1;
+
+  // Gather the sparsity pattern and values in contiguous arrays, and count the entries of each block
+  array1d< HYPRE_BigInt > rows( nrows );
+  array1d< HYPRE_Int > row_sizes( nrows );
+  array1d< HYPRE_Int > diag_sizes( nrows );
+  array1d< HYPRE_Int > offdiag_sizes( nrows );
+  array1d< HYPRE_BigInt > cols;
+  array1d< HYPRE_Real > values;
+  cols.reserve( localMatrix.numNonZeros() );
+  values.reserve( localMatrix.numNonZeros() );
+
+  for( HYPRE_Int i = 0; i < nrows; ++i )
+  {
+    arraySlice1d< globalIndex const > const rowColumns = localMatrix.getColumns( i );
+    arraySlice1d< real64 const > const rowValues = localMatrix.getEntries( i );
+    rows[i] = ilower + i;
+    row_sizes[i] = LvArray::integerConversion< HYPRE_Int >( rowColumns.size() );
+    for( localIndex k = 0; k < rowColumns.size(); ++k )
+    {
+      if( rowColumns[k] >= ilower && rowColumns[k] <= iupper )
+      {
+        ++diag_sizes[i];
+      }
+      else
+      {
+        ++offdiag_sizes[i];
+      }
+      cols.emplace_back( rowColumns[k] );
+      values.emplace_back( rowValues[k] );
+    }
+  }
+
+  GEOSX_LAI_CHECK_ERROR( HYPRE_IJMatrixCreate( comm, ilower, iupper, ilower, iupper, &m_ij_mat ) );
+  GEOSX_LAI_CHECK_ERROR( HYPRE_IJMatrixSetObjectType( m_ij_mat, HYPRE_PARCSR ) );
+  GEOSX_LAI_CHECK_ERROR( HYPRE_IJMatrixSetDiagOffdSizes( m_ij_mat, diag_sizes.data(), offdiag_sizes.data() ) );
+  GEOSX_LAI_CHECK_ERROR( HYPRE_IJMatrixInitialize( m_ij_mat ) );
+
+  open();
+  GEOSX_LAI_CHECK_ERROR( HYPRE_IJMatrixSetValues( m_ij_mat,
+                                                  nrows,
+                                                  row_sizes.data(),
+                                                  rows.data(),
+                                                  cols.data(),
+                                                  values.data() ) );
+  close();
+
+  // Record where each entry of the local matrix is stored in the diagonal and off-diagonal blocks
+  hypre_CSRMatrix const * const prt_diag_CSR = hypre_ParCSRMatrixDiag( m_parcsr_mat );
+  HYPRE_Int const * const diag_IA = hypre_CSRMatrixI( prt_diag_CSR );
+  HYPRE_Int const * const diag_JA = hypre_CSRMatrixJ( prt_diag_CSR );
+  localIndex const diag_nnz = hypre_CSRMatrixNumNonzeros( prt_diag_CSR );
+
+  hypre_CSRMatrix const * const prt_offdiag_CSR = hypre_ParCSRMatrixOffd( m_parcsr_mat );
+  HYPRE_Int const * const offdiag_IA = hypre_CSRMatrixI( prt_offdiag_CSR );
+  HYPRE_Int const * const offdiag_JA = hypre_CSRMatrixJ( prt_offdiag_CSR );
+  HYPRE_BigInt const * const col_map_offdiag = hypre_ParCSRMatrixColMapOffd( m_parcsr_mat );
+
+  setLocalMatrixStructure( localMatrix, [&]( localIndex const localRow, globalIndex const col ) -> localIndex
+  {
+    if( col >= ilower && col <= iupper )
+    {
+      HYPRE_Int const localCol = LvArray::integerConversion< HYPRE_Int >( col - ilower );
+      for( HYPRE_Int k = diag_IA[localRow]; k < diag_IA[localRow + 1]; ++k )
+      {
+        if( diag_JA[k] == localCol )
+        {
+          return k;
+        }
+      }
+    }
+    else
+    {
+      for( HYPRE_Int k = offdiag_IA[localRow]; k < offdiag_IA[localRow + 1]; ++k )
+      {
+        if( col_map_offdiag[offdiag_JA[k]] == col )
+        {
+          return diag_nnz + k;
+        }
+      }
+    }
+    return -1;
+  } );
+}
+
 void HypreMatrix::set( real64 const value )
 {
   GEOSX_LAI_ASSERT( ready() );
@@ -215,6 +321,7 @@ void HypreMatrix::set( real64 const value )
 void HypreMatrix::reset()
 {
   MatrixBase::reset();
+  clearLocalMatrixStructure();
   if( m_ij_mat )
   {
     GEOSX_LAI_CHECK_ERROR( HYPRE_IJMatrixDestroy( m_ij_mat ) );
@@ -234,6 +341,7 @@ void HypreMatrix::zero()
 void HypreMatrix::open()
 {
   GEOSX_LAI_ASSERT( created() && closed() );
+  clearLocalMatrixStructure();
   if( m_assembled )
   {
     GEOSX_LAI_CHECK_ERROR( HYPRE_IJMatrixInitialize( m_ij_mat ) );
@@ -93,6 +93,111 @@ void PetscMatrix::createWithGlobalSize( globalIndex const globalRows,
   GEOSX_LAI_CHECK_ERROR( MatSetOption( m_mat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE ) );
 }
 
+void PetscMatrix::create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                          MPI_Comm const & comm )
+{
+  localMatrix.move( LvArray::MemorySpace::CPU, false );
+
+  Mat localDiag;
+  Mat localOffDiag;
+  PetscInt const * colMap;
+  PetscInt numDiagRows;
+  PetscInt const * diagRowOffsets;
+  PetscInt const * diagColumns;
+  PetscInt numOffDiagRows;
+  PetscInt const * offDiagRowOffsets;
+  PetscInt const * offDiagColumns;
+  PetscBool done;
+
+  // Same sparsity pattern as the previous call: only copy the values in the diagonal and off-diagonal blocks
+  if( hasLocalMatrixStructure( localMatrix, comm ) )
+  {
+    GEOSX_LAI_CHECK_ERROR( MatMPIAIJGetSeqAIJ( m_mat, &localDiag, &localOffDiag, &colMap ) );
+    GEOSX_LAI_CHECK_ERROR( MatGetRowIJ( localDiag, 0, PETSC_FALSE, PETSC_FALSE, &numDiagRows, &diagRowOffsets, &diagColumns, &done ) );
+    localIndex const numDiagValues = diagRowOffsets[numDiagRows];
+    GEOSX_LAI_CHECK_ERROR( MatRestoreRowIJ( localDiag, 0, PETSC_FALSE, PETSC_FALSE, &numDiagRows, &diagRowOffsets, &diagColumns, &done ) );
+
+    PetscScalar * diagValues;
+    PetscScalar * offDiagValues;
+    GEOSX_LAI_CHECK_ERROR( MatSeqAIJGetArray( localDiag, &diagValues ) );
+    GEOSX_LAI_CHECK_ERROR( MatSeqAIJGetArray( localOffDiag, &offDiagValues ) );
+    copyLocalMatrixValues( localMatrix, diagValues, numDiagValues, offDiagValues );
+    GEOSX_LAI_CHECK_ERROR( MatSeqAIJRestoreArray( localOffDiag, &offDiagValues ) );
+    GEOSX_LAI_CHECK_ERROR( MatSeqAIJRestoreArray( localDiag, &diagValues ) );
+
+    // The blocks have been modified directly, let PETSc know that the parallel matrix has changed
+    GEOSX_LAI_CHECK_ERROR( PetscObjectStateIncrease( reinterpret_cast< PetscObject >( m_mat ) ) );
+    return;
+  }
+
+  reset();
+
+  // Gather the sparsity pattern and values in contiguous arrays
+  localIndex const numRows = localMatrix.numRows();
+  array1d< PetscInt > rowOffsets( numRows + 1 );
+  array1d< PetscInt > columns;
+  array1d< PetscScalar > values;
+  columns.reserve( localMatrix.numNonZeros() );
+  values.reserve( localMatrix.numNonZeros() );
+
+  for( localIndex i = 0; i < numRows; ++i )
+  {
+    arraySlice1d< globalIndex const > const rowColumns = localMatrix.getColumns( i );
+    arraySlice1d< real64 const > const rowValues = localMatrix.getEntries( i );
+    for( localIndex k = 0; k < rowColumns.size(); ++k )
+    {
+      columns.emplace_back( rowColumns[k] );
+      values.emplace_back( rowValues[k] );
+    }
+    rowOffsets[i + 1] = columns.size();
+  }
+
+  // Preallocation from the exact sparsity pattern also inserts the values and assembles the matrix
+  GEOSX_LAI_CHECK_ERROR( MatCreate( comm, &m_mat ) );
+  GEOSX_LAI_CHECK_ERROR( MatSetType( m_mat, MATMPIAIJ ) );
+  GEOSX_LAI_CHECK_ERROR( MatSetSizes( m_mat, numRows, numRows, PETSC_DETERMINE, PETSC_DETERMINE ) );
+  GEOSX_LAI_CHECK_ERROR( MatMPIAIJSetPreallocationCSR( m_mat, rowOffsets.data(), columns.data(), values.data() ) );
+  GEOSX_LAI_CHECK_ERROR( MatSetOption( m_mat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE ) );
+  m_assembled = true;
+
+  // Record where each entry of the local matrix is stored in the diagonal and off-diagonal blocks
+  PetscInt firstCol;
+  PetscInt lastCol;
+  GEOSX_LAI_CHECK_ERROR( MatGetOwnershipRangeColumn( m_mat, &firstCol, &lastCol ) );
+  GEOSX_LAI_CHECK_ERROR( MatMPIAIJGetSeqAIJ( m_mat, &localDiag, &localOffDiag, &colMap ) );
+  GEOSX_LAI_CHECK_ERROR( MatGetRowIJ( localDiag, 0, PETSC_FALSE, PETSC_FALSE, &numDiagRows, &diagRowOffsets, &diagColumns, &done ) );
+  GEOSX_LAI_CHECK_ERROR( MatGetRowIJ( localOffDiag, 0, PETSC_FALSE, PETSC_FALSE, &numOffDiagRows, &offDiagRowOffsets, &offDiagColumns, &done ) );
+  localIndex const numDiagValues = diagRowOffsets[numDiagRows];
+
+  setLocalMatrixStructure( localMatrix, [&]( localIndex const localRow, globalIndex const col ) -> localIndex
+  {
+    if( col >= firstCol && col < lastCol )
+    {
+      for( PetscInt k = diagRowOffsets[localRow]; k < diagRowOffsets[localRow + 1]; ++k )
+      {
+        if( diagColumns[k] + firstCol == col )
+        {
+          return k;
+        }
+      }
+    }
+    else
+    {
+      for( PetscInt k = offDiagRowOffsets[localRow]; k < offDiagRowOffsets[localRow + 1]; ++k )
+      {
+        if( colMap[offDiagColumns[k]] == col )
+        {
+          return numDiagValues + k;
+        }
+      }
+    }
+    return -1;
+  } );
+
+  GEOSX_LAI_CHECK_ERROR( MatRestoreRowIJ( localOffDiag, 0, PETSC_FALSE, PETSC_FALSE, &numOffDiagRows, &offDiagRowOffsets, &offDiagColumns, &done ) );
+  GEOSX_LAI_CHECK_ERROR( MatRestoreRowIJ( localDiag, 0, PETSC_FALSE, PETSC_FALSE, &numDiagRows, &diagRowOffsets, &diagColumns, &done ) );
+}
+
 bool PetscMatrix::created() const
 {
   return m_mat != nullptr;
@@ -101,6 +206,7 @@ bool PetscMatrix::created() const
 void PetscMatrix::reset()
 {
   MatrixBase::reset();
+  clearLocalMatrixStructure();
   GEOSX_LAI_CHECK_ERROR( MatDestroy( &m_mat ) );
 }
 
@@ -172,6 +278,7 @@ void PetscMatrix::zero()
 void PetscMatrix::open()
 {
   GEOSX_LAI_ASSERT( created() && closed() );
+  clearLocalMatrixStructure();
   m_closed = false;
 }
 
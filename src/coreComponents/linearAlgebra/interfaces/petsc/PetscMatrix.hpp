@@ -91,6 +91,8 @@ public:
   using MatrixBase::insertable;
   using MatrixBase::modifiable;
   using MatrixBase::ready;
+  using MatrixBase::structureVersion;
+  using MatrixBase::hasLocalMatrixStructure;
   using MatrixBase::residual;
 
   virtual void createWithLocalSize( localIndex const localRows,
@@ -103,6 +105,9 @@ public:
                                      localIndex const maxEntriesPerRow,
                                      MPI_Comm const & comm ) override;
 
+  virtual void create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                       MPI_Comm const & comm ) override;
+
   virtual bool created() const override;
 
   virtual void reset() override;
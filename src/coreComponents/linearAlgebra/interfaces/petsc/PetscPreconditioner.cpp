@@ -229,11 +229,43 @@ void PetscPreconditioner::compute( PetscMatrix const & mat )
     }
   }
 
+  setUp();
+}
+
+void PetscPreconditioner::recompute( Matrix const & mat,
+                                     DofManager const & dofManager )
+{
+  // The setup can only be refreshed for the matrix object it was computed from
+  if( !ready() || &mat != &matrix() || m_precond == nullptr )
+  {
+    compute( mat, dofManager );
+    return;
+  }
+
+  // The factorizations keep their symbolic setup as long as the nonzero pattern is unchanged
+  bool const amg = m_parameters.preconditionerType == LinearSolverParameters::PreconditionerType::amg;
+  if( amg )
+  {
+    GEOSX_LAI_CHECK_ERROR( PCGAMGSetReuseInterpolation( m_precond, PETSC_TRUE ) );
+  }
+  setUp();
+  if( amg )
+  {
+    GEOSX_LAI_CHECK_ERROR( PCGAMGSetReuseInterpolation( m_precond, PETSC_FALSE ) );
+  }
+}
+
+void PetscPreconditioner::setUp()
+{
   // To be able to use PETSc solvers we need to disable floating point exceptions
   LvArray::system::FloatingPointExceptionGuard guard;
 
+  // PETSc sets the preconditioner up again on application when the values of the matrix have changed,
+  // which is only allowed during an explicit setup so that a computed preconditioner can be reused
+  GEOSX_LAI_CHECK_ERROR( PCSetReusePreconditioner( m_precond, PETSC_FALSE ) );
   GEOSX_LAI_CHECK_ERROR( PCSetUp( m_precond ) );
   GEOSX_LAI_CHECK_ERROR( PCSetUpOnBlocks( m_precond ) );
+  GEOSX_LAI_CHECK_ERROR( PCSetReusePreconditioner( m_precond, PETSC_TRUE ) );
 }
 
 void PetscPreconditioner::apply( PetscVector const & src,
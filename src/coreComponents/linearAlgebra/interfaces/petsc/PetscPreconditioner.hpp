@@ -78,6 +78,16 @@ public:
    */
   virtual void compute( Matrix const & mat ) override;
 
+  /**
+   * @brief Compute the preconditioner again for new values of the same matrix.
+   * @param mat the matrix to precondition, with the storage used by the previous setup
+   * @param dofManager the Degree-of-Freedom manager associated with matrix
+   *
+   * GAMG keeps its interpolation operators and the factorizations keep their symbolic setup.
+   */
+  virtual void recompute( Matrix const & mat,
+                          DofManager const & dofManager ) override;
+
   /**
    * @brief Apply operator to a vector
    * @param src Input vector (x).
@@ -97,6 +107,11 @@ public:
 
 private:
 
+  /**
+   * @brief Set up the PETSc preconditioner for the current values of its matrix.
+   */
+  void setUp();
+
   /// Parameters for all preconditioners
   LinearSolverParameters m_parameters;
 
@@ -107,6 +107,65 @@ void EpetraMatrix::createWithLocalSize( localIndex const localRows,
                                                      false );
 }
 
+void EpetraMatrix::create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                           MPI_Comm const & comm )
+{
+  localMatrix.move( LvArray::MemorySpace::CPU, false );
+
+  int * offsets;
+  int * indices;
+  double * values;
+
+  // Same sparsity pattern as the previous call: only copy the values in the optimized storage
+  if( hasLocalMatrixStructure( localMatrix, comm ) )
+  {
+    GEOSX_LAI_CHECK_ERROR( m_matrix->ExtractCrsDataPointers( offsets, indices, values ) );
+    copyLocalMatrixValues( localMatrix, values, m_matrix->NumMyNonzeros(), nullptr );
+    return;
+  }
+
+  reset();
+
+  localIndex const numRows = localMatrix.numRows();
+  array1d< int > rowSizes( numRows );
+  for( localIndex i = 0; i < numRows; ++i )
+  {
+    rowSizes[i] = LvArray::integerConversion< int >( localMatrix.numNonZeros( i ) );
+  }
+
+  m_dst_map = std::make_unique< Epetra_Map >( LvArray::integerConversion< globalIndex >( -1 ),
+                                              LvArray::integerConversion< int >( numRows ),
+                                              0,
+                                              Epetra_MpiComm( MPI_PARAM( comm ) ) );
+  m_src_map = std::make_unique< Epetra_Map >( *m_dst_map );
+  m_matrix = std::make_unique< Epetra_FECrsMatrix >( Copy, *m_dst_map, rowSizes.data(), false );
+
+  globalIndex const rankOffset = ilower();
+
+  open();
+  for( localIndex localRow = 0; localRow < numRows; ++localRow )
+  {
+    insert( localRow + rankOffset, localMatrix.getColumns( localRow ), localMatrix.getEntries( localRow ) );
+  }
+  close();
+
+  // Record where each entry of the local matrix is stored
+  GEOSX_LAI_CHECK_ERROR( m_matrix->ExtractCrsDataPointers( offsets, indices, values ) );
+  Epetra_Map const & colMap = m_matrix->ColMap();
+
+  setLocalMatrixStructure( localMatrix, [&]( localIndex const localRow, globalIndex const col ) -> localIndex
+  {
+    for( int k = offsets[localRow]; k < offsets[localRow + 1]; ++k )
+    {
+      if( colMap.GID64( indices[k] ) == col )
+      {
+        return k;
+      }
+    }
+    return -1;
+  } );
+}
+
 bool EpetraMatrix::created() const
 {
   return bool(m_matrix);
@@ -115,6 +174,7 @@ bool EpetraMatrix::created() const
 void EpetraMatrix::reset()
 {
   MatrixBase::reset();
+  clearLocalMatrixStructure();
   m_matrix.reset();
   m_dst_map.reset();
   m_src_map.reset();
@@ -134,6 +194,7 @@ void EpetraMatrix::zero()
 void EpetraMatrix::open()
 {
   GEOSX_LAI_ASSERT( created() && closed() );
+  clearLocalMatrixStructure();
   m_closed = false;
 }
 
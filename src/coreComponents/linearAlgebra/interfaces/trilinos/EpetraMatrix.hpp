@@ -82,6 +82,8 @@ public:
   using MatrixBase::insertable;
   using MatrixBase::modifiable;
   using MatrixBase::ready;
+  using MatrixBase::structureVersion;
+  using MatrixBase::hasLocalMatrixStructure;
   using MatrixBase::residual;
 
   virtual void createWithLocalSize( localIndex const localRows,
@@ -94,6 +96,9 @@ public:
                                      localIndex const maxEntriesPerRow,
                                      MPI_Comm const & comm ) override;
 
+  virtual void create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                       MPI_Comm const & comm ) override;
+
   virtual void open() override;
 
   virtual void close() override;
@@ -103,6 +103,9 @@ CreateMLOperator( LinearSolverParameters const & params, Epetra_RowMatrix const
   list.set( "smoother: pre or post", params.amg.preOrPostSmoothing );
   list.set( "coarse: type", getMLCoarseType( params.amg.coarseType ) );
 
+  // Keep the data needed by ReComputePreconditioner() when the values may be refreshed
+  list.set( "reuse: enable", params.precondReuse.refreshValues != 0 );
+
   std::unique_ptr< Epetra_Operator > precond =
     std::make_unique< ML_Epetra::MultiLevelPreconditioner >( matrix, list );
 
@@ -204,6 +207,36 @@ void TrilinosPreconditioner::compute( Matrix const & mat )
   }
 }
 
+void TrilinosPreconditioner::recompute( Matrix const & mat,
+                                        DofManager const & dofManager )
+{
+  // The setup can only be refreshed for the matrix object it was computed from
+  if( !ready() || &mat != &matrix() || !m_precond )
+  {
+    compute( mat, dofManager );
+    return;
+  }
+
+  LvArray::system::FloatingPointExceptionGuard guard;
+
+  if( ML_Epetra::MultiLevelPreconditioner * const ml = dynamic_cast< ML_Epetra::MultiLevelPreconditioner * >( m_precond.get() ) )
+  {
+    if( m_parameters.precondReuse.refreshValues != 0 )
+    {
+      GEOSX_LAI_CHECK_ERROR( ml->ReComputePreconditioner() );
+      return;
+    }
+  }
+  else if( Ifpack_Preconditioner * const ifpack = dynamic_cast< Ifpack_Preconditioner * >( m_precond.get() ) )
+  {
+    // Ifpack refers to the matrix object, whose values have been updated in place
+    GEOSX_LAI_CHECK_ERROR( ifpack->Compute() );
+    return;
+  }
+
+  compute( mat, dofManager );
+}
+
 void TrilinosPreconditioner::apply( Vector const & src,
                                     Vector & dst ) const
 {
@@ -71,6 +71,17 @@ public:
    */
   virtual void compute( Matrix const & mat ) override;
 
+  /**
+   * @brief Compute the preconditioner again for new values of the same matrix.
+   * @param mat the matrix to precondition, with the storage used by the previous setup
+   * @param dofManager the Degree-of-Freedom manager associated with matrix
+   *
+   * ML hierarchies keep their aggregates and prolongators and Ifpack preconditioners
+   * keep their symbolic setup; the other preconditioners are computed again.
+   */
+  virtual void recompute( Matrix const & mat,
+                          DofManager const & dofManager ) override;
+
   /**
    * @brief Apply operator to a vector
    * @param src Input vector (x).
@@ -49,14 +49,18 @@ void BiCGSTABsolver< VECTOR >::solve( Vector const & b,
   // Compute the target absolute tolerance
   real64 const absTol = b.norm2() * m_tolerance;
 
+  // Work vectors, kept between solves
+  array1d< VectorTemp > & work = workVectors( b, 9 );
+
   // Define vectors
-  VectorTemp r( x );
+  VectorTemp & r = work[0];
 
   // Compute initial rk
   m_operator.residual( x, b, r );
 
   // Define vectors
-  VectorTemp r0( r );
+  VectorTemp & r0 = work[1];
+  r0.copy( r );
 
   // Define scalars and reinitialize some
   real64 rho_old = r.dot( r0 );
@@ -64,13 +68,13 @@ void BiCGSTABsolver< VECTOR >::solve( Vector const & b,
   real64 omega = 1.0;
 
   // Define temporary vectors
-  VectorTemp v = createTempVector( r );
-  VectorTemp p = createTempVector( r );
-  VectorTemp y = createTempVector( r );
-  VectorTemp z = createTempVector( r );
-  VectorTemp t = createTempVector( r );
-  VectorTemp s = createTempVector( r );
-  VectorTemp q = createTempVector( x );
+  VectorTemp & v = work[2];
+  VectorTemp & p = work[3];
+  VectorTemp & y = work[4];
+  VectorTemp & z = work[5];
+  VectorTemp & t = work[6];
+  VectorTemp & s = work[7];
+  VectorTemp & q = work[8];
 
   v.zero();
   p.zero();
@@ -70,18 +70,21 @@ void CGsolver< VECTOR >::solve( Vector const & b, Vector & x ) const
   // Compute the target absolute tolerance
   real64 const absTol = b.norm2() * m_tolerance;
 
+  // Work vectors, kept between solves
+  array1d< VectorTemp > & work = workVectors( b, 4 );
+
   // Define residual vector
-  VectorTemp r = createTempVector( b );
+  VectorTemp & r = work[0];
 
   // Compute initial rk =  b - Ax
   m_operator.residual( x, b, r );
 
   // Preconditioning
-  VectorTemp z = createTempVector( x );
+  VectorTemp & z = work[1];
 
   // Search direction
-  VectorTemp p = createTempVector( z );
-  VectorTemp Ap = createTempVector( z );
+  VectorTemp & p = work[2];
+  VectorTemp & Ap = work[3];
 
   // Keep old value of preconditioned residual norm
   real64 tau_old = 0.0;
@@ -103,6 +103,7 @@ protected:
   using Base::m_residualNorms;
   using Base::createTempVector;
   using Base::logProgress;
+  using Base::workVectors;
   using Base::logResult;
 
 };
@@ -31,11 +31,18 @@ GMRESsolver< VECTOR >::GMRESsolver( LinearOperator< Vector > const & A,
                                     real64 tolerance,
                                     localIndex maxIterations,
                                     integer verbosity,
-                                    localIndex maxRestart )
+                                    localIndex maxRestart,
+                                    LinearSolverParameters::Krylov::Orthogonalization orthogonalization )
   : KrylovSolver< VECTOR >( A, M, tolerance, maxIterations, verbosity ),
   m_maxRestart( maxRestart ),
-  m_kspace( m_maxRestart + 1 ),
-  m_kspaceInitialized( false )
+  m_orthogonalization( orthogonalization ),
+  m_hessenberg( m_maxRestart + 1, m_maxRestart ),
+  m_rotationCos( m_maxRestart + 1 ),
+  m_rotationSin( m_maxRestart + 1 ),
+  m_rotatedResidual( m_maxRestart + 1 ),
+  m_basis( m_maxRestart + 2 ),
+  m_newVector( m_maxRestart + 2 ),
+  m_products( m_maxRestart + 2 )
 {
   GEOSX_ERROR_IF_LE_MSG( m_maxRestart, 0, "GMRES: max number of restart iterations must be positive." );
 }
@@ -95,37 +102,32 @@ template< typename VECTOR >
 void GMRESsolver< VECTOR >::solve( Vector const & b,
                                    Vector & x ) const
 {
-  // We create Krylov subspace vectors once using the size and partitioning of b.
-  // It is assumed that on every repeated call to solve() input vectors will keep
-  // the same (or at least compatible) size and partitioning.
-  if( !m_kspaceInitialized )
-  {
-    for( localIndex i = 0; i < m_maxRestart + 1; ++i )
-    {
-      m_kspace[i] = createTempVector( b );
-    }
-  }
-
   Stopwatch watch;
 
   // Compute the target absolute tolerance
   real64 const absTol = b.norm2() * m_tolerance;
 
-  // Define vectors
-  VectorTemp r = createTempVector( b );
-  VectorTemp w = createTempVector( b );
-  VectorTemp z = createTempVector( b );
+  // Work vectors, kept between solves: the Krylov subspace vectors follow r, w and z
+  array1d< VectorTemp > & work = workVectors( b, m_maxRestart + 4 );
+  VectorTemp & r = work[0];
+  VectorTemp & w = work[1];
+  VectorTemp & z = work[2];
+  VectorTemp * const kspace = work.data() + 3;
 
   // Compute initial rk
   m_operator.residual( x, b, r );
 
-  // Create upper Hessenberg matrix
-  array2d< real64, MatrixLayout::COL_MAJOR_PERM > H( m_maxRestart + 1, m_maxRestart );
+  // Upper Hessenberg matrix and plane rotations, allocated once
+  arrayView2d< real64, MatrixLayout::COL_MAJOR_PERM > const & H = m_hessenberg;
+  arrayView1d< real64 > const & c = m_rotationCos;
+  arrayView1d< real64 > const & s = m_rotationSin;
+  arrayView1d< real64 > const & g = m_rotatedResidual;
 
-  // Create plane rotation storage
-  array1d< real64 > c( m_maxRestart + 1 );
-  array1d< real64 > s( m_maxRestart + 1 );
-  array1d< real64 > g( m_maxRestart + 1 );
+  // Storage for the fused inner products of classical Gram-Schmidt
+  std::vector< Vector const * > & basis = m_basis;
+  std::vector< Vector const * > & newVector = m_newVector;
+  std::fill( newVector.begin(), newVector.end(), &w );
+  arrayView1d< real64 > const & h = m_products;
 
   m_result.status = LinearSolverResult::Status::NotConverged;
   m_residualNorms.resize( m_maxIterations + 1 );
@@ -138,7 +140,7 @@ void GMRESsolver< VECTOR >::solve( Vector const & b,
     // Re-initialize Krylov subspace
     g.setValues< serialPolicy >( 0.0 );
     g[0] = r.norm2();
-    m_kspace[0].axpby( 1.0 / g[0], r, 0.0 );
+    kspace[0].axpby( 1.0 / g[0], r, 0.0 );
 
     localIndex j;
     for( j = 0; j < m_maxRestart && k <= m_maxIterations; ++j, ++k )
@@ -155,19 +157,51 @@ void GMRESsolver< VECTOR >::solve( Vector const & b,
       }
 
       // Compute the new vector
-      m_precond.apply( m_kspace[j], z );
+      m_precond.apply( kspace[j], z );
       m_operator.apply( z, w );
 
       // Orthogonalization
-      for( localIndex i = 0; i <= j; ++i )
+      if( m_orthogonalization == LinearSolverParameters::Krylov::Orthogonalization::cgs2 )
+      {
+        // First pass: all the projections on the basis are reduced together
+        for( localIndex i = 0; i <= j; ++i )
+        {
+          basis[i] = &kspace[i];
+        }
+        multiDot( j + 1, basis.data(), newVector.data(), h.data() );
+        for( localIndex i = 0; i <= j; ++i )
+        {
+          H( i, j ) = h[i];
+          w.axpby( -h[i], kspace[i], 1.0 );
+        }
+
+        // Second pass: the projections are reduced together with the norm of w
+        basis[j+1] = &w;
+        multiDot( j + 2, basis.data(), newVector.data(), h.data() );
+        real64 correction = 0.0;
+        for( localIndex i = 0; i <= j; ++i )
+        {
+          H( i, j ) += h[i];
+          w.axpby( -h[i], kspace[i], 1.0 );
+          correction += h[i] * h[i];
+        }
+
+        // The norm after the second pass is recomputed when cancellation makes its update inaccurate
+        real64 const norm2 = h[j+1] - correction;
+        H( j+1, j ) = norm2 > 1e-4 * h[j+1] ? std::sqrt( norm2 ) : w.norm2();
+      }
+      else
       {
-        H( i, j ) = w.dot( m_kspace[i] );
-        w.axpby( -H( i, j ), m_kspace[i], 1.0 );
+        for( localIndex i = 0; i <= j; ++i )
+        {
+          H( i, j ) = w.dot( kspace[i] );
+          w.axpby( -H( i, j ), kspace[i], 1.0 );
+        }
+        H( j+1, j ) = w.norm2();
       }
 
-      H( j+1, j ) = w.norm2();
       GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( H( j + 1, j ) );
-      m_kspace[j+1].axpby( 1.0 / H( j+1, j ), w, 0.0 );
+      kspace[j+1].axpby( 1.0 / H( j+1, j ), w, 0.0 );
 
       // Apply all previous rotations to the new column
       for( localIndex i = 0; i < j; ++i )
@@ -186,7 +220,7 @@ void GMRESsolver< VECTOR >::solve( Vector const & b,
     w.zero();
     for( localIndex i = 0; i < j; ++i )
     {
-      w.axpy( g[i], m_kspace[i] );
+      w.axpy( g[i], kspace[i] );
     }
     m_precond.apply( w, z );
 
@@ -57,13 +57,16 @@ public:
    * @param[in] maxIterations maximum number of Krylov iterations
    * @param[in] verbosity     solver verbosity level
    * @param[in] maxRestart    number of iterations until restart
+   * @param[in] orthogonalization orthogonalization of the Krylov basis
    */
   GMRESsolver( LinearOperator< Vector > const & matrix,
                LinearOperator< Vector > const & precond,
                real64 const tolerance,
                localIndex const maxIterations,
                integer const verbosity = 0,
-               localIndex const maxRestart = 100 );
+               localIndex const maxRestart = 100,
+               LinearSolverParameters::Krylov::Orthogonalization const orthogonalization =
+                 LinearSolverParameters::Krylov::Orthogonalization::mgs );
 
   /**
    * @brief Virtual destructor.
@@ -105,16 +108,35 @@ protected:
   using Base::m_residualNorms;
   using Base::createTempVector;
   using Base::logProgress;
+  using Base::workVectors;
   using Base::logResult;
 
   /// Number of iterations needed to restart GMRES
   localIndex m_maxRestart;
 
-  /// Storage for Krylov subspace vectors
-  array1d< VectorTemp > m_kspace;
+  /// Orthogonalization of the Krylov basis
+  LinearSolverParameters::Krylov::Orthogonalization m_orthogonalization;
 
-  /// Flag indicating whether kspace vectors have been created
-  bool m_kspaceInitialized;
+  /// Upper Hessenberg matrix of the Arnoldi process
+  mutable array2d< real64, MatrixLayout::COL_MAJOR_PERM > m_hessenberg;
+
+  /// Cosines of the Givens rotations
+  mutable array1d< real64 > m_rotationCos;
+
+  /// Sines of the Givens rotations
+  mutable array1d< real64 > m_rotationSin;
+
+  /// Residual vector of the least squares problem, rotated
+  mutable array1d< real64 > m_rotatedResidual;
+
+  /// Krylov subspace vectors whose inner products with the new vector are fused (CGS2 only)
+  mutable std::vector< Vector const * > m_basis;
+
+  /// Second vector of each fused inner product, the new vector (CGS2 only)
+  mutable std::vector< Vector const * > m_newVector;
+
+  /// Fused inner products (CGS2 only)
+  mutable array1d< real64 > m_products;
 };
 
 } // namespace geosx
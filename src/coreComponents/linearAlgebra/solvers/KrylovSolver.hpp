@@ -24,6 +24,7 @@
 #include "linearAlgebra/utilities/BlockOperatorView.hpp"
 #include "linearAlgebra/utilities/LinearSolverParameters.hpp"
 #include "linearAlgebra/utilities/LinearSolverResult.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
 
 namespace geosx
 {
@@ -123,6 +124,35 @@ public:
     return m_residualNorms;
   }
 
+  /**
+   * @brief Get the operator to solve.
+   * @return a reference to the operator
+   */
+  LinearOperator< Vector > const & getOperator() const
+  {
+    return m_operator;
+  }
+
+  /**
+   * @brief Get the preconditioning operator.
+   * @return a reference to the preconditioning operator
+   */
+  LinearOperator< Vector > const & getPreconditioner() const
+  {
+    return m_precond;
+  }
+
+  /**
+   * @brief Set the relative residual norm reduction tolerance of the next solves.
+   * @param tolerance the tolerance
+   *
+   * This allows a solver and its work vectors to be kept when the tolerance is adapted between solves.
+   */
+  void setTolerance( real64 const tolerance )
+  {
+    m_tolerance = tolerance;
+  }
+
   /**
    * @brief Get log level.
    * @return integer value of the log level
@@ -153,6 +183,16 @@ private:
       v.createWithLocalSize( src.localSize(), src.getComm() );
       return v;
     }
+
+    static bool sameLayout( VEC const & v, VEC const & src )
+    {
+      return v.created() && v.localSize() == src.localSize() && v.globalSize() == src.globalSize();
+    }
+
+    static MPI_Comm getComm( VEC const & src )
+    {
+      return src.getComm();
+    }
   };
 
   template< typename VEC >
@@ -169,6 +209,21 @@ private:
       }
       return v;
     }
+
+    static bool sameLayout( BlockVector< VEC > const & v, BlockVectorView< VEC > const & src )
+    {
+      bool same = v.blockSize() == src.blockSize();
+      for( localIndex i = 0; i < src.blockSize() && same; ++i )
+      {
+        same = VectorStorageHelper< VEC >::sameLayout( v.block( i ), src.block( i ) );
+      }
+      return same;
+    }
+
+    static MPI_Comm getComm( BlockVectorView< VEC > const & src )
+    {
+      return src.block( 0 ).getComm();
+    }
   };
 
   ///@endcond DO_NOT_DOCUMENT
@@ -190,6 +245,31 @@ protected:
     return VectorStorageHelper< VECTOR >::createFrom( src );
   }
 
+  /**
+   * @brief Get the work vectors of a solve (called by implementations).
+   * @param src the source vector, whose size and parallel distribution will be used
+   * @param numVectors the number of work vectors
+   * @return the work vectors
+   *
+   * The vectors are kept between solves and only created again when the number of vectors or the
+   * parallel layout of @p src changes, so that repeated solves on the same layout do not allocate.
+   * The decision is taken collectively, since creating parallel vectors is a collective operation.
+   */
+  array1d< VectorTemp > & workVectors( Vector const & src, localIndex const numVectors ) const
+  {
+    int const sameLayout = m_workVectors.size() == numVectors &&
+                           VectorStorageHelper< VECTOR >::sameLayout( m_workVectors[0], src );
+    if( MpiWrapper::Min( sameLayout, VectorStorageHelper< VECTOR >::getComm( src ) ) == 0 )
+    {
+      m_workVectors.resize( numVectors );
+      for( localIndex i = 0; i < numVectors; ++i )
+      {
+        m_workVectors[i] = createTempVector( src );
+      }
+    }
+    return m_workVectors;
+  }
+
   /**
    * @brief Output iteration progress (called by implementations).
    * @param iter  current iteration number
@@ -232,6 +312,9 @@ protected:
 
   /// Absolute residual norms at each iteration (if available)
   mutable array1d< real64 > m_residualNorms;
+
+  /// Work vectors kept between solves
+  mutable array1d< VectorTemp > m_workVectors;
 };
 
 } //namespace geosx
@@ -19,6 +19,10 @@
 #define GEOSX_LINEARALGEBRA_SOLVERS_KRYLOVUTILS_HPP_
 
 #include "codingUtilities/Utilities.hpp"
+#include "linearAlgebra/common.hpp"
+#include "linearAlgebra/utilities/BlockVectorView.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
 
 /// Tolerance for division by zero in Krylov solvers
 #define GEOSX_KRYLOV_MIN_DIV ::geosx::NumericTraits< real64 >::eps
@@ -39,4 +43,101 @@
   } while( false )
 #endif
 
+namespace geosx
+{
+
+/**
+ * @brief Local operations on the vectors of Krylov solvers.
+ * @tparam VECTOR type of vectors
+ *
+ * The local parts of several inner products are computed separately,
+ * so that they can be summed across ranks with a single reduction.
+ */
+template< typename VECTOR >
+struct KrylovVectorOps
+{
+  /**
+   * @brief Compute the contribution of this rank to an inner product.
+   * @param x the first vector
+   * @param y the second vector
+   * @return the sum over the local entries of the products of the entries of @p x and @p y
+   */
+  static real64 localDot( VECTOR const & x, VECTOR const & y )
+  {
+    GEOSX_LAI_ASSERT_EQ( x.localSize(), y.localSize() );
+    real64 const * const xData = x.extractLocalVector();
+    real64 const * const yData = y.extractLocalVector();
+
+    RAJA::ReduceSum< parallelHostReduce, real64 > sum( 0.0 );
+    forAll< parallelHostPolicy >( x.localSize(), [=]( localIndex const i )
+    {
+      sum += xData[i] * yData[i];
+    } );
+    return sum.get();
+  }
+
+  /**
+   * @brief Get the communicator of a vector.
+   * @param x the vector
+   * @return the communicator
+   */
+  static MPI_Comm getComm( VECTOR const & x )
+  {
+    return x.getComm();
+  }
+};
+
+///@cond DO_NOT_DOCUMENT
+
+template< typename VECTOR >
+struct KrylovVectorOps< BlockVectorView< VECTOR > >
+{
+  static real64 localDot( BlockVectorView< VECTOR > const & x, BlockVectorView< VECTOR > const & y )
+  {
+    GEOSX_LAI_ASSERT_EQ( x.blockSize(), y.blockSize() );
+    real64 sum = 0.0;
+    for( localIndex i = 0; i < x.blockSize(); ++i )
+    {
+      sum += KrylovVectorOps< VECTOR >::localDot( x.block( i ), y.block( i ) );
+    }
+    return sum;
+  }
+
+  static MPI_Comm getComm( BlockVectorView< VECTOR > const & x )
+  {
+    return x.block( 0 ).getComm();
+  }
+};
+
+///@endcond DO_NOT_DOCUMENT
+
+/**
+ * @brief Compute several inner products with a single global reduction.
+ * @tparam VECTOR type of vectors
+ * @param numProducts the number of inner products
+ * @param x the first vector of each product
+ * @param y the second vector of each product
+ * @param products the inner products
+ */
+template< typename VECTOR >
+void multiDot( localIndex const numProducts,
+               VECTOR const * const * const x,
+               VECTOR const * const * const y,
+               real64 * const products )
+{
+  GEOSX_ASSERT_GT( numProducts, 0 );
+  array1d< real64 > localProducts( numProducts );
+  for( localIndex i = 0; i < numProducts; ++i )
+  {
+    localProducts[i] = KrylovVectorOps< VECTOR >::localDot( *x[i], *y[i] );
+  }
+  MpiWrapper::allReduce( localProducts.data(),
+                         products,
+                         LvArray::integerConversion< int >( numProducts ),
+                         MPI_SUM,
+                         KrylovVectorOps< VECTOR >::getComm( *x[0] ) );
+}
+
+} // namespace geosx
+
 #endif //GEOSX_LINEARALGEBRA_SOLVERS_KRYLOVUTILS_HPP_
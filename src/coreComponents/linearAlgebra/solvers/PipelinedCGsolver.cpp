@@ -0,0 +1,173 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PipelinedCGsolver.cpp
+ */
+
+#include "PipelinedCGsolver.hpp"
+
+#include "common/Stopwatch.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/interfaces/LinearOperator.hpp"
+#include "linearAlgebra/utilities/BlockVectorView.hpp"
+#include "linearAlgebra/solvers/KrylovUtils.hpp"
+
+namespace geosx
+{
+
+template< typename VECTOR >
+PipelinedCGsolver< VECTOR >::PipelinedCGsolver( LinearOperator< Vector > const & A,
+                                                LinearOperator< Vector > const & M,
+                                                real64 const tolerance,
+                                                localIndex const maxIterations,
+                                                integer const verbosity )
+  : KrylovSolver< VECTOR >( A, M, tolerance, maxIterations, verbosity )
+{}
+
+template< typename VECTOR >
+PipelinedCGsolver< VECTOR >::~PipelinedCGsolver() = default;
+
+template< typename VECTOR >
+void PipelinedCGsolver< VECTOR >::solve( Vector const & b, Vector & x ) const
+{
+  Stopwatch watch;
+
+  // Compute the target absolute tolerance
+  real64 const absTol = b.norm2() * m_tolerance;
+
+  // Work vectors, kept between solves
+  array1d< VectorTemp > & work = workVectors( b, 9 );
+
+  // Residual r = b - Ax, preconditioned residual u = Mr and w = Au
+  VectorTemp & r = work[0];
+  VectorTemp & u = work[1];
+  VectorTemp & w = work[2];
+  m_operator.residual( x, b, r );
+  m_precond.apply( r, u );
+  m_operator.apply( u, w );
+
+  // m = Mw and n = Am, computed while the inner products are reduced
+  VectorTemp & m = work[3];
+  VectorTemp & n = work[4];
+
+  // Search direction p and its images s = Ap, q = Ms and z = Aq
+  VectorTemp & p = work[5];
+  VectorTemp & s = work[6];
+  VectorTemp & q = work[7];
+  VectorTemp & z = work[8];
+  p.zero();
+  s.zero();
+  q.zero();
+  z.zero();
+
+  MPI_Comm const comm = KrylovVectorOps< Vector >::getComm( b );
+
+  real64 gamma_old = 0.0;
+  real64 alpha = 0.0;
+
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_result.numIterations = 0;
+  m_residualNorms.resize( m_maxIterations + 1 );
+
+  localIndex k;
+  real64 rnorm = 0.0;
+
+  for( k = 0; k <= m_maxIterations && m_result.status == LinearSolverResult::Status::NotConverged; ++k )
+  {
+    // Start the reduction of gamma = (r,u), delta = (w,u) and (r,r)
+    real64 localProducts[3] = { KrylovVectorOps< Vector >::localDot( r, u ),
+                                KrylovVectorOps< Vector >::localDot( w, u ),
+                                KrylovVectorOps< Vector >::localDot( r, r ) };
+    real64 products[3];
+    MPI_Request request;
+    MpiWrapper::iAllReduce( localProducts, products, 3, MPI_SUM, comm, &request );
+
+    // Overlap the reduction with the preconditioner and operator applications
+    m_precond.apply( w, m );
+    m_operator.apply( m, n );
+
+    MpiWrapper::Wait( &request, MPI_STATUS_IGNORE );
+    real64 const gamma = products[0];
+    real64 const delta = products[1];
+
+    rnorm = std::sqrt( std::max( products[2], 0.0 ) );
+    logProgress( k, rnorm );
+
+    // Convergence check on ||rk||/||b||
+    if( rnorm < absTol )
+    {
+      m_result.status = LinearSolverResult::Status::Success;
+      break;
+    }
+
+    // Compute beta and alpha
+    real64 beta = 0.0;
+    real64 denominator = delta;
+    if( k > 0 )
+    {
+      GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( gamma_old );
+      beta = gamma / gamma_old;
+      denominator = delta - beta * gamma / alpha;
+    }
+    GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( denominator );
+    if( m_result.status == LinearSolverResult::Status::Breakdown )
+    {
+      break;
+    }
+    alpha = gamma / denominator;
+
+    // Update the search direction and its images
+    z.axpby( 1.0, n, beta );
+    q.axpby( 1.0, m, beta );
+    s.axpby( 1.0, w, beta );
+    p.axpby( 1.0, u, beta );
+
+    // Update the solution and the residuals
+    x.axpby( alpha, p, 1.0 );
+    r.axpby( -alpha, s, 1.0 );
+    u.axpby( -alpha, q, 1.0 );
+    w.axpby( -alpha, z, 1.0 );
+
+    // Keep the old gamma value
+    gamma_old = gamma;
+  }
+
+  m_result.numIterations = k;
+  m_result.residualReduction = rnorm / absTol * m_tolerance;
+  m_result.solveTime = watch.elapsedTime();
+
+  logResult();
+  m_residualNorms.resize( m_result.numIterations + 1 );
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class PipelinedCGsolver< TrilinosInterface::ParallelVector >;
+template class PipelinedCGsolver< BlockVectorView< TrilinosInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class PipelinedCGsolver< HypreInterface::ParallelVector >;
+template class PipelinedCGsolver< BlockVectorView< HypreInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class PipelinedCGsolver< PetscInterface::ParallelVector >;
+template class PipelinedCGsolver< BlockVectorView< PetscInterface::ParallelVector > >;
+#endif
+
+} //namespace geosx
@@ -69,6 +69,21 @@ public:
     compute( mat );
   }
 
+  /**
+   * @brief Compute the preconditioner again for new values of the matrix it was computed from.
+   * @param mat the matrix to precondition, with the storage used by the previous setup
+   * @param dofManager the Degree-of-Freedom manager associated with matrix
+   *
+   * Implementations may keep the parts of the setup that only depend on the sparsity pattern,
+   * such as the coarsening and the interpolation of an AMG hierarchy or a symbolic factorization,
+   * and only recompute the parts that depend on the values. The default is a full setup.
+   */
+  virtual void recompute( Matrix const & mat,
+                          DofManager const & dofManager )
+  {
+    compute( mat, dofManager );
+  }
+
   /**
    * @brief Clean up the preconditioner setup.
    *
@@ -0,0 +1,204 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PreconditionerChebyshev.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_SOLVERS_PRECONDITIONERCHEBYSHEV_HPP_
+#define GEOSX_LINEARALGEBRA_SOLVERS_PRECONDITIONERCHEBYSHEV_HPP_
+
+#include "linearAlgebra/interfaces/LinearOperator.hpp"
+#include "linearAlgebra/solvers/PreconditionerBase.hpp"
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+namespace geosx
+{
+
+/**
+ * @brief Chebyshev polynomial preconditioner on the Jacobi-scaled operator.
+ * @tparam LAI linear algebra interface providing vectors, matrices and solvers
+ *
+ * Applies a fixed number of Chebyshev iterations to the system preconditioned by its diagonal,
+ * starting from a zero initial guess. Only the diagonal of the matrix given to compute() is used,
+ * the operator itself is applied through a LinearOperator, which allows matrix-free operators
+ * with an assembled diagonal. The largest eigenvalue of the Jacobi-scaled operator is estimated
+ * with a few power iterations, the smallest one is taken as a fixed fraction of it.
+ */
+template< typename LAI >
+class PreconditionerChebyshev : public PreconditionerBase< LAI >
+{
+public:
+
+  /// Alias for base type
+  using Base = PreconditionerBase< LAI >;
+
+  /// Alias for vector type
+  using Vector = typename Base::Vector;
+
+  /// Alias for matrix type
+  using Matrix = typename Base::Matrix;
+
+  /**
+   * @brief Constructor.
+   * @param params the Chebyshev parameters
+   * @param op the operator to precondition, or nullptr to use the matrix given to compute()
+   *
+   * The operator, if given, must outlive the preconditioner.
+   */
+  explicit PreconditionerChebyshev( LinearSolverParameters::Chebyshev params,
+                                    LinearOperator< Vector > const * const op = nullptr )
+    : Base(),
+    m_params( std::move( params ) ),
+    m_operator( op ),
+    m_lambdaMax( 0.0 ),
+    m_lambdaMin( 0.0 )
+  {}
+
+  virtual ~PreconditionerChebyshev() = default;
+
+  /**
+   * @brief Compute the inverse diagonal and the eigenvalue bounds.
+   * @param mat the matrix whose diagonal is used
+   */
+  virtual void compute( Matrix const & mat ) override
+  {
+    Base::compute( mat );
+    LinearOperator< Vector > const & op = m_operator != nullptr ? *m_operator : mat;
+
+    m_invDiagonal.createWithLocalSize( mat.numLocalRows(), mat.getComm() );
+    m_residual.createWithLocalSize( mat.numLocalRows(), mat.getComm() );
+    m_direction.createWithLocalSize( mat.numLocalRows(), mat.getComm() );
+    m_temp.createWithLocalSize( mat.numLocalRows(), mat.getComm() );
+
+    mat.extractDiagonal( m_invDiagonal );
+    m_invDiagonal.reciprocal();
+
+    // Power iterations on D^{-1}A, with a safety margin on the estimate
+    m_direction.rand();
+    m_direction.scale( 1.0 / m_direction.norm2() );
+    real64 lambda = 0.0;
+    for( integer i = 0; i < m_params.numPowerIterations; ++i )
+    {
+      op.apply( m_direction, m_temp );
+      scaleByInverseDiagonal( m_temp );
+      lambda = m_temp.norm2();
+      if( lambda <= 0.0 )
+      {
+        break;
+      }
+      m_direction.axpby( 1.0 / lambda, m_temp, 0.0 );
+    }
+    GEOSX_LAI_ASSERT_GT( lambda, 0.0 );
+
+    m_lambdaMax = 1.1 * lambda;
+    m_lambdaMin = m_lambdaMax / m_params.eigRatio;
+  }
+
+  /**
+   * @brief Clean up the preconditioner setup.
+   */
+  virtual void clear() override
+  {
+    Base::clear();
+    m_invDiagonal.reset();
+    m_residual.reset();
+    m_direction.reset();
+    m_temp.reset();
+  }
+
+  /**
+   * @brief Apply operator to a vector.
+   * @param src Input vector (src).
+   * @param dst Output vector (dst).
+   */
+  virtual void apply( Vector const & src,
+                      Vector & dst ) const override
+  {
+    GEOSX_LAI_ASSERT( this->ready() );
+    GEOSX_LAI_ASSERT_EQ( this->numGlobalRows(), dst.globalSize() );
+    GEOSX_LAI_ASSERT_EQ( this->numGlobalCols(), src.globalSize() );
+
+    LinearOperator< Vector > const & op = m_operator != nullptr ? *m_operator : this->matrix();
+
+    real64 const theta = 0.5 * ( m_lambdaMax + m_lambdaMin );
+    real64 const delta = 0.5 * ( m_lambdaMax - m_lambdaMin );
+    real64 const sigma = theta / delta;
+    real64 rho = 1.0 / sigma;
+
+    // r = b, d = D^{-1}r / theta, x = d
+    m_residual.copy( src );
+    m_direction.copy( src );
+    scaleByInverseDiagonal( m_direction );
+    m_direction.scale( 1.0 / theta );
+    dst.copy( m_direction );
+
+    for( integer k = 1; k < m_params.degree; ++k )
+    {
+      // r = r - Ad
+      op.apply( m_direction, m_temp );
+      m_residual.axpy( -1.0, m_temp );
+
+      // d = rho_new * rho * d + 2 * rho_new / delta * D^{-1}r
+      real64 const rhoNew = 1.0 / ( 2.0 * sigma - rho );
+      m_temp.copy( m_residual );
+      scaleByInverseDiagonal( m_temp );
+      m_direction.axpby( 2.0 * rhoNew / delta, m_temp, rhoNew * rho );
+
+      dst.axpy( 1.0, m_direction );
+      rho = rhoNew;
+    }
+  }
+
+private:
+
+  /**
+   * @brief Multiply a vector by the inverse diagonal, entry by entry.
+   * @param v the vector
+   */
+  void scaleByInverseDiagonal( Vector & v ) const
+  {
+    real64 * const values = v.extractLocalVector();
+    real64 const * const invDiagonal = m_invDiagonal.extractLocalVector();
+    forAll< parallelHostPolicy >( v.localSize(), [=] ( localIndex const i )
+    {
+      values[i] *= invDiagonal[i];
+    } );
+  }
+
+  /// Chebyshev parameters
+  LinearSolverParameters::Chebyshev m_params;
+
+  /// Operator to precondition, or nullptr to use the matrix
+  LinearOperator< Vector > const * m_operator;
+
+  /// Inverse of the matrix diagonal
+  Vector m_invDiagonal;
+
+  /// Work vectors of the Chebyshev iteration
+  mutable Vector m_residual;
+  mutable Vector m_direction;
+  mutable Vector m_temp;
+
+  /// Upper bound of the spectrum of the Jacobi-scaled operator
+  real64 m_lambdaMax;
+
+  /// Lower bound of the spectrum targeted by the polynomial
+  real64 m_lambdaMin;
+};
+
+}
+
+#endif //GEOSX_LINEARALGEBRA_SOLVERS_PRECONDITIONERCHEBYSHEV_HPP_
@@ -0,0 +1,164 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testBlockRowAssembly.cpp
+ */
+
+#include "gtest/gtest.h"
+
+#include "common/DataTypes.hpp"
+#include "managers/initialization.hpp"
+#include "linearAlgebra/utilities/BlockRowAssembly.hpp"
+
+using namespace geosx;
+
+namespace
+{
+
+localIndex constexpr blockSize = 3;
+localIndex constexpr numBlocks = 4;
+
+// Block tridiagonal pattern: each block row couples to the previous, current and next blocks
+void createBlockTridiagonal( CRSMatrix< real64, globalIndex > & matrix )
+{
+  SparsityPattern< globalIndex > pattern( numBlocks * blockSize, numBlocks * blockSize, 3 * blockSize );
+  for( localIndex ib = 0; ib < numBlocks; ++ib )
+  {
+    for( localIndex jb = std::max( ib - 1, localIndex( 0 ) ); jb <= std::min( ib + 1, numBlocks - 1 ); ++jb )
+    {
+      for( localIndex i = 0; i < blockSize; ++i )
+      {
+        for( localIndex j = 0; j < blockSize; ++j )
+        {
+          pattern.insertNonZero( ib * blockSize + i, jb * blockSize + j );
+        }
+      }
+    }
+  }
+  pattern.compress();
+  matrix.assimilate< serialPolicy >( std::move( pattern ) );
+  matrix.toViewConstSizes().setValues< serialPolicy >( 0.0 );
+}
+
+}
+
+TEST( BlockRowAssembly, MatchesScalarAssembly )
+{
+  CRSMatrix< real64, globalIndex > blockAssembled;
+  CRSMatrix< real64, globalIndex > scalarAssembled;
+  createBlockTridiagonal( blockAssembled );
+  createBlockTridiagonal( scalarAssembled );
+
+  // Unsorted columns of the blocks 2 and 1, plus a column outside of the pattern of block 1
+  localIndex constexpr numCols = 2 * blockSize + 1;
+  globalIndex const cols[numCols] = { 7, 6, 8, 3, 5, 4, 11 };
+  real64 values[blockSize * numCols];
+  for( localIndex k = 0; k < blockSize * numCols; ++k )
+  {
+    values[k] = 1.0 + 0.5 * k;
+  }
+
+  for( int repeat = 0; repeat < 2; ++repeat )
+  {
+    addToBlockRowBinarySearchUnsorted< serialAtomic, blockSize, numCols >( blockAssembled.toViewConstSizes(),
+                                                                           blockSize,
+                                                                           cols,
+                                                                           values,
+                                                                           numCols );
+    for( localIndex i = 0; i < blockSize; ++i )
+    {
+      scalarAssembled.toViewConstSizes().addToRowBinarySearchUnsorted< serialAtomic >( blockSize + i,
+                                                                                      cols,
+                                                                                      values + i * numCols,
+                                                                                      numCols );
+    }
+  }
+
+  for( localIndex row = 0; row < numBlocks * blockSize; ++row )
+  {
+    ASSERT_EQ( blockAssembled.numNonZeros( row ), scalarAssembled.numNonZeros( row ) );
+    for( localIndex k = 0; k < blockAssembled.numNonZeros( row ); ++k )
+    {
+      EXPECT_EQ( blockAssembled.getColumns( row )[k], scalarAssembled.getColumns( row )[k] );
+      EXPECT_DOUBLE_EQ( blockAssembled.getEntries( row )[k], scalarAssembled.getEntries( row )[k] );
+    }
+  }
+
+  // The columns of the block 2 received the values twice
+  localIndex const position = findColumnPosition( blockAssembled.getColumns( blockSize ).dataIfContiguous(),
+                                                  blockAssembled.numNonZeros( blockSize ),
+                                                  7 );
+  ASSERT_GE( position, 0 );
+  EXPECT_DOUBLE_EQ( blockAssembled.getEntries( blockSize )[position], 2.0 * values[0] );
+  EXPECT_EQ( findColumnPosition( blockAssembled.getColumns( blockSize ).dataIfContiguous(),
+                                 blockAssembled.numNonZeros( blockSize ),
+                                 11 ), -1 );
+}
+
+TEST( BlockRowAssembly, PrecomputedPositionsMatchSearch )
+{
+  CRSMatrix< real64, globalIndex > positionAssembled;
+  CRSMatrix< real64, globalIndex > searchAssembled;
+  createBlockTridiagonal( positionAssembled );
+  createBlockTridiagonal( searchAssembled );
+
+  // Blocks 2 and 1 coupled to the block row 1, then a block outside of the pattern of the row
+  localIndex constexpr numObjects = 3;
+  localIndex constexpr numCols = numObjects * blockSize;
+  globalIndex const cols[numCols] = { 6, 7, 8, 3, 4, 5, 9, 10, 11 };
+  real64 values[blockSize * numCols];
+  for( localIndex k = 0; k < blockSize * numCols; ++k )
+  {
+    values[k] = 2.0 - 0.25 * k;
+  }
+
+  localIndex positions[numObjects];
+  for( localIndex k = 0; k < numObjects; ++k )
+  {
+    positions[k] = findColumnPosition( positionAssembled.getColumns( blockSize ).dataIfContiguous(),
+                                       positionAssembled.numNonZeros( blockSize ),
+                                       cols[k * blockSize] );
+  }
+  EXPECT_EQ( positions[2], -1 );
+
+  addToBlockRowAtPositions< serialAtomic, blockSize, blockSize >( positionAssembled.toViewConstSizes(),
+                                                                   blockSize,
+                                                                   positions,
+                                                                   numObjects,
+                                                                   values );
+  addToBlockRowBinarySearchUnsorted< serialAtomic, blockSize, numCols >( searchAssembled.toViewConstSizes(),
+                                                                         blockSize,
+                                                                         cols,
+                                                                         values,
+                                                                         numCols );
+
+  for( localIndex row = 0; row < numBlocks * blockSize; ++row )
+  {
+    ASSERT_EQ( positionAssembled.numNonZeros( row ), searchAssembled.numNonZeros( row ) );
+    for( localIndex k = 0; k < positionAssembled.numNonZeros( row ); ++k )
+    {
+      EXPECT_DOUBLE_EQ( positionAssembled.getEntries( row )[k], searchAssembled.getEntries( row )[k] );
+    }
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
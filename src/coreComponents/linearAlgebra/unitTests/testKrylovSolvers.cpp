@@ -24,6 +24,7 @@
 #include "managers/initialization.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 #include "linearAlgebra/utilities/BlockOperatorWrapper.hpp"
+#include "linearAlgebra/solvers/PreconditionerChebyshev.hpp"
 #include "linearAlgebra/solvers/PreconditionerIdentity.hpp"
 #include "linearAlgebra/solvers/KrylovSolver.hpp"
 
@@ -57,6 +58,20 @@ LinearSolverParameters params_GMRES()
   return parameters;
 }
 
+LinearSolverParameters params_GMRES_CGS2()
+{
+  LinearSolverParameters parameters = params_GMRES();
+  parameters.krylov.orthogonalization = geosx::LinearSolverParameters::Krylov::Orthogonalization::cgs2;
+  return parameters;
+}
+
+LinearSolverParameters params_PipelinedCG()
+{
+  LinearSolverParameters parameters = params_CG();
+  parameters.solverType = geosx::LinearSolverParameters::SolverType::pipecg;
+  return parameters;
+}
+
 template< typename OPERATOR, typename PRECOND, typename VECTOR >
 class KrylovSolverTestBase : public ::testing::Test
 {
@@ -98,6 +113,15 @@ protected:
     sol_comp.axpy( -1.0, sol_true );
     real64 const relTol = cond_est * params.krylov.relTolerance;
     EXPECT_LT( sol_comp.norm2() / sol_true.norm2(), relTol );
+
+    // Solve again with the work vectors of the first solve
+    localIndex const numIterations = solver->result().numIterations;
+    sol_comp.zero();
+    solver->solve( rhs_true, sol_comp );
+    EXPECT_TRUE( solver->result().success() );
+    EXPECT_EQ( solver->result().numIterations, numIterations );
+    sol_comp.axpy( -1.0, sol_true );
+    EXPECT_LT( sol_comp.norm2() / sol_true.norm2(), relTol );
   }
 };
 
@@ -155,10 +179,50 @@ TYPED_TEST_P( KrylovSolverTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverTest, GMRES_CGS2 )
+{
+  this->test( params_GMRES_CGS2() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, PipelinedCG )
+{
+  this->test( params_PipelinedCG() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, CG_Chebyshev )
+{
+  using Vector = typename TypeParam::ParallelVector;
+  LinearSolverParameters const params = params_CG();
+
+  this->sol_true.rand();
+  this->matrix.apply( this->sol_true, this->rhs_true );
+
+  // Unpreconditioned solve for reference
+  std::unique_ptr< KrylovSolver< Vector > > const solver = KrylovSolver< Vector >::Create( params, this->matrix, this->precond );
+  this->sol_comp.zero();
+  solver->solve( this->rhs_true, this->sol_comp );
+  localIndex const numIterations = solver->result().numIterations;
+
+  // The polynomial preconditioner must reduce the iteration count
+  PreconditionerChebyshev< TypeParam > chebyshev( params.chebyshev );
+  chebyshev.compute( this->matrix );
+  std::unique_ptr< KrylovSolver< Vector > > const chebyshevSolver = KrylovSolver< Vector >::Create( params, this->matrix, chebyshev );
+  this->sol_comp.zero();
+  chebyshevSolver->solve( this->rhs_true, this->sol_comp );
+  EXPECT_TRUE( chebyshevSolver->result().success() );
+  EXPECT_LT( chebyshevSolver->result().numIterations, numIterations );
+
+  this->sol_comp.axpy( -1.0, this->sol_true );
+  EXPECT_LT( this->sol_comp.norm2() / this->sol_true.norm2(), this->cond_est * params.krylov.relTolerance );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             GMRES_CGS2,
+                             PipelinedCG,
+                             CG_Chebyshev );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverTest, TrilinosInterface, );
@@ -245,10 +309,22 @@ TYPED_TEST_P( KrylovSolverBlockTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverBlockTest, GMRES_CGS2 )
+{
+  this->test( params_GMRES_CGS2() );
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, PipelinedCG )
+{
+  this->test( params_PipelinedCG() );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverBlockTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             GMRES_CGS2,
+                             PipelinedCG );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverBlockTest, TrilinosInterface, );
@@ -485,8 +485,63 @@ TYPED_TEST_P( LAOperationsTest, RectangularMatrixOperations )
   EXPECT_DOUBLE_EQ( c, std::sqrt( static_cast< real64 >( nRows * ( nRows + 1 ) * ( 2 * nRows + 1 ) ) / 3.0 ) );
 }
 
+TYPED_TEST_P( LAOperationsTest, MatrixCreateFromLocalMatrix )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+
+  // Local rows of a 1D Laplacian operator
+  localIndex const numLocalRows = 10;
+  globalIndex const rankOffset = MpiWrapper::PrefixSum< globalIndex >( numLocalRows );
+  globalIndex const numGlobalRows = MpiWrapper::Sum( globalIndex( numLocalRows ) );
+
+  CRSMatrix< real64, globalIndex > localMatrix( numLocalRows, numGlobalRows, 3 );
+  for( localIndex i = 0; i < numLocalRows; ++i )
+  {
+    globalIndex const row = rankOffset + i;
+    if( row > 0 )
+    {
+      localMatrix.insertNonZero( i, row - 1, -1.0 );
+    }
+    localMatrix.insertNonZero( i, row, 2.0 );
+    if( row < numGlobalRows - 1 )
+    {
+      localMatrix.insertNonZero( i, row + 1, -1.0 );
+    }
+  }
+
+  Matrix A;
+  A.create( localMatrix.toViewConst(), MPI_COMM_GEOSX );
+  EXPECT_DOUBLE_EQ( A.normInf(), 4.0 );
+  EXPECT_EQ( A.numGlobalNonzeros(), 3 * numGlobalRows - 2 );
+
+  // Same sparsity pattern, new values
+  for( localIndex i = 0; i < numLocalRows; ++i )
+  {
+    arraySlice1d< real64 > const entries = localMatrix.getEntries( i );
+    for( localIndex k = 0; k < entries.size(); ++k )
+    {
+      entries[k] *= 3.0;
+    }
+  }
+  A.create( localMatrix.toViewConst(), MPI_COMM_GEOSX );
+  EXPECT_DOUBLE_EQ( A.normInf(), 12.0 );
+  EXPECT_DOUBLE_EQ( A.normFrobenius(), 3.0 * std::sqrt( 4.0 * numGlobalRows + 2.0 * ( numGlobalRows - 1 ) ) );
+  EXPECT_DOUBLE_EQ( A.getDiagValue( rankOffset ), 6.0 );
+
+  // New sparsity pattern: diagonal only
+  CRSMatrix< real64, globalIndex > diagMatrix( numLocalRows, numGlobalRows, 1 );
+  for( localIndex i = 0; i < numLocalRows; ++i )
+  {
+    diagMatrix.insertNonZero( i, rankOffset + i, 5.0 );
+  }
+  A.create( diagMatrix.toViewConst(), MPI_COMM_GEOSX );
+  EXPECT_DOUBLE_EQ( A.normInf(), 5.0 );
+  EXPECT_EQ( A.numGlobalNonzeros(), numGlobalRows );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( LAOperationsTest,
                              VectorFunctions,
+                             MatrixCreateFromLocalMatrix,
                              MatrixMatrixOperations,
                              RectangularMatrixOperations );
 
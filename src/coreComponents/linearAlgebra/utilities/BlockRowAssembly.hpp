@@ -0,0 +1,164 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BlockRowAssembly.hpp
+ *
+ * Helpers adding the dense block of a mesh object (the rows of its degrees of freedom) to a scalar
+ * CRS local matrix. They only amortize the column search over the rows of the block: the matrix keeps
+ * its scalar storage, with one column index per entry, so they do not provide block (BSR) storage,
+ * block matrix-vector products or block preconditioners.
+ *
+ * TODO: a block CRS local matrix with dense blocks per pair of mesh objects, supported by DofManager,
+ *       the flow and well kernels and the backends (PETSc BAIJ, Epetra VBR), would store one column
+ *       index per block and replace these helpers.
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_UTILITIES_BLOCKROWASSEMBLY_HPP_
+#define GEOSX_LINEARALGEBRA_UTILITIES_BLOCKROWASSEMBLY_HPP_
+
+#include "common/DataTypes.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+namespace geosx
+{
+
+/**
+ * @brief Find the position of a column in a sorted row.
+ * @param columns the sorted columns of the row
+ * @param rowLength the number of columns of the row
+ * @param col the column to find
+ * @return the position of @p col in @p columns, or -1 if the row does not contain it
+ */
+GEOSX_HOST_DEVICE
+inline
+localIndex findColumnPosition( globalIndex const * const columns,
+                               localIndex const rowLength,
+                               globalIndex const col )
+{
+  localIndex lower = 0;
+  localIndex upper = rowLength;
+  while( lower < upper )
+  {
+    localIndex const middle = lower + ( upper - lower ) / 2;
+    if( columns[middle] < col )
+    {
+      lower = middle + 1;
+    }
+    else
+    {
+      upper = middle;
+    }
+  }
+  return ( lower < rowLength && columns[lower] == col ) ? lower : -1;
+}
+
+/**
+ * @brief Add a dense block to consecutive rows of a local matrix sharing the same columns.
+ * @tparam POLICY the atomic policy used to add the values
+ * @tparam NUM_ROWS the number of rows of the block
+ * @tparam MAX_COLS the maximum number of columns of the block
+ * @param matrix the local matrix
+ * @param firstRow the local index of the first row of the block
+ * @param cols the global column indices of the block, unsorted
+ * @param values the values of the block, row by row with a stride of @p numCols
+ * @param numCols the number of columns of the block
+ *
+ * This is the block version of CRSMatrixView::addToRowBinarySearchUnsorted: the position of each
+ * column is searched once in the first row and reused for the other rows of the block, which
+ * divides the search cost by the block size. The rows must have the same columns, which is the case
+ * for the rows of the degrees of freedom of a mesh object (cell, node) when the sparsity pattern
+ * has been built by DofManager. As in the scalar version, the columns missing from the rows are skipped.
+ */
+template< typename POLICY, localIndex NUM_ROWS, localIndex MAX_COLS >
+GEOSX_HOST_DEVICE
+inline
+void addToBlockRowBinarySearchUnsorted( CRSMatrixView< real64, globalIndex const > const & matrix,
+                                        localIndex const firstRow,
+                                        globalIndex const * const cols,
+                                        real64 const * const values,
+                                        localIndex const numCols )
+{
+  GEOSX_ASSERT_GE( MAX_COLS, numCols );
+
+  localIndex const rowLength = matrix.numNonZeros( firstRow );
+  globalIndex const * const columns = matrix.getColumns( firstRow ).dataIfContiguous();
+
+  localIndex positions[ MAX_COLS ];
+  for( localIndex j = 0; j < numCols; ++j )
+  {
+    positions[j] = findColumnPosition( columns, rowLength, cols[j] );
+  }
+
+  for( localIndex i = 0; i < NUM_ROWS; ++i )
+  {
+    GEOSX_ASSERT_EQ( matrix.numNonZeros( firstRow + i ), rowLength );
+    real64 * const entries = matrix.getEntries( firstRow + i ).dataIfContiguous();
+    real64 const * const rowValues = values + i * numCols;
+    for( localIndex j = 0; j < numCols; ++j )
+    {
+      if( positions[j] >= 0 )
+      {
+        RAJA::atomicAdd( POLICY{}, &entries[ positions[j] ], rowValues[j] );
+      }
+    }
+  }
+}
+
+/**
+ * @brief Add a dense block to consecutive rows of a local matrix at precomputed positions.
+ * @tparam POLICY the atomic policy used to add the values
+ * @tparam NUM_ROWS the number of rows of the block
+ * @tparam NUM_DOF the number of consecutive columns of each mesh object of the block
+ * @param matrix the local matrix
+ * @param firstRow the local index of the first row of the block
+ * @param positions the position in the rows of the first column of each mesh object, negative to skip the object
+ * @param numObjects the number of mesh objects of the block
+ * @param values the values of the block, row by row with a stride of @p numObjects * NUM_DOF
+ *
+ * This is the counterpart of addToBlockRowBinarySearchUnsorted when the positions of the columns
+ * have been computed beforehand (see StencilBase::computeAssemblyMap): the degrees of freedom of a
+ * mesh object are numbered consecutively, so the columns of an object follow the position of its
+ * first column, and no search is needed.
+ */
+template< typename POLICY, localIndex NUM_ROWS, localIndex NUM_DOF >
+GEOSX_HOST_DEVICE
+inline
+void addToBlockRowAtPositions( CRSMatrixView< real64, globalIndex const > const & matrix,
+                               localIndex const firstRow,
+                               localIndex const * const positions,
+                               localIndex const numObjects,
+                               real64 const * const values )
+{
+  localIndex const numCols = numObjects * NUM_DOF;
+  for( localIndex i = 0; i < NUM_ROWS; ++i )
+  {
+    real64 * const entries = matrix.getEntries( firstRow + i ).dataIfContiguous();
+    real64 const * const rowValues = values + i * numCols;
+    for( localIndex k = 0; k < numObjects; ++k )
+    {
+      if( positions[k] >= 0 )
+      {
+        for( localIndex jdof = 0; jdof < NUM_DOF; ++jdof )
+        {
+          RAJA::atomicAdd( POLICY{}, &entries[ positions[k] + jdof ], rowValues[k * NUM_DOF + jdof] );
+        }
+      }
+    }
+  }
+}
+
+} // namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_UTILITIES_BLOCKROWASSEMBLY_HPP_
@@ -42,6 +42,7 @@ struct LinearSolverParameters
     gmres,         ///< GMRES
     fgmres,        ///< Flexible GMRES
     bicgstab,      ///< BiCGStab
+    pipecg,        ///< Pipelined CG
     preconditioner ///< Preconditioner only
   };
 
@@ -60,13 +61,15 @@ struct LinearSolverParameters
     ict,    ///< Incomplete Cholesky with thresholding
     amg,    ///< Algebraic Multigrid
     mgr,    ///< Multigrid reduction (Hypre only)
-    block   ///< Block preconditioner
+    block,  ///< Block preconditioner
+    chebyshev ///< Chebyshev polynomial of the Jacobi-scaled operator (native iterative solvers only)
   };
 
   integer logLevel = 0;     ///< Output level [0=none, 1=basic, 2=everything]
   integer dofsPerNode = 1;  ///< Dofs per node (or support location) for non-scalar problems
   bool isSymmetric = false; ///< Whether input matrix is symmetric (may affect choice of scheme)
   integer stopIfError = 1;  ///< Whether to stop the simulation if the linear solver reports an error
+  integer matrixFree = false; ///< Whether to apply the operator without assembling it (if supported by the solver)
 
   SolverType solverType = SolverType::direct;                        ///< Solver type
   PreconditionerType preconditionerType = PreconditionerType::iluk;  ///< Preconditioner type
@@ -109,11 +112,21 @@ struct LinearSolverParameters
   /// Krylov-method parameters
   struct Krylov
   {
+    /**
+     * @brief Orthogonalization of the Krylov basis in GMRES.
+     */
+    enum class Orthogonalization : integer
+    {
+      mgs,  ///< Modified Gram-Schmidt, one reduction per basis vector
+      cgs2  ///< Classical Gram-Schmidt with reorthogonalization, two fused reductions per iteration
+    };
+
     real64 relTolerance = 1e-6;       ///< Relative convergence tolerance for iterative solvers
     integer maxIterations = 200;      ///< Max iterations before declaring convergence failure
     integer maxRestart = 200;         ///< Max number of vectors in Krylov basis before restarting
     integer useAdaptiveTol = false;   ///< Use Eisenstat-Walker adaptive tolerance
     real64 weakestTol = 1e-3;         ///< Weakest allowed tolerance when using adaptive method
+    Orthogonalization orthogonalization = Orthogonalization::mgs; ///< Orthogonalization of the GMRES basis
   }
   krylov;                             ///< Krylov-method parameter struct
 
@@ -164,6 +177,24 @@ struct LinearSolverParameters
     integer overlap = 0;   ///< Ghost overlap
   }
   dd;                      ///< Domain decomposition parameter struct
+
+  /// Chebyshev polynomial preconditioner parameters
+  struct Chebyshev
+  {
+    integer degree = 4;              ///< Degree of the polynomial (number of operator applications + 1)
+    real64 eigRatio = 30.0;          ///< Ratio of the largest to the smallest eigenvalue targeted by the polynomial
+    integer numPowerIterations = 10; ///< Number of power iterations to estimate the largest eigenvalue
+  }
+  chebyshev;                         ///< Chebyshev preconditioner parameter struct
+
+  /// Preconditioner reuse parameters (only used by the "native" iterative solvers)
+  struct PrecondReuse
+  {
+    integer maxReuse = 0;     ///< Max number of solves reusing a preconditioner after its setup (0 = no reuse)
+    real64 iterFactor = 2.0;  ///< Recompute when Krylov iterations exceed this factor times those after the last setup
+    integer refreshValues = 0; ///< Refresh only the values of a preconditioner reaching maxReuse if the sparsity is unchanged
+  }
+  precondReuse;               ///< Preconditioner reuse parameter struct
 };
 
 ENUM_STRINGS( LinearSolverParameters::SolverType,
@@ -172,8 +203,13 @@ ENUM_STRINGS( LinearSolverParameters::SolverType,
               "gmres",
               "fgmres",
               "bicgstab",
+              "pipecg",
               "preconditioner" )
 
+ENUM_STRINGS( LinearSolverParameters::Krylov::Orthogonalization,
+              "mgs",
+              "cgs2" )
+
 ENUM_STRINGS( LinearSolverParameters::PreconditionerType,
               "none",
               "jacobi",
@@ -185,7 +221,8 @@ ENUM_STRINGS( LinearSolverParameters::PreconditionerType,
               "ict",
               "amg",
               "mgr",
-              "block" )
+              "block",
+              "chebyshev" )
 
 ENUM_STRINGS( LinearSolverParameters::Direct::ColPerm,
               "none",
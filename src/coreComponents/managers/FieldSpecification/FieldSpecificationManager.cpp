@@ -58,6 +58,8 @@ void FieldSpecificationManager::ExpandObjectCatalogs()
 
 void FieldSpecificationManager::ApplyInitialConditions( Group * domain ) const
 {
+  // the initial conditions start a new run, the targets of a previous domain must not be reused
+  invalidateApplicationPlans();
 
   Apply( 0.0, domain, "", "",
          [&]( FieldSpecificationBase const * const bc,
@@ -70,4 +72,105 @@ void FieldSpecificationManager::ApplyInitialConditions( Group * domain ) const
   } );
 }
 
+FieldSpecificationManager::ApplicationPlan const &
+FieldSpecificationManager::getApplicationPlan( Group * domain,
+                                               string const & fieldPath,
+                                               string const & fieldName ) const
+{
+  MeshLevel * const meshLevel = domain->group_cast< DomainPartition * >()->getMeshBody( 0 )->getMeshLevel( 0 );
+
+  ApplicationPlan & plan = m_applicationPlans[ std::make_pair( fieldPath, fieldName ) ];
+  if( plan.mesh == meshLevel &&
+      plan.topologyVersion == meshLevel->topologyVersion() &&
+      plan.numFieldSpecifications == numSubGroups() )
+  {
+    return plan;
+  }
+
+  GEOSX_MARK_FUNCTION;
+
+  plan.mesh = meshLevel;
+  plan.topologyVersion = meshLevel->topologyVersion();
+  plan.numFieldSpecifications = numSubGroups();
+  plan.targets.clear();
+
+  // loop over all FieldSpecificationBase objects
+  for( auto & subGroup : this->GetSubGroups() )
+  {
+    FieldSpecificationBase const * fs = subGroup.second->group_cast< FieldSpecificationBase const * >();
+    int const isInitialCondition = fs->initialCondition();
+
+    if( ( isInitialCondition && fieldPath=="" && fieldName=="" ) ||
+        ( !isInitialCondition && fs->GetObjectPath().find( fieldPath ) != string::npos && fs->GetFieldName()==fieldName ) )
+    {
+      string_array const targetPath = stringutilities::Tokenize( fs->GetObjectPath(), "/" );
+      localIndex const targetPathLength = LvArray::integerConversion< localIndex >( targetPath.size());
+
+      Group * targetGroup = meshLevel;
+
+      string processedPath;
+      for( localIndex pathLevel=0; pathLevel<targetPathLength; ++pathLevel )
+      {
+        Group * const elemRegionSubGroup = targetGroup->GetGroup( ElementRegionManager::groupKeyStruct::elementRegionsGroup );
+        if( elemRegionSubGroup!=nullptr )
+        {
+          targetGroup = elemRegionSubGroup;
+        }
+
+        Group * const elemSubRegionSubGroup = targetGroup->GetGroup( ElementRegionBase::viewKeyStruct::elementSubRegions );
+        if( elemSubRegionSubGroup!=nullptr )
+        {
+          targetGroup = elemSubRegionSubGroup;
+        }
+
+        if( targetPath[pathLevel] == ElementRegionManager::groupKeyStruct::elementRegionsGroup ||
+            targetPath[pathLevel] == ElementRegionBase::viewKeyStruct::elementSubRegions )
+        {
+          continue;
+        }
+
+        targetGroup = targetGroup->GetGroup( targetPath[pathLevel] );
+        processedPath += "/" + targetPath[pathLevel];
+
+        GEOSX_ERROR_IF( targetGroup == nullptr,
+                        "ApplyBoundaryCondition(): Last entry in objectPath ("<<processedPath<<") is not found" );
+      }
+      addTargetsRecursive( targetGroup, fs, plan );
+    }
+  }
+
+  return plan;
+}
+
+void FieldSpecificationManager::addTargetsRecursive( Group * target,
+                                                     FieldSpecificationBase const * fs,
+                                                     ApplicationPlan & plan ) const
+{
+  if( ( target->getParent()->getName() == ElementRegionBase::viewKeyStruct::elementSubRegions
+        || target->getName() == "nodeManager"
+        || target->getName() == "FaceManager"
+        || target->getName() == "edgeManager" ) // TODO these 3 strings are harcoded because for the moment, there are
+                                                // inconsistencies with the name of the Managers...
+      && target->getName() != ObjectManagerBase::groupKeyStruct::setsString
+      && target->getName() != ObjectManagerBase::groupKeyStruct::neighborDataString )
+  {
+    Group const * setGroup = target->GetGroup( ObjectManagerBase::groupKeyStruct::setsString );
+    for( string const & setName : fs->GetSetNames() )
+    {
+      Wrapper< SortedArray< localIndex > > const * const setWrapper = setGroup->getWrapper< SortedArray< localIndex > >( setName );
+      if( setWrapper != nullptr )
+      {
+        plan.targets.push_back( { fs, setName, target, setWrapper } );
+      }
+    }
+  }
+  else
+  {
+    target->forSubGroups( [&]( Group & subTarget )
+    {
+      addTargetsRecursive( &subTarget, fs, plan );
+    } );
+  }
+}
+
 } /* namespace geosx */
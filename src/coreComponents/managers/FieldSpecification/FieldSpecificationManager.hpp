@@ -26,6 +26,8 @@
 #include "managers/ObjectManagerBase.hpp"
 #include "managers/DomainPartition.hpp"
 
+#include <map>
+
 namespace geosx
 {
 namespace dataRepository
@@ -214,6 +216,10 @@ public:
    * should be applied, and applies them. More specifically, this function simply checks
    * values of fieldPath,fieldName, against each FieldSpecificationBase object contained in the
    * FieldSpecificationManager and decides on whether or not to call the user defined lambda.
+   *
+   * The target groups and sets matching fieldPath and fieldName are resolved once and kept in an
+   * application plan (see getApplicationPlan()), so that subsequent calls only check the time
+   * window of each FieldSpecificationBase object before calling the lambda.
    */
   template< typename LAMBDA >
   void Apply( real64 const time,
@@ -223,60 +229,30 @@ public:
               LAMBDA && lambda ) const
   {
     GEOSX_MARK_FUNCTION;
-    // loop over all FieldSpecificationBase objects
-    for( auto & subGroup : this->GetSubGroups() )
-    {
-      FieldSpecificationBase const * fs = subGroup.second->group_cast< FieldSpecificationBase const * >();
-      int const isInitialCondition = fs->initialCondition();
 
-      if( ( isInitialCondition && fieldPath=="" ) ||
-          ( !isInitialCondition && fs->GetObjectPath().find( fieldPath ) != string::npos ) )
+    ApplicationPlan const & plan = getApplicationPlan( domain, fieldPath, fieldName );
+    for( ApplicationTarget const & target : plan.targets )
+    {
+      FieldSpecificationBase const * const fs = target.fs;
+      if( fs->initialCondition() || ( time >= fs->GetStartTime() && time < fs->GetEndTime() ) )
       {
-        string_array const targetPath = stringutilities::Tokenize( fs->GetObjectPath(), "/" );
-        localIndex const targetPathLength = LvArray::integerConversion< localIndex >( targetPath.size());
-        string const targetName = fs->GetFieldName();
-
-        if( ( isInitialCondition && fieldName=="" ) ||
-            ( !isInitialCondition && time >= fs->GetStartTime() && time < fs->GetEndTime() && targetName==fieldName ) )
-        {
-          MeshLevel * const meshLevel = domain->group_cast< DomainPartition * >()->
-                                          getMeshBody( 0 )->getMeshLevel( 0 );
-
-          dataRepository::Group * targetGroup = meshLevel;
-
-          string processedPath;
-          for( localIndex pathLevel=0; pathLevel<targetPathLength; ++pathLevel )
-          {
-            dataRepository::Group * const elemRegionSubGroup = targetGroup->GetGroup( ElementRegionManager::groupKeyStruct::elementRegionsGroup );
-            if( elemRegionSubGroup!=nullptr )
-            {
-              targetGroup = elemRegionSubGroup;
-            }
-
-            dataRepository::Group * const elemSubRegionSubGroup = targetGroup->GetGroup( ElementRegionBase::viewKeyStruct::elementSubRegions );
-            if( elemSubRegionSubGroup!=nullptr )
-            {
-              targetGroup = elemSubRegionSubGroup;
-            }
-
-            if( targetPath[pathLevel] == ElementRegionManager::groupKeyStruct::elementRegionsGroup ||
-                targetPath[pathLevel] == ElementRegionBase::viewKeyStruct::elementSubRegions )
-            {
-              continue;
-            }
-
-            targetGroup = targetGroup->GetGroup( targetPath[pathLevel] );
-            processedPath += "/" + targetPath[pathLevel];
-
-            GEOSX_ERROR_IF( targetGroup == nullptr,
-                            "ApplyBoundaryCondition(): Last entry in objectPath ("<<processedPath<<") is not found" );
-          }
-          ApplyOnTargetRecursive( targetGroup, fs, targetName, lambda );
-        }
+        SortedArrayView< localIndex const > const & targetSet = target.setWrapper->reference();
+        lambda( fs, target.setName, targetSet, target.targetGroup, fs->GetFieldName() );
       }
     }
   }
 
+  /**
+   * @brief Discard the application plans, forcing the targets to be resolved again on the next application.
+   *
+   * The plans are discarded automatically when the topology version of the mesh level changes, this
+   * function is only needed when sets or field specifications are added without a topology change.
+   */
+  void invalidateApplicationPlans() const
+  {
+    m_applicationPlans.clear();
+  }
+
 private:
   /**
    * @brief private constructor for the singleton BoundaryConditionManager.
@@ -286,41 +262,70 @@ private:
   FieldSpecificationManager( string const & name, dataRepository::Group * const parent );
   virtual ~FieldSpecificationManager() override;
 
-  template< typename LAMBDA >
-  void ApplyOnTargetRecursive( Group * target,
-                               FieldSpecificationBase const * fs,
-                               string const & targetName,
-                               LAMBDA && lambda
-                               ) const
+  /**
+   * @struct ApplicationTarget
+   * @brief A set of a target object to which a FieldSpecificationBase object is applied.
+   */
+  struct ApplicationTarget
   {
-    if( ( target->getParent()->getName() == ElementRegionBase::viewKeyStruct::elementSubRegions
-          || target->getName() == "nodeManager"
-          || target->getName() == "FaceManager"
-          || target->getName() == "edgeManager" ) // TODO these 3 strings are harcoded because for the moment, there are
-                                                  // inconsistencies with the name of the Managers...
-        && target->getName() != ObjectManagerBase::groupKeyStruct::setsString
-        && target->getName() != ObjectManagerBase::groupKeyStruct::neighborDataString )
-    {
-      dataRepository::Group const * setGroup = target->GetGroup( ObjectManagerBase::groupKeyStruct::setsString );
-      string_array setNames = fs->GetSetNames();
-      for( auto & setName : setNames )
-      {
-        dataRepository::Wrapper< SortedArray< localIndex > > const * const setWrapper = setGroup->getWrapper< SortedArray< localIndex > >( setName );
-        if( setWrapper != nullptr )
-        {
-          SortedArrayView< localIndex const > const & targetSet = setWrapper->reference();
-          lambda( fs, setName, targetSet, target, targetName );
-        }
-      }
-    }
-    else
-    {
-      target->forSubGroups( [&]( Group & subTarget )
-      {
-        ApplyOnTargetRecursive( &subTarget, fs, targetName, lambda );
-      } );
-    }
-  }
+    /// The field specification
+    FieldSpecificationBase const * fs;
+
+    /// The name of the set
+    string setName;
+
+    /// The object containing the set and the field
+    dataRepository::Group * targetGroup;
+
+    /// The wrapper of the set
+    dataRepository::Wrapper< SortedArray< localIndex > > const * setWrapper;
+  };
+
+  /**
+   * @struct ApplicationPlan
+   * @brief The targets resolved for a given fieldPath and fieldName.
+   */
+  struct ApplicationPlan
+  {
+    /// The mesh level the targets belong to
+    MeshLevel const * mesh = nullptr;
+
+    /// Topology version of the mesh level when the plan was built
+    localIndex topologyVersion = -1;
+
+    /// Number of field specifications when the plan was built
+    localIndex numFieldSpecifications = 0;
+
+    /// The targets, in the order of the field specifications, target objects and set names
+    std::vector< ApplicationTarget > targets;
+  };
+
+  /**
+   * @brief Get the application plan of a fieldPath and fieldName, building it if needed.
+   * @param domain The DomainPartition object.
+   * @param fieldPath The path to the object that contains the variable described in fieldName.
+   * @param fieldName The name of the field/variable that the value will be applied to.
+   * @return the application plan
+   *
+   * The plan is rebuilt when the topology version of the mesh level or the number of
+   * field specifications has changed since it was built.
+   */
+  ApplicationPlan const & getApplicationPlan( dataRepository::Group * domain,
+                                              string const & fieldPath,
+                                              string const & fieldName ) const;
+
+  /**
+   * @brief Add the sets of a target object, or of the objects it contains, to a plan.
+   * @param target the target object
+   * @param fs the field specification
+   * @param plan the plan
+   */
+  void addTargetsRecursive( dataRepository::Group * target,
+                            FieldSpecificationBase const * fs,
+                            ApplicationPlan & plan ) const;
+
+  /// The application plans, by fieldPath and fieldName
+  mutable std::map< std::pair< string, string >, ApplicationPlan > m_applicationPlans;
 };
 
 template< typename POLICY, typename LAMBDA >
@@ -97,29 +97,55 @@ void CompositeFunction::Evaluate( dataRepository::Group const * const group,
                                   SortedArrayView< localIndex const > const & set,
                                   real64_array & result ) const
 {
-#ifdef GEOSX_USE_MATHPRESSO
   // Evaluate each of the subFunctions independently and place the results into
   // a temporary field
-  array1d< real64_array > subFunctionResults;
-  for( localIndex ii=0; ii<m_numSubFunctions; ++ii )
+  array2d< real64 > subFunctionResults( set.size(), m_numSubFunctions );
+  real64_array tmp( set.size() );
+  for( localIndex jj=0; jj<m_numSubFunctions; ++jj )
   {
-    real64_array tmp( result.size());
-    m_subFunctions[ii]->Evaluate( group, time, set, tmp );
-    subFunctionResults.emplace_back( std::move( tmp ));
+    m_subFunctions[jj]->Evaluate( group, time, set, tmp );
+    for( localIndex i=0; i<set.size(); ++i )
+    {
+      subFunctionResults( i, jj ) = tmp[i];
+    }
   }
 
   // Evaluate the symbolic math
-  forAll< serialPolicy >( set.size(), [&, set]( localIndex const i )
+  combineSubFunctionResults( subFunctionResults.toViewConst(), result.toView() );
+}
+
+
+void CompositeFunction::EvaluateBatch( arrayView2d< real64 const > const & input,
+                                       arrayView1d< real64 > const & result ) const
+{
+  GEOSX_ERROR_IF( result.size() != input.size( 0 ), "The size of the result and the number of points must match" );
+
+  array2d< real64 > subFunctionResults( input.size( 0 ), m_numSubFunctions );
+  real64_array tmp( input.size( 0 ) );
+  for( localIndex jj=0; jj<m_numSubFunctions; ++jj )
   {
-    localIndex const ii = set[ i ];
-    real64 functionResults[m_maxNumSubFunctions];
-    for( localIndex jj=0; jj<m_numSubFunctions; ++jj )
+    m_subFunctions[jj]->EvaluateBatch( input, tmp.toView() );
+    for( localIndex i=0; i<input.size( 0 ); ++i )
     {
-      functionResults[jj] = subFunctionResults[jj][ii];
+      subFunctionResults( i, jj ) = tmp[i];
     }
-    result[ii] = parserExpression.evaluate( reinterpret_cast< void * >( functionResults ));
+  }
+
+  combineSubFunctionResults( subFunctionResults.toViewConst(), result );
+}
+
+
+void CompositeFunction::combineSubFunctionResults( arrayView2d< real64 const > const & subFunctionResults,
+                                                   arrayView1d< real64 > const & result ) const
+{
+#ifdef GEOSX_USE_MATHPRESSO
+  mathpresso::Expression const & expression = parserExpression;
+  forAll< parallelHostPolicy >( subFunctionResults.size( 0 ), [=, &expression]( localIndex const i )
+  {
+    result[i] = expression.evaluate( reinterpret_cast< void * >( const_cast< real64 * >( subFunctionResults[i].dataIfContiguous() ) ) );
   } );
 #else
+  GEOSX_UNUSED_VAR( subFunctionResults, result );
   GEOSX_ERROR( "GEOSX was not configured with mathpresso!" );
 #endif
 }
@@ -75,8 +75,27 @@ public:
    */
   virtual real64 Evaluate( real64 const * const input ) const override final;
 
+  /**
+   * @brief Method to evaluate a function on a batch of points
+   * @param input the inputs of the points (numPoints x numInputs)
+   * @param result an array to hold the result at each point
+   *
+   * Each sub function is evaluated on the whole batch before the expression combines the results.
+   */
+  virtual void EvaluateBatch( arrayView2d< real64 const > const & input,
+                              arrayView1d< real64 > const & result ) const override final;
+
 private:
 
+  /**
+   * @brief Combine the results of the sub functions with the expression
+   * @param subFunctionResults the result of each sub function at each point (numPoints x numSubFunctions)
+   * @param result an array to hold the result at each point
+   */
+  void combineSubFunctionResults( arrayView2d< real64 const > const & subFunctionResults,
+                                  arrayView1d< real64 > const & result ) const;
+
+
   string_array m_functionNames;
   string_array m_variableNames;
   string m_expression;
@@ -71,6 +71,18 @@ integer FunctionBase::isFunctionOfTime() const
 }
 
 
+void FunctionBase::EvaluateBatch( arrayView2d< real64 const > const & input,
+                                  arrayView1d< real64 > const & result ) const
+{
+  GEOSX_ERROR_IF( result.size() != input.size( 0 ), "The size of the result and the number of points must match" );
+
+  forAll< parallelHostPolicy >( input.size( 0 ), [=]( localIndex const i )
+  {
+    result[i] = Evaluate( input[i].dataIfContiguous() );
+  } );
+}
+
+
 real64_array FunctionBase::EvaluateStats( dataRepository::Group const * const group,
                                           real64 const time,
                                           SortedArray< localIndex > const & set ) const
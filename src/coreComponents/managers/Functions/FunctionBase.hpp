@@ -93,6 +93,17 @@ public:
    */
   virtual real64 Evaluate( real64 const * const input ) const = 0;
 
+  /**
+   * @brief Method to evaluate a function on a batch of points
+   * @param input the inputs of the points (numPoints x numInputs), each row holding the input of one point
+   * @param result an array to hold the result at each point (numPoints)
+   *
+   * The default implementation calls Evaluate( real64 const * const ) on each point with
+   * parallelHostPolicy. Derived classes may override it to share work between the points.
+   */
+  virtual void EvaluateBatch( arrayView2d< real64 const > const & input,
+                              arrayView1d< real64 > const & result ) const;
+
   /// Alias for the catalog interface
   using CatalogInterface = dataRepository::CatalogInterface< FunctionBase, std::string const &, Group * const >;
 
@@ -189,24 +200,25 @@ void FunctionBase::EvaluateT( dataRepository::Group const * const group,
   // Make sure the result / set size match
   GEOSX_ERROR_IF( result.size() != set.size(), "To apply a function to a set, the size of the result and set must match" );
 
-
-  forAll< serialPolicy >( set.size(), [&, set]( localIndex const i )
+  // Gather the input of each point of the set in a row, then evaluate all the points at once
+  array2d< real64 > input( set.size(), totalVarSize );
+  arrayView2d< real64 > const & inputView = input.toView();
+  forAll< parallelHostPolicy >( set.size(), [=]( localIndex const i )
   {
     localIndex const index = set[ i ];
-    double input[4];
     int c = 0;
     for( int a=0; a<numVars; ++a )
     {
       for( int b=0; b<varSize[a]; ++b )
       {
-        input[c] = input_ptrs[a][(index*varSize[a]+b)*timeVar[a]];
+        inputView( i, c ) = input_ptrs[a][(index*varSize[a]+b)*timeVar[a]];
         ++c;
       }
     }
-
-    // Note: we expect that result is the same size as the set
-    result[i] = static_cast< LEAF const * >(this)->Evaluate( input );
   } );
+
+  // Note: we expect that result is the same size as the set
+  static_cast< LEAF const * >(this)->LEAF::EvaluateBatch( input.toViewConst(), result.toView() );
 }
 } /* namespace geosx */
 
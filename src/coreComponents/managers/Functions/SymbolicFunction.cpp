@@ -77,6 +77,25 @@ void SymbolicFunction::InitializeFunction()
 #endif
 }
 
+void SymbolicFunction::EvaluateBatch( arrayView2d< real64 const > const & input,
+                                      arrayView1d< real64 > const & result ) const
+{
+  GEOSX_ERROR_IF( result.size() != input.size( 0 ), "The size of the result and the number of points must match" );
+
+#ifdef GEOSX_USE_MATHPRESSO
+  GEOSX_ERROR_IF( input.size( 1 ) < m_variableNames.size(), "Symbolic function input size is: " << input.size( 1 ) );
+
+  // The compiled expression has no state, the points can be evaluated concurrently
+  mathpresso::Expression const & expression = parserExpression;
+  forAll< parallelHostPolicy >( input.size( 0 ), [=, &expression]( localIndex const i )
+  {
+    result[i] = expression.evaluate( reinterpret_cast< void * >( const_cast< real64 * >( input[i].dataIfContiguous() ) ) );
+  } );
+#else
+  GEOSX_ERROR( "GEOSX was not built with mathpresso!" );
+#endif
+}
+
 
 REGISTER_CATALOG_ENTRY( FunctionBase, SymbolicFunction, std::string const &, Group * const )
 
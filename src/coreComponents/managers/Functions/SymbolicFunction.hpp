@@ -86,6 +86,16 @@ public:
 #endif
   }
 
+  /**
+   * @brief Method to evaluate a function on a batch of points
+   * @param input the inputs of the points (numPoints x numInputs)
+   * @param result an array to hold the result at each point
+   *
+   * The compiled expression reads the variables of each point directly from its row of @p input.
+   */
+  virtual void EvaluateBatch( arrayView2d< real64 const > const & input,
+                              arrayView1d< real64 > const & result ) const override final;
+
 
   /**
    * @brief Set the symbolic variable names
@@ -19,6 +19,7 @@
 #include "TableFunction.hpp"
 #include "common/DataTypes.hpp"
 #include <algorithm>
+#include <cmath>
 
 namespace geosx
 {
@@ -52,8 +53,9 @@ TableFunction::TableFunction( const std::string & name,
   m_dimensions( 0 ),
   m_size(),
   m_indexIncrement(),
-  m_corners(),
-  m_numCorners( 0 )
+  m_flatCoordinates(),
+  m_coordinateOffsets(),
+  m_axisInvSpacing()
 {
   registerWrapper( keys::tableCoordinates, &m_tableCoordinates1D )->
     setInputFlag( InputFlags::OPTIONAL )->
@@ -167,139 +169,81 @@ void TableFunction::reInitializeFunction()
 
   // Error checking
   GEOSX_ERROR_IF( increment != m_values.size(), "Table dimensions do not match!" );
+  GEOSX_ERROR_IF( m_dimensions > m_maxDimensions, "Table function has more than " << m_maxDimensions << " dimensions" );
 
-  // Build a quick map to help with linear interpolation
-  m_numCorners = static_cast< localIndex >(pow( 2, m_dimensions ));
-  for( localIndex ii=0; ii<m_numCorners; ++ii )
+  // Gather the axes in a single array, and detect the uniformly spaced ones
+  m_flatCoordinates.clear();
+  m_coordinateOffsets.resize( m_dimensions );
+  m_axisInvSpacing.resize( m_dimensions );
+  for( localIndex ii=0; ii<m_dimensions; ++ii )
   {
-    for( localIndex jj=0; jj<m_dimensions; ++jj )
+    real64_array const & coordinates = m_coordinates[ii];
+    GEOSX_ERROR_IF( m_size[ii] == 0, "Table function axis " << ii << " is empty" );
+
+    m_coordinateOffsets[ii] = m_flatCoordinates.size();
+    for( localIndex jj=0; jj<m_size[ii]; ++jj )
     {
-      m_corners[jj][ii] = int(ii / pow( 2, jj )) % 2;
+      m_flatCoordinates.emplace_back( coordinates[jj] );
+    }
+
+    m_axisInvSpacing[ii] = 0.0;
+    if( m_size[ii] > 1 )
+    {
+      real64 const spacing = ( coordinates[m_size[ii] - 1] - coordinates[0] ) / ( m_size[ii] - 1 );
+      bool isUniform = spacing > 0.0;
+      for( localIndex jj=1; jj<m_size[ii] && isUniform; ++jj )
+      {
+        isUniform = std::abs( coordinates[jj] - ( coordinates[0] + jj * spacing ) ) <= 1e-10 * spacing;
+      }
+      m_axisInvSpacing[ii] = isUniform ? 1.0 / spacing : 0.0;
     }
   }
 }
 
 
-real64 TableFunction::Evaluate( real64 const * const input ) const
+TableFunction::KernelWrapper TableFunction::createKernelWrapper() const
 {
-  real64 result = 0.0;
+  return KernelWrapper( *this );
+}
 
-  // Linear interpolation
-  if( m_interpolationMethod == InterpolationType::Linear )
-  {
-    localIndex bounds[m_maxDimensions][2];
-    real64 weights[m_maxDimensions][2];
 
-    // Determine position, weights
-    for( localIndex ii=0; ii<m_dimensions; ++ii )
-    {
-      if( input[ii] <= m_coordinates[ii][0] )
-      {
-        // Coordinate is to the left of this axis
-        bounds[ii][0] = 0;
-        bounds[ii][1] = 0;
-        weights[ii][0] = 0;
-        weights[ii][1] = 1;
-      }
-      else if( input[ii] >= m_coordinates[ii][m_size[ii] - 1] )
-      {
-        // Coordinate is to the right of this axis
-        bounds[ii][0] = m_size[ii] - 1;
-        bounds[ii][1] = bounds[ii][0];
-        weights[ii][0] = 1;
-        weights[ii][1] = 0;
-      }
-      else
-      {
-        // Find the coordinate index
-        ///TODO make this fast
-        // Note: lower_bound uses a binary search...  If we assume coordinates are
-        // evenly spaced, we can speed things up considerably
-        auto lower = std::lower_bound( m_coordinates[ii].begin(), m_coordinates[ii].end(), input[ii] );
-        bounds[ii][1] = LvArray::integerConversion< localIndex >( std::distance( m_coordinates[ii].begin(), lower ));
-        bounds[ii][0] = bounds[ii][1] - 1;
-
-        real64 dx = m_coordinates[ii][bounds[ii][1]] - m_coordinates[ii][bounds[ii][0]];
-        weights[ii][0] = 1.0 - (input[ii] - m_coordinates[ii][bounds[ii][0]]) / dx;
-        weights[ii][1] = 1.0 - weights[ii][0];
-      }
-    }
+real64 TableFunction::Evaluate( real64 const * const input ) const
+{
+  return createKernelWrapper().Compute( input );
+}
 
-    // Calculate the result
-    for( localIndex ii=0; ii<m_numCorners; ++ii )
-    {
-      // Find array index
-      localIndex tableIndex = 0;
-      for( localIndex jj=0; jj<m_dimensions; ++jj )
-      {
-        tableIndex += bounds[jj][m_corners[jj][ii]] * m_indexIncrement[jj];
-      }
 
-      // Determine weighted value
-      real64 cornerValue = m_values[tableIndex];
-      for( localIndex jj=0; jj<m_dimensions; ++jj )
-      {
-        cornerValue *= weights[jj][m_corners[jj][ii]];
-      }
-      result += cornerValue;
-    }
-  }
-  // Nearest, Upper, Lower interpolation methods
-  else
-  {
-    // Determine the index to the nearest table entry
-    localIndex tableIndex = 0;
-    for( localIndex ii=0; ii<m_dimensions; ++ii )
-    {
-      // Determine the index along each table axis
-      localIndex subIndex = 0;
+void TableFunction::EvaluateBatch( arrayView2d< real64 const > const & input,
+                                   arrayView1d< real64 > const & result ) const
+{
+  GEOSX_ERROR_IF( result.size() != input.size( 0 ), "The size of the result and the number of points must match" );
+  GEOSX_ERROR_IF( input.size( 1 ) < m_dimensions, "Table function input size is: " << input.size( 1 ) );
 
-      if( input[ii] <= m_coordinates[ii][0] )
-      {
-        // Coordinate is to the left of the table axis
-        subIndex = 0;
-      }
-      else if( input[ii] >= m_coordinates[ii][m_size[ii] - 1] )
-      {
-        // Coordinate is to the right of the table axis
-        subIndex = m_size[ii] - 1;
-      }
-      else
-      {
-        // Coordinate is within the table axis
-        // Note: std::distance will return the index of the upper table vertex
-        auto lower = std::lower_bound( m_coordinates[ii].begin(), m_coordinates[ii].end(), input[ii] );
-        subIndex = LvArray::integerConversion< localIndex >( std::distance( m_coordinates[ii].begin(), lower ));
-
-        // Interpolation types:
-        //   - Nearest returns the value of the closest table vertex
-        //   - Upper returns the value of the next table vertex
-        //   - Lower returns the value of the previous table vertex
-        if( m_interpolationMethod == InterpolationType::Nearest )
-        {
-          if((input[ii] - m_coordinates[ii][subIndex - 1]) <= (m_coordinates[ii][subIndex] - input[ii]))
-          {
-            --subIndex;
-          }
-        }
-        else if( m_interpolationMethod == InterpolationType::Lower )
-        {
-          if( subIndex > 0 )
-          {
-            --subIndex;
-          }
-        }
-      }
+  KernelWrapper const table = createKernelWrapper();
+  forAll< parallelHostPolicy >( input.size( 0 ), [=]( localIndex const i )
+  {
+    result[i] = table.Compute( input[i].dataIfContiguous() );
+  } );
+}
 
-      // Increment the global table index
-      tableIndex += subIndex * m_indexIncrement[ii];
-    }
 
-    // Retrieve the nearest value
-    result = m_values[tableIndex];
+TableFunctionKernelWrapper::TableFunctionKernelWrapper( TableFunction const & table ):
+  m_interpolationMethod( table.m_interpolationMethod ),
+  m_dimensions( table.m_dimensions ),
+  m_size(),
+  m_indexIncrement(),
+  m_coordinateOffsets(),
+  m_axisInvSpacing(),
+  m_coordinates( table.m_flatCoordinates.toViewConst() ),
+  m_values( table.m_values.toViewConst() )
+{
+  for( localIndex ii=0; ii<m_dimensions; ++ii )
+  {
+    m_size[ii] = table.m_size[ii];
+    m_indexIncrement[ii] = table.m_indexIncrement[ii];
+    m_coordinateOffsets[ii] = table.m_coordinateOffsets[ii];
+    m_axisInvSpacing[ii] = table.m_axisInvSpacing[ii];
   }
-
-  return result;
 }
 
 REGISTER_CATALOG_ENTRY( FunctionBase, TableFunction, std::string const &, Group * const )
@@ -25,6 +25,8 @@
 namespace geosx
 {
 
+class TableFunctionKernelWrapper;
+
 /**
  * @class TableFunction
  *
@@ -95,6 +97,25 @@ public:
    */
   virtual real64 Evaluate( real64 const * const input ) const override final;
 
+  /**
+   * @brief Method to evaluate a function on a batch of points
+   * @param input the inputs of the points (numPoints x numInputs)
+   * @param result an array to hold the result at each point
+   */
+  virtual void EvaluateBatch( arrayView2d< real64 const > const & input,
+                              arrayView1d< real64 > const & result ) const override final;
+
+  /// Type of kernel wrapper for in-kernel evaluation
+  using KernelWrapper = TableFunctionKernelWrapper;
+
+  /**
+   * @brief Create a kernel wrapper evaluating the table, which can be captured in device kernels.
+   * @return the wrapper
+   *
+   * The wrapper holds views on the table, it must be created again after reInitializeFunction().
+   */
+  KernelWrapper createKernelWrapper() const;
+
   /**
    * @brief Get the table axes definitions
    * @return a reference to an array of arrays that define each table axis
@@ -175,14 +196,219 @@ private:
   /// Array used to locate values within ND tables
   localIndex_array m_indexIncrement;
 
+  /// The coordinates of all the axes, one after the other
+  real64_array m_flatCoordinates;
+
+  /// Offset of each axis in m_flatCoordinates
+  localIndex_array m_coordinateOffsets;
+
+  /// Inverse of the spacing of each axis, or zero if the axis is not uniformly spaced
+  real64_array m_axisInvSpacing;
+
+  friend class TableFunctionKernelWrapper;
+};
+
+/**
+ * @class TableFunctionKernelWrapper
+ * @brief A copyable view of a TableFunction evaluating it on host or device.
+ *
+ * The point is located on uniformly spaced axes by index arithmetic, and by a binary search otherwise.
+ */
+class TableFunctionKernelWrapper
+{
+public:
+
   /**
-   * @brief The corners of the box that surround the value in N dimensions
-   * m_corners should be of size m_maxDimensions x (2^m_maxDimensions)
+   * @brief Constructor.
+   * @param table the table function
    */
-  localIndex m_corners[m_maxDimensions][16];
+  explicit TableFunctionKernelWrapper( TableFunction const & table );
+
+  /// Default copy constructor
+  TableFunctionKernelWrapper( TableFunctionKernelWrapper const & ) = default;
+
+  /// Default move constructor
+  TableFunctionKernelWrapper( TableFunctionKernelWrapper && ) = default;
+
+  /// Deleted copy assignment operator
+  TableFunctionKernelWrapper & operator=( TableFunctionKernelWrapper const & ) = delete;
+
+  /// Deleted move assignment operator
+  TableFunctionKernelWrapper & operator=( TableFunctionKernelWrapper && ) = delete;
 
-  /// The number of active table corners
-  localIndex m_numCorners;
+  /**
+   * @brief Evaluate the table.
+   * @param input the coordinates of the point, one per table dimension
+   * @return the interpolated value
+   */
+  GEOSX_HOST_DEVICE
+  real64 Compute( real64 const * const input ) const
+  {
+    if( m_interpolationMethod == TableFunction::InterpolationType::Linear )
+    {
+      localIndex bounds[TableFunction::m_maxDimensions][2];
+      real64 weights[TableFunction::m_maxDimensions][2];
+
+      // Determine position, weights
+      for( localIndex ii=0; ii<m_dimensions; ++ii )
+      {
+        real64 const * const coordinates = &m_coordinates[ m_coordinateOffsets[ii] ];
+        if( input[ii] <= coordinates[0] )
+        {
+          // Coordinate is to the left of this axis
+          bounds[ii][0] = 0;
+          bounds[ii][1] = 0;
+          weights[ii][0] = 0;
+          weights[ii][1] = 1;
+        }
+        else if( input[ii] >= coordinates[m_size[ii] - 1] )
+        {
+          // Coordinate is to the right of this axis
+          bounds[ii][0] = m_size[ii] - 1;
+          bounds[ii][1] = bounds[ii][0];
+          weights[ii][0] = 1;
+          weights[ii][1] = 0;
+        }
+        else
+        {
+          bounds[ii][1] = upperIndex( ii, input[ii] );
+          bounds[ii][0] = bounds[ii][1] - 1;
+
+          real64 const dx = coordinates[bounds[ii][1]] - coordinates[bounds[ii][0]];
+          weights[ii][0] = 1.0 - (input[ii] - coordinates[bounds[ii][0]]) / dx;
+          weights[ii][1] = 1.0 - weights[ii][0];
+        }
+      }
+
+      // Sum the weighted values of the corners of the cell, bit jj of a corner giving its side along axis jj
+      real64 result = 0.0;
+      for( localIndex corner=0; corner<(localIndex( 1 ) << m_dimensions); ++corner )
+      {
+        localIndex tableIndex = 0;
+        real64 cornerWeight = 1.0;
+        for( localIndex jj=0; jj<m_dimensions; ++jj )
+        {
+          localIndex const side = ( corner >> jj ) & 1;
+          tableIndex += bounds[jj][side] * m_indexIncrement[jj];
+          cornerWeight *= weights[jj][side];
+        }
+        result += cornerWeight * m_values[tableIndex];
+      }
+      return result;
+    }
+
+    // Nearest, Upper, Lower interpolation methods
+    localIndex tableIndex = 0;
+    for( localIndex ii=0; ii<m_dimensions; ++ii )
+    {
+      real64 const * const coordinates = &m_coordinates[ m_coordinateOffsets[ii] ];
+      localIndex subIndex = 0;
+      if( input[ii] <= coordinates[0] )
+      {
+        // Coordinate is to the left of the table axis
+        subIndex = 0;
+      }
+      else if( input[ii] >= coordinates[m_size[ii] - 1] )
+      {
+        // Coordinate is to the right of the table axis
+        subIndex = m_size[ii] - 1;
+      }
+      else
+      {
+        // Coordinate is within the table axis, subIndex is the upper table vertex
+        //   - Nearest returns the value of the closest table vertex
+        //   - Upper returns the value of the next table vertex
+        //   - Lower returns the value of the previous table vertex
+        subIndex = upperIndex( ii, input[ii] );
+        if( m_interpolationMethod == TableFunction::InterpolationType::Nearest )
+        {
+          if( (input[ii] - coordinates[subIndex - 1]) <= (coordinates[subIndex] - input[ii]) )
+          {
+            --subIndex;
+          }
+        }
+        else if( m_interpolationMethod == TableFunction::InterpolationType::Lower )
+        {
+          --subIndex;
+        }
+      }
+      tableIndex += subIndex * m_indexIncrement[ii];
+    }
+    return m_values[tableIndex];
+  }
+
+private:
+
+  /**
+   * @brief Find the first vertex of an axis not lower than a coordinate strictly inside the axis.
+   * @param dim the axis
+   * @param x the coordinate
+   * @return the index of the vertex, between 1 and the size of the axis minus 1
+   */
+  GEOSX_HOST_DEVICE
+  localIndex upperIndex( localIndex const dim, real64 const x ) const
+  {
+    real64 const * const coordinates = &m_coordinates[ m_coordinateOffsets[dim] ];
+    localIndex const last = m_size[dim] - 1;
+
+    if( m_axisInvSpacing[dim] > 0.0 )
+    {
+      // Uniform axis: the guess is exact up to rounding, which the corrections below fix
+      real64 const position = ( x - coordinates[0] ) * m_axisInvSpacing[dim];
+      localIndex index = static_cast< localIndex >( position ) + 1;
+      index = index < 1 ? 1 : ( index > last ? last : index );
+      while( index > 1 && coordinates[index - 1] >= x )
+      {
+        --index;
+      }
+      while( index < last && coordinates[index] < x )
+      {
+        ++index;
+      }
+      return index;
+    }
+
+    // Binary search
+    localIndex lower = 0;
+    localIndex upper = last;
+    while( upper - lower > 1 )
+    {
+      localIndex const middle = ( lower + upper ) / 2;
+      if( coordinates[middle] < x )
+      {
+        lower = middle;
+      }
+      else
+      {
+        upper = middle;
+      }
+    }
+    return upper;
+  }
+
+  /// Table interpolation method
+  TableFunction::InterpolationType m_interpolationMethod;
+
+  /// Number of active table dimensions
+  localIndex m_dimensions;
+
+  /// Size of each axis
+  localIndex m_size[TableFunction::m_maxDimensions];
+
+  /// Increment of the table index along each axis
+  localIndex m_indexIncrement[TableFunction::m_maxDimensions];
+
+  /// Offset of each axis in m_coordinates
+  localIndex m_coordinateOffsets[TableFunction::m_maxDimensions];
+
+  /// Inverse of the spacing of each axis, or zero if the axis is not uniformly spaced
+  real64 m_axisInvSpacing[TableFunction::m_maxDimensions];
+
+  /// The coordinates of all the axes
+  arrayView1d< real64 const > m_coordinates;
+
+  /// Table values (in fortran order)
+  arrayView1d< real64 const > m_values;
 };
 
 ENUM_STRINGS( TableFunction::InterpolationType, "linear", "nearest", "upper", "lower" )
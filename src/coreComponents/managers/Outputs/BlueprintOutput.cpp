@@ -93,6 +93,8 @@ BlueprintOutput::BlueprintOutput( std::string const & name,
     setInputFlag( dataRepository::InputFlags::OPTIONAL )->
     setDescription( "Determines which fields to write." );
 
+  enableAsyncWrites();
+
   registerWrapper( "outputFullQuadratureData", &m_outputFullQuadratureData )->
     setApplyDefaultValue( false )->
     setInputFlag( dataRepository::InputFlags::OPTIONAL )->
@@ -147,8 +149,8 @@ void BlueprintOutput::Execute( real64 const time,
   /// Write out the root index file, then write out the mesh.
   char buffer[ 128 ];
   GEOSX_ERROR_IF_GE( snprintf( buffer, 128, "blueprintFiles/cycle_%07d", cycle ), 128 );
-  std::string const filePathForRank = dataRepository::writeRootFile( fileRoot, buffer );
-  conduit::relay::io::save( meshRoot, filePathForRank, "hdf5" );
+  std::string const filePathForRank = dataRepository::writeRootFile( fileRoot, buffer, maxAsyncWrites() );
+  dataRepository::writeNode( meshRoot, filePathForRank, maxAsyncWrites() );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
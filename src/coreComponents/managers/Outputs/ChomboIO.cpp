@@ -17,6 +17,7 @@
  * @file ChomboIO.cpp
  */
 #include "ChomboIO.hpp"
+#include "common/BackgroundWriter.hpp"
 #include "mesh/MeshLevel.hpp"
 #include "managers/DomainPartition.hpp"
 #include "fileIO/coupling/ChomboCoupler.hpp"
@@ -89,6 +90,8 @@ void ChomboIO::Execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
     return;
   }
 
+  // The coupler writes through HDF5, which must not be called concurrently with the background writes.
+  BackgroundWriter::get().wait();
   m_coupler->write( dt );
 
   if( m_waitForInput )
@@ -29,7 +29,8 @@ OutputBase::OutputBase( std::string const & name,
                         Group * const parent ):
   ExecutableGroup( name, parent ),
   m_childDirectory(),
-  m_parallelThreads( 1 )
+  m_parallelThreads( 1 ),
+  m_maxAsyncWrites( 0 )
 {
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
 
@@ -47,6 +48,16 @@ OutputBase::OutputBase( std::string const & name,
 OutputBase::~OutputBase()
 {}
 
+void OutputBase::enableAsyncWrites()
+{
+  registerWrapper( viewKeysStruct::maxAsyncWritesString, &m_maxAsyncWrites )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Maximum number of output snapshots written by a background I/O thread while the simulation "
+                    "continues. When the limit is reached, the next output waits for the oldest write to complete. "
+                    "The default writes the output synchronously." );
+}
+
 OutputBase::CatalogInterface::CatalogType & OutputBase::GetCatalog()
 {
   static OutputBase::CatalogInterface::CatalogType catalog;
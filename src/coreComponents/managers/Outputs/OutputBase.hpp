@@ -58,6 +58,7 @@ public:
   {
     static constexpr auto childDirectoryString = "childDirectory";
     static constexpr auto parallelThreadsString = "parallelThreads";
+    static constexpr auto maxAsyncWritesString = "maxAsyncWrites";
   } outputBaseViewKeys;
   /// @endcond
 
@@ -73,7 +74,18 @@ public:
    **/
   integer parallelThreads() const { return m_parallelThreads; }
 
+  /**
+   * @brief Get the maximum number of output snapshots written in the background
+   * @return The maximum number of writes in flight, 0 if the output is written synchronously
+   **/
+  integer maxAsyncWrites() const { return m_maxAsyncWrites; }
+
 protected:
+
+  /// Enable the input of the number of output snapshots written in the background.
+  /// To be called by the outputs that only write copies of their data in the background.
+  void enableAsyncWrites();
+
   /**
    * @brief Do initialization prior to calling initialization operations
    *        on the subgroups.
@@ -84,6 +96,7 @@ protected:
 private:
   string m_childDirectory;
   integer m_parallelThreads;
+  integer m_maxAsyncWrites;
 
 };
 
@@ -31,8 +31,17 @@ using namespace dataRepository;
 
 RestartOutput::RestartOutput( std::string const & name,
                               Group * const parent ):
-  OutputBase( name, parent )
-{}
+  OutputBase( name, parent ),
+  m_ranksPerFile( 1 )
+{
+  registerWrapper( viewKeyStruct::ranksPerFileString, &m_ranksPerFile )->
+    setApplyDefaultValue( 1 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of ranks whose data is gathered and written to the same restart file. "
+                    "The default writes one file per rank." );
+
+  enableAsyncWrites();
+}
 
 RestartOutput::~RestartOutput()
 {}
@@ -57,7 +66,7 @@ void RestartOutput::Execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
   problemManager->prepareToWrite();
   FunctionManager::Instance().prepareToWrite();
   FieldSpecificationManager::get().prepareToWrite();
-  writeTree( fileName );
+  writeTree( fileName, m_ranksPerFile, maxAsyncWrites() );
   problemManager->finishWriting();
   FunctionManager::Instance().finishWriting();
   FieldSpecificationManager::get().finishWriting();
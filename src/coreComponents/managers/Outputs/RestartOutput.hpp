@@ -74,9 +74,16 @@ public:
   /// @cond DO_NOT_DOCUMENT
   struct viewKeyStruct
   {
+    static constexpr auto ranksPerFileString = "ranksPerFile";
+
     dataRepository::ViewKey writeFEMFaces = { "writeFEMFaces" };
   } viewKeys;
   /// @endcond
+
+private:
+
+  /// Number of ranks whose data is aggregated in each restart file
+  integer m_ranksPerFile;
 };
 
 
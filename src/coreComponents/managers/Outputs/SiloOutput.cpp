@@ -18,6 +18,7 @@
 
 #include "SiloOutput.hpp"
 
+#include "common/BackgroundWriter.hpp"
 #include "common/TimingMacros.hpp"
 #include "fileIO/silo/SiloFile.hpp"
 #include "managers/DomainPartition.hpp"
@@ -84,6 +85,9 @@ void SiloOutput::Execute( real64 const time_n,
 {
   GEOSX_MARK_FUNCTION;
 
+  // Silo writes through HDF5, which must not be called concurrently with the background writes.
+  BackgroundWriter::get().wait();
+
   DomainPartition * domainPartition = Group::group_cast< DomainPartition * >( domain );
   SiloFile silo;
 
@@ -1,4 +1,7 @@
 #include "TimeHistoryOutput.hpp"
+
+#include "common/BackgroundWriter.hpp"
+
 namespace geosx
 {
 TimeHistoryOutput::TimeHistoryOutput( string const & name,
@@ -103,6 +106,10 @@ void TimeHistoryOutput::Execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
                                  dataRepository::Group * GEOSX_UNUSED_PARAM( domain ) )
 {
   GEOSX_MARK_FUNCTION;
+
+  // The history is written through HDF5, which must not be called concurrently with the background writes.
+  BackgroundWriter::get().wait();
+
   localIndex newBuffered = m_io.front()->getBufferedCount( );
   for( auto & th_io : m_io )
   {
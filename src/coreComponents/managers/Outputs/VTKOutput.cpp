@@ -50,6 +50,8 @@ VTKOutput::VTKOutput( std::string const & name,
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Output the data in binary format" );
 
+  enableAsyncWrites();
+
 }
 
 VTKOutput::~VTKOutput()
@@ -74,6 +76,7 @@ void VTKOutput::Execute( real64 const time_n,
     m_writer.SetOutputMode( vtk::VTKOutputMode::ASCII );
   }
   m_writer.SetPlotLevel( m_plotLevel );
+  m_writer.SetMaxAsyncWrites( maxAsyncWrites() );
   m_writer.Write( time_n, cycleNumber, *domainPartition );
 }
 
@@ -16,6 +16,7 @@
 #include "ProblemManager.hpp"
 
 #include "codingUtilities/StringUtilities.hpp"
+#include "common/BackgroundWriter.hpp"
 #include "common/Path.hpp"
 #include "common/TimingMacros.hpp"
 #include "constitutive/ConstitutiveManager.hpp"
@@ -28,6 +29,7 @@
 #include "managers/initialization.hpp"
 #include "managers/NumericalMethodsManager.hpp"
 #include "managers/Outputs/OutputManager.hpp"
+#include "managers/RestartRedistribution.hpp"
 #include "managers/Tasks/TasksManager.hpp"
 #include "mesh/MeshBody.hpp"
 #include "meshUtilities/MeshManager.hpp"
@@ -597,7 +599,7 @@ void ProblemManager::GenerateMesh()
       GeometricObjectManager * geometricObjects = this->GetGroup< GeometricObjectManager >( groupKeys.geometricObjectManager );
 
       MeshUtilities::GenerateNodesets( geometricObjects,
-                                       nodeManager );
+                                       *meshLevel );
       nodeManager->ConstructGlobalToLocalMap();
 
       elemManager->GenerateMesh( cellBlockManager );
@@ -789,6 +791,9 @@ void ProblemManager::RunSimulation()
 {
   DomainPartition * domain = getDomainPartition();
   m_eventManager->Run( domain );
+
+  // Complete the outputs written in the background.
+  BackgroundWriter::get().wait();
 }
 
 DomainPartition * ProblemManager::getDomainPartition()
@@ -809,8 +814,32 @@ void ProblemManager::ApplyInitialConditions()
 
 void ProblemManager::ReadRestartOverwrite()
 {
-  this->loadFromConduit();
-  this->postRestartInitializationRecursive( GetGroup< DomainPartition >( keys::domain ) );
+  DomainPartition & domain = *GetGroup< DomainPartition >( keys::domain );
+
+  if( getRestartNumberOfRanks() == MpiWrapper::Comm_size() )
+  {
+    this->loadFromConduit();
+  }
+  else
+  {
+    // The mesh data depends on the partitioning: keep the mesh regenerated from the input and
+    // overwrite its fields with the data redistributed from all the restart files.
+    Group & meshBodies = *domain.getMeshBodies();
+    Group & cellManager = *domain.GetGroup( keys::cellManager );
+    RestartFlags const meshBodiesFlags = meshBodies.getRestartFlags();
+    RestartFlags const cellManagerFlags = cellManager.getRestartFlags();
+    meshBodies.setRestartFlags( RestartFlags::WRITE );
+    cellManager.setRestartFlags( RestartFlags::WRITE );
+
+    this->loadFromConduit();
+
+    meshBodies.setRestartFlags( meshBodiesFlags );
+    cellManager.setRestartFlags( cellManagerFlags );
+
+    redistributeRestartMeshData( domain );
+  }
+
+  this->postRestartInitializationRecursive( &domain );
 }
 
 } /* namespace geosx */
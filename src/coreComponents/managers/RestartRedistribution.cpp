@@ -0,0 +1,575 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file RestartRedistribution.cpp
+ */
+
+#include "RestartRedistribution.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "dataRepository/ConduitRestart.hpp"
+#include "dataRepository/wrapperHelpers.hpp"
+#include "managers/DomainPartition.hpp"
+#include "mesh/MeshBody.hpp"
+#include "mesh/MeshLevel.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#include <map>
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+namespace
+{
+
+/// The key identifying an object independently of the partitioning.
+using ObjectKey = std::vector< globalIndex >;
+
+/// The buffer type used for the exchanges.
+using Buffer = std::vector< buffer_unit_type >;
+
+/// How the key of the objects of an object manager is built.
+enum class KeyType : integer
+{
+  GlobalIndex, ///< the global index of the object
+  EdgeNodes,   ///< the sorted global indices of the nodes of the edge
+  FaceNodes    ///< the sorted global indices of the nodes of the face
+};
+
+/// An object manager of the mesh whose fields are redistributed.
+struct Target
+{
+  /// The object manager in the regenerated mesh.
+  ObjectManagerBase * manager;
+
+  /// The type of the keys of the objects.
+  KeyType keyType;
+
+  /// The node manager of the mesh level, providing the node global indices of the EdgeNodes and FaceNodes keys.
+  NodeManager * nodeManager;
+
+  /// The fields transferred.
+  std::vector< WrapperBase const * > wrappers;
+};
+
+template< typename T >
+void appendValue( Buffer & buffer, T const & value )
+{
+  buffer_unit_type const * const bytes = reinterpret_cast< buffer_unit_type const * >( &value );
+  buffer.insert( buffer.end(), bytes, bytes + sizeof( T ) );
+}
+
+template< typename T >
+T readValue( buffer_unit_type const * & ptr )
+{
+  T value;
+  std::memcpy( &value, ptr, sizeof( T ) );
+  ptr += sizeof( T );
+  return value;
+}
+
+void appendKey( Buffer & buffer, ObjectKey const & key )
+{
+  appendValue( buffer, static_cast< integer >( key.size() ) );
+  for( globalIndex const gi : key )
+  {
+    appendValue( buffer, gi );
+  }
+}
+
+ObjectKey readKey( buffer_unit_type const * & ptr )
+{
+  ObjectKey key( readValue< integer >( ptr ) );
+  for( globalIndex & gi : key )
+  {
+    gi = readValue< globalIndex >( ptr );
+  }
+  return key;
+}
+
+int rendezvousRank( ObjectKey const & key, int const numRanks )
+{
+  std::size_t hash = 0;
+  for( globalIndex const gi : key )
+  {
+    hash = hash * 1000003 + static_cast< std::size_t >( gi );
+  }
+  return static_cast< int >( hash % static_cast< std::size_t >( numRanks ) );
+}
+
+/**
+ * @brief Compute the keys of the objects of an object manager from its maps.
+ * @param keyType the type of the keys
+ * @param size the number of objects
+ * @param localToGlobal the global indices of the objects
+ * @param nodeLocalToGlobal the global indices of the nodes
+ * @param edgeToNodes the edge to node map, used for KeyType::EdgeNodes
+ * @param faceToNodes the face to node map, used for KeyType::FaceNodes
+ * @return the keys of the objects
+ */
+std::vector< ObjectKey > computeKeys( KeyType const keyType,
+                                      localIndex const size,
+                                      arrayView1d< globalIndex const > const & localToGlobal,
+                                      arrayView1d< globalIndex const > const & nodeLocalToGlobal,
+                                      arrayView2d< localIndex const > const & edgeToNodes,
+                                      ArrayOfArraysView< localIndex const > const & faceToNodes )
+{
+  std::vector< ObjectKey > keys( size );
+  for( localIndex i = 0; i < size; ++i )
+  {
+    ObjectKey & key = keys[i];
+    switch( keyType )
+    {
+      case KeyType::GlobalIndex:
+      {
+        key.push_back( localToGlobal[i] );
+        break;
+      }
+      case KeyType::EdgeNodes:
+      {
+        for( localIndex a = 0; a < edgeToNodes.size( 1 ); ++a )
+        {
+          key.push_back( nodeLocalToGlobal[ edgeToNodes( i, a ) ] );
+        }
+        break;
+      }
+      case KeyType::FaceNodes:
+      {
+        for( localIndex a = 0; a < faceToNodes.sizeOfArray( i ); ++a )
+        {
+          key.push_back( nodeLocalToGlobal[ faceToNodes( i, a ) ] );
+        }
+        break;
+      }
+    }
+    std::sort( key.begin(), key.end() );
+  }
+  return keys;
+}
+
+/**
+ * @brief Call a function on the values of the slice of an array written to conduit at a given first index.
+ * @param node the conduit node of the array
+ * @param index the first index of the slice
+ * @param lambda the function called with the byte offset and the byte size of each value,
+ *               in the logical order of the remaining indices
+ */
+template< typename LAMBDA >
+void forSliceValues( conduit::Node const & node, localIndex const index, LAMBDA && lambda )
+{
+  conduit::Node const & dimensionNode = node.fetch_child( "__dimensions__" );
+  conduit::Node const & permutationNode = node.fetch_child( "__permutation__" );
+  int const numDims = LvArray::integerConversion< int >( dimensionNode.dtype().number_of_elements() );
+  localIndex const * const dims = static_cast< localIndex const * >( dimensionNode.data_ptr() );
+  camp::idx_t const * const perm = static_cast< camp::idx_t const * >( permutationNode.data_ptr() );
+
+  // The last dimension of the permutation has a unit stride.
+  std::vector< localIndex > strides( numDims );
+  strides[ perm[ numDims - 1 ] ] = 1;
+  for( int i = numDims - 2; i >= 0; --i )
+  {
+    strides[ perm[ i ] ] = strides[ perm[ i + 1 ] ] * dims[ perm[ i + 1 ] ];
+  }
+
+  localIndex sliceSize = 1;
+  for( int i = 1; i < numDims; ++i )
+  {
+    sliceSize *= dims[ i ];
+  }
+
+  localIndex const valueSize = node.fetch_child( "__values__" ).dtype().element_bytes();
+  for( localIndex j = 0; j < sliceSize; ++j )
+  {
+    localIndex offset = index * strides[ 0 ];
+    localIndex remainder = j;
+    for( int i = numDims - 1; i > 0; --i )
+    {
+      offset += ( remainder % dims[ i ] ) * strides[ i ];
+      remainder /= dims[ i ];
+    }
+    lambda( offset * valueSize, valueSize );
+  }
+}
+
+localIndex firstDimension( conduit::Node const & node )
+{
+  return static_cast< localIndex const * >( node.fetch_child( "__dimensions__" ).data_ptr() )[ 0 ];
+}
+
+/**
+ * @brief Add the fields of a group that can be redistributed to a target.
+ * @param group the group holding the fields
+ * @param exclusionList the indices of the wrappers of the group that are not fields
+ * @param target the target
+ *
+ * The selection only depends on the types of the wrappers, so that it is identical on all ranks.
+ * The selected wrappers are registered to write, which exposes their data in the conduit tree.
+ */
+void addFields( Group & group, SortedArray< localIndex > const & exclusionList, Target & target )
+{
+  for( localIndex k = 0; k < group.wrappers().size(); ++k )
+  {
+    WrapperBase const & wrapper = *group.wrappers().values()[k].second;
+    if( exclusionList.count( k ) > 0 ||
+        wrapper.sizedFromParent() != 1 ||
+        wrapper.getRestartFlags() != RestartFlags::WRITE_AND_READ )
+    {
+      continue;
+    }
+
+    // Only the arrays written through an external pointer can be sliced, and the index valued
+    // arrays are maps into the old partitioning, rebuilt with the regenerated mesh.
+    wrapper.move( LvArray::MemorySpace::CPU, true );
+    wrapper.registerToWrite();
+    conduit::Node const & node = wrapper.getConduitNode();
+    if( node.has_child( "__dimensions__" ) && !node.fetch_child( "__values__" ).dtype().is_int64() )
+    {
+      target.wrappers.push_back( &wrapper );
+    }
+    else
+    {
+      wrapper.finishWriting();
+    }
+  }
+}
+
+void addTarget( ObjectManagerBase & manager,
+                KeyType const keyType,
+                NodeManager & nodeManager,
+                std::vector< Target > & targets )
+{
+  Target target{ &manager, keyType, &nodeManager, {} };
+
+  SortedArray< localIndex > exclusionList;
+  manager.ViewPackingExclusionList( exclusionList );
+  exclusionList.insert( manager.getWrapperIndex( ObjectManagerBase::viewKeyStruct::isExternalString ) );
+  exclusionList.insert( manager.getWrapperIndex( ObjectManagerBase::viewKeyStruct::domainBoundaryIndicatorString ) );
+  addFields( manager, exclusionList, target );
+
+  if( ElementSubRegionBase * const subRegion = dynamic_cast< ElementSubRegionBase * >( &manager ) )
+  {
+    subRegion->GetConstitutiveModels()->forSubGroups( [&]( Group & model )
+    {
+      addFields( model, SortedArray< localIndex >(), target );
+    } );
+  }
+
+  targets.push_back( std::move( target ) );
+}
+
+/**
+ * @brief Build the targets of the redistribution, in the same order on all ranks.
+ * @param domain the domain
+ * @param unsupportedPaths the paths of the subregions whose data can not be redistributed
+ * @return the targets
+ */
+std::vector< Target > gatherTargets( DomainPartition & domain, std::vector< std::string > & unsupportedPaths )
+{
+  std::vector< Target > targets;
+  domain.getMeshBodies()->forSubGroups< MeshBody >( [&]( MeshBody & meshBody )
+  {
+    meshBody.forSubGroups< MeshLevel >( [&]( MeshLevel & mesh )
+    {
+      NodeManager & nodeManager = *mesh.getNodeManager();
+      addTarget( nodeManager, KeyType::GlobalIndex, nodeManager, targets );
+      addTarget( *mesh.getEdgeManager(), KeyType::EdgeNodes, nodeManager, targets );
+      addTarget( *mesh.getFaceManager(), KeyType::FaceNodes, nodeManager, targets );
+
+      ElementRegionManager & elemManager = *mesh.getElemManager();
+      elemManager.forElementSubRegions< CellElementSubRegion, WellElementSubRegion >( [&]( ElementSubRegionBase & subRegion )
+      {
+        addTarget( subRegion, KeyType::GlobalIndex, nodeManager, targets );
+      } );
+      elemManager.forElementSubRegions< FaceElementSubRegion, EmbeddedSurfaceSubRegion >( [&]( ElementSubRegionBase & subRegion )
+      {
+        unsupportedPaths.push_back( subRegion.getConduitNode().path() );
+      } );
+    } );
+  } );
+  return targets;
+}
+
+/**
+ * @brief Pack the owned objects of a target found in a restart file for their rendezvous rank.
+ * @param fileRoot the root of the restart file
+ * @param targets the targets
+ * @param targetIndex the index of the target
+ * @param sendBuffers the buffers sent to each rank
+ */
+void packRestartObjects( conduit::Node & fileRoot,
+                         std::vector< Target > const & targets,
+                         integer const targetIndex,
+                         std::vector< Buffer > & sendBuffers )
+{
+  Target const & target = targets[ targetIndex ];
+  std::string const path = target.manager->getConduitNode().path();
+  if( !fileRoot.has_path( path ) )
+  {
+    return;
+  }
+
+  conduit::Node & groupNode = fileRoot[ path ];
+  localIndex const size = groupNode.fetch_child( "__size__" ).value();
+
+  array1d< integer > ghostRank;
+  wrapperHelpers::pullDataFromConduitNode( ghostRank, groupNode[ ObjectManagerBase::viewKeyStruct::ghostRankString ] );
+
+  array1d< globalIndex > localToGlobal;
+  array1d< globalIndex > nodeLocalToGlobal;
+  array2d< localIndex > edgeToNodes;
+  ArrayOfArrays< localIndex > faceToNodes;
+  wrapperHelpers::pullDataFromConduitNode( localToGlobal, groupNode[ ObjectManagerBase::viewKeyStruct::localToGlobalMapString ] );
+  if( target.keyType != KeyType::GlobalIndex )
+  {
+    conduit::Node & nodeManagerNode = fileRoot[ target.nodeManager->getConduitNode().path() ];
+    wrapperHelpers::pullDataFromConduitNode( nodeLocalToGlobal,
+                                             nodeManagerNode[ ObjectManagerBase::viewKeyStruct::localToGlobalMapString ] );
+  }
+  if( target.keyType == KeyType::EdgeNodes )
+  {
+    wrapperHelpers::pullDataFromConduitNode( edgeToNodes, groupNode[ EdgeManager::viewKeyStruct::nodeListString ] );
+  }
+  if( target.keyType == KeyType::FaceNodes )
+  {
+    wrapperHelpers::pullDataFromConduitNode( faceToNodes, groupNode[ FaceManager::viewKeyStruct::nodeListString ] );
+  }
+
+  std::vector< ObjectKey > const keys = computeKeys( target.keyType,
+                                                     size,
+                                                     localToGlobal.toViewConst(),
+                                                     nodeLocalToGlobal.toViewConst(),
+                                                     edgeToNodes.toViewConst(),
+                                                     faceToNodes.toViewConst() );
+
+  // The fields missing from the restart file, or not sized with their object manager, are not transferred.
+  std::vector< conduit::Node const * > fieldNodes;
+  for( WrapperBase const * const wrapper : target.wrappers )
+  {
+    std::string const wrapperPath = wrapper->getConduitNode().path();
+    conduit::Node const * fieldNode = nullptr;
+    if( fileRoot.has_path( wrapperPath ) )
+    {
+      fieldNode = &fileRoot[ wrapperPath ];
+      if( !fieldNode->has_child( "__dimensions__" ) || firstDimension( *fieldNode ) != size )
+      {
+        fieldNode = nullptr;
+      }
+    }
+    fieldNodes.push_back( fieldNode );
+  }
+
+  int const numRanks = LvArray::integerConversion< int >( sendBuffers.size() );
+  for( localIndex i = 0; i < size; ++i )
+  {
+    if( ghostRank[i] >= 0 )
+    {
+      continue;
+    }
+
+    Buffer & buffer = sendBuffers[ rendezvousRank( keys[i], numRanks ) ];
+    appendValue( buffer, targetIndex );
+    appendKey( buffer, keys[i] );
+
+    // Reserve the size of the payload, filled once it has been packed.
+    std::size_t const payloadSizeOffset = buffer.size();
+    appendValue( buffer, localIndex( 0 ) );
+    std::size_t const payloadOffset = buffer.size();
+
+    for( conduit::Node const * const fieldNode : fieldNodes )
+    {
+      std::size_t const fieldSizeOffset = buffer.size();
+      appendValue( buffer, localIndex( 0 ) );
+      if( fieldNode != nullptr )
+      {
+        buffer_unit_type const * const values = static_cast< buffer_unit_type const * >( fieldNode->fetch_child( "__values__" ).data_ptr() );
+        forSliceValues( *fieldNode, i, [&]( localIndex const offset, localIndex const numBytes )
+        {
+          buffer.insert( buffer.end(), values + offset, values + offset + numBytes );
+        } );
+      }
+      localIndex const fieldSize = buffer.size() - fieldSizeOffset - sizeof( localIndex );
+      std::memcpy( buffer.data() + fieldSizeOffset, &fieldSize, sizeof( localIndex ) );
+    }
+
+    localIndex const payloadSize = buffer.size() - payloadOffset;
+    std::memcpy( buffer.data() + payloadSizeOffset, &payloadSize, sizeof( localIndex ) );
+  }
+}
+
+/**
+ * @brief Unpack the payload of an object into the fields of a target.
+ * @param target the target
+ * @param index the local index of the object
+ * @param ptr the pointer to the payload, advanced past it
+ */
+void unpackObject( Target const & target, localIndex const index, buffer_unit_type const * & ptr )
+{
+  for( WrapperBase const * const wrapper : target.wrappers )
+  {
+    localIndex const fieldSize = readValue< localIndex >( ptr );
+    if( fieldSize == 0 )
+    {
+      continue;
+    }
+
+    conduit::Node & node = wrapper->getConduitNode();
+    GEOSX_ERROR_IF_GE_MSG( index, firstDimension( node ),
+                           "Field " << node.path() << " is not sized with its object manager in the regenerated mesh." );
+
+    buffer_unit_type * const values = static_cast< buffer_unit_type * >( node[ "__values__" ].data_ptr() );
+    localIndex unpackedSize = 0;
+    forSliceValues( node, index, [&]( localIndex const offset, localIndex const numBytes )
+    {
+      GEOSX_ERROR_IF_GT_MSG( unpackedSize + numBytes, fieldSize,
+                             "Field " << node.path() << " has a different layout in the restart files." );
+      std::memcpy( values + offset, ptr + unpackedSize, numBytes );
+      unpackedSize += numBytes;
+    } );
+    GEOSX_ERROR_IF_NE_MSG( unpackedSize, fieldSize,
+                           "Field " << node.path() << " has a different layout in the restart files." );
+    ptr += fieldSize;
+  }
+}
+
+} // namespace
+
+
+void redistributeRestartMeshData( DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  int const rank = MpiWrapper::Comm_rank();
+  int const numRanks = MpiWrapper::Comm_size();
+  int const numWriterRanks = getRestartNumberOfRanks();
+
+  std::vector< std::string > unsupportedPaths;
+  std::vector< Target > const targets = gatherTargets( domain, unsupportedPaths );
+
+  // Send the owned objects of the restart trees read by this rank to their rendezvous rank.
+  std::vector< Buffer > sendBuffers( numRanks );
+  for( int writerRank = rank; writerRank < numWriterRanks; writerRank += numRanks )
+  {
+    conduit::Node fileRoot;
+    loadRestartRankTree( writerRank, fileRoot );
+
+    for( std::string const & path : unsupportedPaths )
+    {
+      GEOSX_ERROR_IF( fileRoot.has_path( path ) && fileRoot[ path ].fetch_child( "__size__" ).to_int64() > 0,
+                      "The restart of " << path << " can not be read with a different number of ranks." );
+    }
+
+    for( std::size_t t = 0; t < targets.size(); ++t )
+    {
+      packRestartObjects( fileRoot, targets, LvArray::integerConversion< integer >( t ), sendBuffers );
+    }
+  }
+  std::vector< Buffer > const restartObjects = MpiWrapper::allToAllv( sendBuffers, MPI_COMM_GEOSX );
+
+  // Request the objects held by this rank in the regenerated mesh from their rendezvous rank.
+  std::vector< Buffer > requestBuffers( numRanks );
+  for( std::size_t t = 0; t < targets.size(); ++t )
+  {
+    Target const & target = targets[t];
+    array2d< localIndex > noEdgeToNodes;
+    ArrayOfArrays< localIndex > noFaceToNodes;
+    arrayView2d< localIndex const > edgeToNodes = noEdgeToNodes.toViewConst();
+    ArrayOfArraysView< localIndex const > faceToNodes = noFaceToNodes.toViewConst();
+    if( target.keyType == KeyType::EdgeNodes )
+    {
+      edgeToNodes = dynamic_cast< EdgeManager const & >( *target.manager ).nodeList().toViewConst();
+    }
+    if( target.keyType == KeyType::FaceNodes )
+    {
+      faceToNodes = dynamic_cast< FaceManager const & >( *target.manager ).nodeList().toViewConst();
+    }
+
+    std::vector< ObjectKey > const keys = computeKeys( target.keyType,
+                                                       target.manager->size(),
+                                                       target.manager->localToGlobalMap().toViewConst(),
+                                                       target.nodeManager->localToGlobalMap().toViewConst(),
+                                                       edgeToNodes,
+                                                       faceToNodes );
+
+    for( localIndex i = 0; i < target.manager->size(); ++i )
+    {
+      Buffer & buffer = requestBuffers[ rendezvousRank( keys[i], numRanks ) ];
+      appendValue( buffer, LvArray::integerConversion< integer >( t ) );
+      appendValue( buffer, i );
+      appendKey( buffer, keys[i] );
+    }
+  }
+  std::vector< Buffer > const requests = MpiWrapper::allToAllv( requestBuffers, MPI_COMM_GEOSX );
+
+  // Match the requests with the restart objects on the rendezvous rank.
+  std::map< std::pair< integer, ObjectKey >, std::pair< buffer_unit_type const *, localIndex > > payloads;
+  for( Buffer const & buffer : restartObjects )
+  {
+    buffer_unit_type const * ptr = buffer.data();
+    while( ptr != buffer.data() + buffer.size() )
+    {
+      integer const targetIndex = readValue< integer >( ptr );
+      ObjectKey key = readKey( ptr );
+      localIndex const payloadSize = readValue< localIndex >( ptr );
+      payloads[ { targetIndex, std::move( key ) } ] = { ptr, payloadSize };
+      ptr += payloadSize;
+    }
+  }
+
+  std::vector< Buffer > replyBuffers( numRanks );
+  for( int r = 0; r < numRanks; ++r )
+  {
+    buffer_unit_type const * ptr = requests[r].data();
+    while( ptr != requests[r].data() + requests[r].size() )
+    {
+      integer const targetIndex = readValue< integer >( ptr );
+      localIndex const index = readValue< localIndex >( ptr );
+      ObjectKey key = readKey( ptr );
+
+      auto const payload = payloads.find( { targetIndex, std::move( key ) } );
+      GEOSX_ERROR_IF( payload == payloads.end(),
+                      "An object of " << targets[ targetIndex ].manager->getConduitNode().path() <<
+                      " is missing from the restart files, the mesh generated from the input does not match the restart." );
+
+      appendValue( replyBuffers[r], targetIndex );
+      appendValue( replyBuffers[r], index );
+      replyBuffers[r].insert( replyBuffers[r].end(), payload->second.first, payload->second.first + payload->second.second );
+    }
+  }
+  std::vector< Buffer > const replies = MpiWrapper::allToAllv( replyBuffers, MPI_COMM_GEOSX );
+
+  // Write the payloads into the fields of the regenerated mesh.
+  for( Buffer const & buffer : replies )
+  {
+    buffer_unit_type const * ptr = buffer.data();
+    while( ptr != buffer.data() + buffer.size() )
+    {
+      integer const targetIndex = readValue< integer >( ptr );
+      localIndex const index = readValue< localIndex >( ptr );
+      unpackObject( targets[ targetIndex ], index, ptr );
+    }
+  }
+
+  for( Target const & target : targets )
+  {
+    for( WrapperBase const * const wrapper : target.wrappers )
+    {
+      wrapper->finishWriting();
+    }
+  }
+}
+
+} /* namespace geosx */
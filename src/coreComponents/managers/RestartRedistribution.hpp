@@ -0,0 +1,45 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file RestartRedistribution.hpp
+ */
+
+#ifndef GEOSX_MANAGERS_RESTARTREDISTRIBUTION_HPP_
+#define GEOSX_MANAGERS_RESTARTREDISTRIBUTION_HPP_
+
+namespace geosx
+{
+
+class DomainPartition;
+
+/**
+ * @brief Overwrite the mesh data of the domain with the data of a restart written by a different number of ranks.
+ * @param domain the domain, holding the mesh regenerated from the input on the current ranks
+ *
+ * The objects of the restart files are matched with the objects of the regenerated mesh through keys
+ * that do not depend on the partitioning: the global index for the nodes and the elements, and the
+ * sorted global indices of the nodes for the edges and the faces. The owned objects of the restart
+ * files are sent to a rendezvous rank computed from their key, where they are matched with the
+ * requests of the ranks holding the object, owned or ghosted, in the current partitioning.
+ *
+ * Only the fields sized with their object manager (including the constitutive data of the element
+ * subregions) are transferred. The maps, the sets and the ghosting information are those of the
+ * regenerated mesh.
+ */
+void redistributeRestartMeshData( DomainPartition & domain );
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MANAGERS_RESTARTREDISTRIBUTION_HPP_ */
@@ -122,6 +122,75 @@ TEST( FunctionTests, 1DTable )
 
 
 
+TEST( FunctionTests, 1DTable_uniform )
+{
+  FunctionManager * functionManager = &FunctionManager::FunctionManager::Instance();
+
+  // 1D table on a uniformly spaced axis, evaluated through the kernel wrapper
+  localIndex Naxis = 4;
+  localIndex Ntest = 7;
+
+  array1d< real64_array > coordinates;
+  coordinates.resize( 1 );
+  coordinates[0].resize( Naxis );
+  coordinates[0][0] = -0.3;
+  coordinates[0][1] = -0.2;
+  coordinates[0][2] = -0.1;
+  coordinates[0][3] = 0.0;
+
+  real64_array values( Naxis );
+  values[0] = 1.0;
+  values[1] = 3.0;
+  values[2] = -5.0;
+  values[3] = 7.0;
+
+  TableFunction * table_e = functionManager->CreateChild( "TableFunction", "table_e" )->group_cast< TableFunction * >();
+  table_e->setTableCoordinates( coordinates );
+  table_e->setTableValues( values );
+
+  // Points outside the axis, on its vertices and between them
+  real64_array testCoordinates( Ntest );
+  testCoordinates[0] = -1.0;
+  testCoordinates[1] = -0.3;
+  testCoordinates[2] = -0.25;
+  testCoordinates[3] = -0.2;
+  testCoordinates[4] = -0.13;
+  testCoordinates[5] = -0.1;
+  testCoordinates[6] = 0.5;
+
+  real64 const expected[4][7] = { { 1.0, 1.0, 2.0, 3.0, -2.6, -5.0, 7.0 },     // Linear
+                                  { 1.0, 1.0, 3.0, 3.0, -5.0, -5.0, 7.0 },     // Upper
+                                  { 1.0, 1.0, 1.0, 1.0, 3.0, 3.0, 7.0 },       // Lower
+                                  { 1.0, 1.0, 1.0, 3.0, -5.0, -5.0, 7.0 } };   // Nearest
+  TableFunction::InterpolationType const methods[4] = { TableFunction::InterpolationType::Linear,
+                                                        TableFunction::InterpolationType::Upper,
+                                                        TableFunction::InterpolationType::Lower,
+                                                        TableFunction::InterpolationType::Nearest };
+
+  arrayView1d< real64 const > const & testCoordinatesView = testCoordinates.toViewConst();
+  real64_array output( Ntest );
+  arrayView1d< real64 > const & outputView = output.toView();
+  for( int m = 0; m < 4; ++m )
+  {
+    table_e->setInterpolationMethod( methods[m] );
+    table_e->reInitializeFunction();
+
+    TableFunction::KernelWrapper const table = table_e->createKernelWrapper();
+    forAll< parallelDevicePolicy<> >( Ntest, [=] GEOSX_HOST_DEVICE ( localIndex const ii )
+    {
+      outputView[ii] = table.Compute( &testCoordinatesView[ii] );
+    } );
+
+    output.move( LvArray::MemorySpace::CPU );
+    for( localIndex ii = 0; ii < Ntest; ++ii )
+    {
+      EXPECT_NEAR( output[ii], expected[m][ii], 1e-10 );
+      EXPECT_NEAR( table_e->Evaluate( &testCoordinates[ii] ), expected[m][ii], 1e-10 );
+    }
+  }
+}
+
+
 TEST( FunctionTests, 2DTable )
 {
   FunctionManager * functionManager = &FunctionManager::FunctionManager::Instance();
@@ -219,6 +288,23 @@ TEST( FunctionTests, 2DTable )
   {
     ASSERT_NEAR( expected[ii], output[ii], 1e-10 );
   }
+
+  // Evaluate the function on a batch of points given directly, in reverse order
+  real64_array2d batchInput( Ntest, Ndim );
+  for( localIndex ii=0; ii<Ntest; ++ii )
+  {
+    for( localIndex jj=0; jj<Ndim; ++jj )
+    {
+      batchInput[ii][jj] = testCoordinates[Ntest-1-ii][jj];
+    }
+  }
+  real64_array batchOutput( Ntest );
+  table_b->EvaluateBatch( batchInput.toViewConst(), batchOutput.toView() );
+
+  for( localIndex ii=0; ii<Ntest; ++ii )
+  {
+    ASSERT_NEAR( expected[Ntest-1-ii], batchOutput[ii], 1e-10 );
+  }
 }
 
 
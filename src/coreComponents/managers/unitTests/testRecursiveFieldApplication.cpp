@@ -191,6 +191,26 @@ TEST( FieldSpecification, Recursive )
     GEOSX_ERROR_IF( field3[1][1][ei] < 4. || field3[1][1][ei] > 4., "Recursive fields are not set" );
   } );
 
+  /// The sets are read when the fields are applied, not when the targets are resolved
+  set0hex.remove( 0 );
+  arrayView1d< real64 > const & field0reg0Hex = reg0->GetSubRegion( "reg0hex" )->getReference< array1d< real64 > >( "field0" );
+  field0reg0Hex.setValues< serialPolicy >( 0.0 );
+
+  FieldSpecificationManager::get().Apply( 0., domain.get(), "", "",
+                                          [&] ( FieldSpecificationBase const * const bc,
+                                                string const &,
+                                                SortedArrayView< localIndex const > const & targetSet,
+                                                Group * const targetGroup,
+                                                string const name )
+  {
+    bc->ApplyFieldValue< FieldSpecificationEqual >( targetSet, 0.0, targetGroup, name );
+  } );
+
+  EXPECT_EQ( field0reg0Hex[0], 0.0 );
+  for( localIndex ei = 1; ei < reg0Hex->size(); ++ei )
+  {
+    EXPECT_EQ( field0reg0Hex[ei], 1.0 );
+  }
 
 }
 
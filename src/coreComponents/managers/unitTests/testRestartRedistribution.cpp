@@ -0,0 +1,289 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testRestartRedistribution.cpp
+ */
+
+#include "gtest/gtest.h"
+
+#include "dataRepository/ConduitRestart.hpp"
+#include "managers/initialization.hpp"
+#include "managers/ProblemManager.hpp"
+#include "managers/DomainPartition.hpp"
+#include "managers/FieldSpecification/FieldSpecificationManager.hpp"
+#include "managers/Functions/FunctionManager.hpp"
+#include "mesh/CellElementSubRegion.hpp"
+#include "mesh/FaceManager.hpp"
+#include "mesh/NodeManager.hpp"
+#include "physicsSolvers/fluidFlow/unitTests/testCompFlowUtils.hpp"
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+namespace
+{
+
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Solvers gravityVector=\"0.0, 0.0, 0.0\">\n"
+  "    <SolidMechanics_LagrangianFEM name=\"lagsolve\"\n"
+  "                                  timeIntegrationOption=\"QuasiStatic\"\n"
+  "                                  discretization=\"FE1\"\n"
+  "                                  targetRegions=\"{Region2}\"\n"
+  "                                  solidMaterialNames=\"{shale}\"/>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh1\"\n"
+  "                  elementTypes=\"{C3D8}\"\n"
+  "                  xCoords=\"{0, 6}\"\n"
+  "                  yCoords=\"{0, 2}\"\n"
+  "                  zCoords=\"{0, 2}\"\n"
+  "                  nx=\"{6}\"\n"
+  "                  ny=\"{2}\"\n"
+  "                  nz=\"{2}\"\n"
+  "                  cellBlockNames=\"{cb1}\"/>\n"
+  "  </Mesh>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteElements>\n"
+  "      <FiniteElementSpace name=\"FE1\" order=\"1\"/>\n"
+  "    </FiniteElements>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"Region2\" cellBlocks=\"{cb1}\" materialList=\"{shale}\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <LinearElasticIsotropic name=\"shale\"\n"
+  "                            defaultDensity=\"2700\"\n"
+  "                            defaultBulkModulus=\"5.5556e9\"\n"
+  "                            defaultShearModulus=\"4.16667e9\"/>\n"
+  "  </Constitutive>\n"
+  "</Problem>";
+
+char const * const nodeFieldName = "testNodeField";
+char const * const faceFieldName = "testFaceField";
+char const * const cellFieldName = "testCellField";
+
+/// The number of components of the cell field, transferred slice by slice.
+localIndex constexpr numCellComponents = 3;
+
+real64 nodeValue( globalIndex const gi )
+{
+  return 1.0 + 0.5 * gi;
+}
+
+real64 cellValue( globalIndex const gi, localIndex const c )
+{
+  return 100.0 * gi + c;
+}
+
+/// The value of a face, from the global indices of its nodes so that it does not depend on the partitioning.
+real64 faceValue( FaceManager const & faceManager, NodeManager const & nodeManager, localIndex const f )
+{
+  ArrayOfArraysView< localIndex const > const faceToNodes = faceManager.nodeList().toViewConst();
+  arrayView1d< globalIndex const > const nodeLocalToGlobal = nodeManager.localToGlobalMap();
+  real64 value = 0.0;
+  for( localIndex a = 0; a < faceToNodes.sizeOfArray( f ); ++a )
+  {
+    real64 const gi = nodeLocalToGlobal[ faceToNodes( f, a ) ] + 1;
+    value += gi * gi;
+  }
+  return value;
+}
+
+/**
+ * @brief Run a function on the first ranks only, with MPI_COMM_GEOSX restricted to these ranks.
+ * @param numRanks the number of ranks running the function
+ * @param lambda the function
+ */
+template< typename LAMBDA >
+void runOnRanks( int const numRanks, LAMBDA && lambda )
+{
+  MPI_Comm const worldComm = MPI_COMM_GEOSX;
+  int const rank = MpiWrapper::Comm_rank( worldComm );
+  MPI_Comm subComm = MpiWrapper::Comm_split( worldComm, rank < numRanks ? 0 : 1, rank );
+  if( rank < numRanks )
+  {
+    MPI_COMM_GEOSX = subComm;
+    lambda();
+    MPI_COMM_GEOSX = worldComm;
+  }
+  MpiWrapper::Comm_free( subComm );
+  MpiWrapper::Barrier( worldComm );
+}
+
+/**
+ * @brief Register the test fields on the mesh.
+ * @param domain the domain
+ */
+void registerFields( DomainPartition & domain )
+{
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  mesh.getNodeManager()->registerWrapper< array1d< real64 > >( nodeFieldName );
+  mesh.getFaceManager()->registerWrapper< array1d< real64 > >( faceFieldName );
+  mesh.getElemManager()->forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
+  {
+    subRegion.registerWrapper< array2d< real64 > >( cellFieldName )->reference().resizeDimension< 1 >( numCellComponents );
+  } );
+}
+
+/**
+ * @brief Set up the problem on the ranks of MPI_COMM_GEOSX, set the test fields and write a restart.
+ * @param restartName the name of the restart
+ * @param ranksPerFile the number of ranks per restart file
+ */
+void writeRestart( string const & restartName, int const ranksPerFile )
+{
+  ProblemManager problemManager( "Problem", nullptr );
+  setupProblemFromXML( problemManager, xmlInput );
+
+  DomainPartition & domain = *problemManager.getDomainPartition();
+  registerFields( domain );
+
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  NodeManager & nodeManager = *mesh.getNodeManager();
+  FaceManager & faceManager = *mesh.getFaceManager();
+
+  arrayView1d< real64 > const nodeField = nodeManager.getReference< array1d< real64 > >( nodeFieldName );
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    nodeField[a] = nodeValue( nodeManager.localToGlobalMap()[a] );
+  }
+
+  arrayView1d< real64 > const faceField = faceManager.getReference< array1d< real64 > >( faceFieldName );
+  for( localIndex f = 0; f < faceManager.size(); ++f )
+  {
+    faceField[f] = faceValue( faceManager, nodeManager, f );
+  }
+
+  mesh.getElemManager()->forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
+  {
+    arrayView2d< real64 > const cellField = subRegion.getReference< array2d< real64 > >( cellFieldName );
+    for( localIndex k = 0; k < subRegion.size(); ++k )
+    {
+      for( localIndex c = 0; c < numCellComponents; ++c )
+      {
+        cellField( k, c ) = cellValue( subRegion.localToGlobalMap()[k], c );
+      }
+    }
+  } );
+
+  problemManager.prepareToWrite();
+  FunctionManager::Instance().prepareToWrite();
+  FieldSpecificationManager::get().prepareToWrite();
+  writeTree( restartName, ranksPerFile );
+  problemManager.finishWriting();
+  FunctionManager::Instance().finishWriting();
+  FieldSpecificationManager::get().finishWriting();
+}
+
+/**
+ * @brief Set up the problem on the ranks of MPI_COMM_GEOSX, read a restart and check the test fields.
+ * @param restartName the name of the restart
+ */
+void readRestartAndCheck( string const & restartName )
+{
+  // As in main, the restart tree is loaded before the problem is created.
+  loadTree( restartName );
+
+  ProblemManager problemManager( "Problem", nullptr );
+  setupProblemFromXML( problemManager, xmlInput );
+
+  DomainPartition & domain = *problemManager.getDomainPartition();
+  registerFields( domain );
+
+  problemManager.ReadRestartOverwrite();
+
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  NodeManager & nodeManager = *mesh.getNodeManager();
+  FaceManager & faceManager = *mesh.getFaceManager();
+
+  // Every local object, owned or ghost, gets the value written for its global index
+  arrayView1d< real64 const > const nodeField = nodeManager.getReference< array1d< real64 > >( nodeFieldName );
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    EXPECT_DOUBLE_EQ( nodeField[a], nodeValue( nodeManager.localToGlobalMap()[a] ) );
+  }
+
+  arrayView1d< real64 const > const faceField = faceManager.getReference< array1d< real64 > >( faceFieldName );
+  for( localIndex f = 0; f < faceManager.size(); ++f )
+  {
+    EXPECT_DOUBLE_EQ( faceField[f], faceValue( faceManager, nodeManager, f ) );
+  }
+
+  mesh.getElemManager()->forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
+  {
+    arrayView2d< real64 const > const cellField = subRegion.getReference< array2d< real64 > >( cellFieldName );
+    for( localIndex k = 0; k < subRegion.size(); ++k )
+    {
+      for( localIndex c = 0; c < numCellComponents; ++c )
+      {
+        EXPECT_DOUBLE_EQ( cellField( k, c ), cellValue( subRegion.localToGlobalMap()[k], c ) );
+      }
+    }
+  } );
+}
+
+/**
+ * @brief Write a restart on some ranks and read it on a different number of ranks.
+ * @param numWriters the number of ranks writing the restart
+ * @param numReaders the number of ranks reading the restart
+ * @param ranksPerFile the number of ranks per restart file
+ */
+void testRedistribution( int const numWriters, int const numReaders, int const ranksPerFile )
+{
+  ASSERT_NE( numWriters, numReaders );
+  ASSERT_LE( numWriters, MpiWrapper::Comm_size( MPI_COMM_GEOSX ) );
+  ASSERT_LE( numReaders, MpiWrapper::Comm_size( MPI_COMM_GEOSX ) );
+
+  string const restartName = "testRestartRedistribution_" + std::to_string( numWriters ) + "_" +
+                             std::to_string( numReaders ) + "_" + std::to_string( ranksPerFile );
+
+  runOnRanks( numWriters, [&]()
+  {
+    writeRestart( restartName, ranksPerFile );
+  } );
+
+  runOnRanks( numReaders, [&]()
+  {
+    readRestartAndCheck( restartName );
+  } );
+}
+
+} // namespace
+
+TEST( RestartRedistribution, moreReadersThanWriters )
+{
+  testRedistribution( 2, 3, 1 );
+}
+
+TEST( RestartRedistribution, fewerReadersThanWriters )
+{
+  testRedistribution( 3, 2, 1 );
+}
+
+TEST( RestartRedistribution, aggregatedFiles )
+{
+  testRedistribution( 3, 2, 2 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
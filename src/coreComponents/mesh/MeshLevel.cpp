@@ -34,8 +34,9 @@ MeshLevel::MeshLevel( string const & name,
   m_edgeManager( groupStructKeys::edgeManagerString, this ),
   m_faceManager( groupStructKeys::faceManagerString, this ),
   m_elementManager( groupStructKeys::elemManagerString, this ),
-  m_embSurfEdgeManager( groupStructKeys::embSurfEdgeManagerString, this )
-
+  m_embSurfEdgeManager( groupStructKeys::embSurfEdgeManagerString, this ),
+  m_topologyVersion( 0 ),
+  m_spatialIndex( *this )
 {
 
   RegisterGroup( groupStructKeys::nodeManagerString, &m_nodeManager );
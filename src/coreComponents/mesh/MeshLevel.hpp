@@ -23,6 +23,7 @@
 #include "EdgeManager.hpp"
 #include "ElementRegionManager.hpp"
 #include "FaceManager.hpp"
+#include "MeshSpatialIndex.hpp"
 
 namespace geosx
 {
@@ -153,6 +154,26 @@ public:
    */
   EdgeManager & getEmbdSurfEdgeManager()             { return m_embSurfEdgeManager; }
 
+  /**
+   * @brief Get the topology version of the mesh level.
+   * @details The version is incremented every time the connectivity or the ghosting of the mesh
+   *          changes, and allows objects computed from the topology to detect that they are stale.
+   * @return the current topology version
+   */
+  localIndex topologyVersion() const { return m_topologyVersion; }
+
+  /**
+   * @brief Increment the topology version of the mesh level.
+   * @note This must be called collectively, since communication patterns may depend on the version.
+   */
+  void incrementTopologyVersion() { ++m_topologyVersion; }
+
+  /**
+   * @brief Get the spatial index of the nodes and cells of the mesh level.
+   * @return the spatial index, built on first use
+   */
+  MeshSpatialIndex const & getSpatialIndex() const { return m_spatialIndex; }
+
   ///@}
 
 private:
@@ -168,6 +189,12 @@ private:
   /// Manager for embedded surfaces edge data
   EdgeManager m_embSurfEdgeManager;
 
+  /// Counter incremented every time the topology or the ghosting of the mesh changes
+  localIndex m_topologyVersion;
+
+  /// Point location and range queries on the nodes and cells
+  MeshSpatialIndex m_spatialIndex;
+
 };
 
 } /* namespace geosx */
@@ -0,0 +1,163 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MeshSpatialIndex.cpp
+ */
+
+#include "MeshSpatialIndex.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "mesh/MeshLevel.hpp"
+#include "meshUtilities/ComputationalGeometry.hpp"
+
+namespace geosx
+{
+
+MeshSpatialIndex::MeshSpatialIndex( MeshLevel const & mesh ):
+  m_mesh( mesh ),
+  m_nodeSpatialIndex(),
+  m_nodePositions( 0, 3 ),
+  m_nodeIndexVersion( -1 ),
+  m_cellSpatialIndex(),
+  m_cellRegion(),
+  m_cellSubRegion(),
+  m_cellElement(),
+  m_cellIndexVersion( -1 )
+{}
+
+bool MeshSpatialIndex::findCellContaining( R1Tensor const & point,
+                                           localIndex & er,
+                                           localIndex & esr,
+                                           localIndex & ei ) const
+{
+  er = -1;
+  esr = -1;
+  ei = -1;
+
+  ElementRegionManager const * const elemManager = m_mesh.getElemManager();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = m_mesh.getNodeManager()->referencePosition();
+
+  // The candidates are visited by increasing index, that is in the order of the regions, subregions and cells
+  cellSpatialIndex().forObjectsContaining( point, [&]( localIndex const cell )
+  {
+    if( ei >= 0 )
+    {
+      return;
+    }
+
+    CellElementSubRegion const * const subRegion =
+      elemManager->GetRegion( m_cellRegion[cell] )->GetSubRegion< CellElementSubRegion >( m_cellSubRegion[cell] );
+
+    array1d< array1d< localIndex > > faceNodes( subRegion->numFacesPerElement() );
+    for( localIndex kf = 0; kf < subRegion->numFacesPerElement(); ++kf )
+    {
+      subRegion->GetFaceNodes( m_cellElement[cell], kf, faceNodes[kf] );
+    }
+
+    if( computationalGeometry::IsPointInsidePolyhedron( X, faceNodes, point ) )
+    {
+      er = m_cellRegion[cell];
+      esr = m_cellSubRegion[cell];
+      ei = m_cellElement[cell];
+    }
+  } );
+
+  return ei >= 0;
+}
+
+SpatialIndex const & MeshSpatialIndex::nodeSpatialIndex() const
+{
+  NodeManager const * const nodeManager = m_mesh.getNodeManager();
+  if( m_nodeIndexVersion == m_mesh.topologyVersion() && m_nodePositions.size( 0 ) == nodeManager->size() )
+  {
+    return m_nodeSpatialIndex;
+  }
+
+  GEOSX_MARK_FUNCTION;
+
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = nodeManager->referencePosition();
+  m_nodePositions.resize( nodeManager->size(), 3 );
+  for( localIndex a = 0; a < nodeManager->size(); ++a )
+  {
+    for( int d = 0; d < 3; ++d )
+    {
+      m_nodePositions( a, d ) = X( a, d );
+    }
+  }
+
+  m_nodeSpatialIndex.build( m_nodePositions.toViewConst(), m_nodePositions.toViewConst() );
+  m_nodeIndexVersion = m_mesh.topologyVersion();
+  return m_nodeSpatialIndex;
+}
+
+SpatialIndex const & MeshSpatialIndex::cellSpatialIndex() const
+{
+  ElementRegionManager const * const elemManager = m_mesh.getElemManager();
+
+  localIndex numCells = 0;
+  elemManager->forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    numCells += subRegion.size();
+  } );
+
+  if( m_cellIndexVersion == m_mesh.topologyVersion() && m_cellElement.size() == numCells )
+  {
+    return m_cellSpatialIndex;
+  }
+
+  GEOSX_MARK_FUNCTION;
+
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = m_mesh.getNodeManager()->referencePosition();
+
+  m_cellRegion.resize( numCells );
+  m_cellSubRegion.resize( numCells );
+  m_cellElement.resize( numCells );
+  array2d< real64 > boxMin( numCells, 3 );
+  array2d< real64 > boxMax( numCells, 3 );
+
+  localIndex cell = 0;
+  elemManager->forElementSubRegionsComplete< CellElementSubRegion >( [&]( localIndex const er,
+                                                                          localIndex const esr,
+                                                                          ElementRegionBase const &,
+                                                                          CellElementSubRegion const & subRegion )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemToNodes = subRegion.nodeList();
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei, ++cell )
+    {
+      m_cellRegion[cell] = er;
+      m_cellSubRegion[cell] = esr;
+      m_cellElement[cell] = ei;
+      for( int d = 0; d < 3; ++d )
+      {
+        boxMin( cell, d ) = std::numeric_limits< real64 >::max();
+        boxMax( cell, d ) = std::numeric_limits< real64 >::lowest();
+      }
+      for( localIndex a = 0; a < elemToNodes.size( 1 ); ++a )
+      {
+        for( int d = 0; d < 3; ++d )
+        {
+          boxMin( cell, d ) = std::min( boxMin( cell, d ), X( elemToNodes( ei, a ), d ) );
+          boxMax( cell, d ) = std::max( boxMax( cell, d ), X( elemToNodes( ei, a ), d ) );
+        }
+      }
+    }
+  } );
+
+  m_cellSpatialIndex.build( boxMin.toViewConst(), boxMax.toViewConst() );
+  m_cellIndexVersion = m_mesh.topologyVersion();
+  return m_cellSpatialIndex;
+}
+
+} /* namespace geosx */
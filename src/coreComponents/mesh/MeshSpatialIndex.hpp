@@ -0,0 +1,176 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MeshSpatialIndex.hpp
+ */
+
+#ifndef GEOSX_MESH_MESHSPATIALINDEX_HPP_
+#define GEOSX_MESH_MESHSPATIALINDEX_HPP_
+
+#include "mesh/SpatialIndex.hpp"
+
+namespace geosx
+{
+
+class MeshLevel;
+
+/**
+ * @class MeshSpatialIndex
+ * @brief Point location and range queries on the nodes and cells of a mesh level.
+ *
+ * The node and cell indices are built from the reference positions of the nodes the first time
+ * they are queried, and rebuilt when the number of nodes or cells or the topology version of the
+ * mesh level has changed. Only the cells of the cell element subregions are indexed.
+ */
+class MeshSpatialIndex
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param mesh the mesh level to index
+   */
+  explicit MeshSpatialIndex( MeshLevel const & mesh );
+
+  /**
+   * @brief Find a cell containing a point.
+   * @param point the point
+   * @param er the region index of the cell, or -1 if no cell contains the point
+   * @param esr the subregion index of the cell, or -1 if no cell contains the point
+   * @param ei the index of the cell in its subregion, or -1 if no cell contains the point
+   * @return @p true if a cell containing the point was found
+   *
+   * When the point is on the boundary of several cells, the first one in the order
+   * of the regions, subregions and cells is returned.
+   */
+  bool findCellContaining( R1Tensor const & point,
+                           localIndex & er,
+                           localIndex & esr,
+                           localIndex & ei ) const;
+
+  /**
+   * @brief Call a function on each cell whose bounding box overlaps a box.
+   * @tparam LAMBDA type of the function, called with the region, subregion and cell indices
+   * @param boxMin the lower corner of the box
+   * @param boxMax the upper corner of the box
+   * @param lambda the function
+   */
+  template< typename LAMBDA >
+  void forCellsInBox( R1Tensor const & boxMin, R1Tensor const & boxMax, LAMBDA && lambda ) const
+  {
+    cellSpatialIndex().forObjectsInBox( boxMin, boxMax, [&]( localIndex const cell )
+    {
+      lambda( m_cellRegion[cell], m_cellSubRegion[cell], m_cellElement[cell] );
+    } );
+  }
+
+  /**
+   * @brief Call a function on each node inside a box.
+   * @tparam LAMBDA type of the function, called with the node index
+   * @param boxMin the lower corner of the box
+   * @param boxMax the upper corner of the box
+   * @param lambda the function
+   */
+  template< typename LAMBDA >
+  void forNodesInBox( R1Tensor const & boxMin, R1Tensor const & boxMax, LAMBDA && lambda ) const
+  {
+    nodeSpatialIndex().forObjectsInBox( boxMin, boxMax, std::forward< LAMBDA >( lambda ) );
+  }
+
+  /**
+   * @brief Call a function on each node inside a cylinder.
+   * @tparam LAMBDA type of the function, called with the node index
+   * @param point1 the center of the first face of the cylinder
+   * @param point2 the center of the second face of the cylinder
+   * @param radius the radius of the cylinder
+   * @param lambda the function
+   */
+  template< typename LAMBDA >
+  void forNodesInCylinder( R1Tensor const & point1,
+                           R1Tensor const & point2,
+                           real64 const radius,
+                           LAMBDA && lambda ) const
+  {
+    R1Tensor boxMin, boxMax;
+    for( int d = 0; d < 3; ++d )
+    {
+      boxMin[d] = std::min( point1[d], point2[d] ) - radius;
+      boxMax[d] = std::max( point1[d], point2[d] ) + radius;
+    }
+
+    R1Tensor axis = point2;
+    axis -= point1;
+    real64 const length2 = Dot( axis, axis );
+
+    nodeSpatialIndex().forObjectsInBox( boxMin, boxMax, [&]( localIndex const a )
+    {
+      R1Tensor v;
+      for( int d = 0; d < 3; ++d )
+      {
+        v[d] = m_nodePositions( a, d ) - point1[d];
+      }
+      real64 const t = Dot( v, axis );
+      if( t >= 0.0 && t <= length2 && Dot( v, v ) - ( length2 > 0.0 ? t * t / length2 : 0.0 ) <= radius * radius )
+      {
+        lambda( a );
+      }
+    } );
+  }
+
+private:
+
+  /**
+   * @brief Get the node index, building it if needed.
+   * @return the node index
+   */
+  SpatialIndex const & nodeSpatialIndex() const;
+
+  /**
+   * @brief Get the cell index, building it if needed.
+   * @return the cell index
+   */
+  SpatialIndex const & cellSpatialIndex() const;
+
+  /// The indexed mesh level
+  MeshLevel const & m_mesh;
+
+  /// Index of the nodes, whose boxes are reduced to their position
+  mutable SpatialIndex m_nodeSpatialIndex;
+
+  /// Reference position of the indexed nodes
+  mutable array2d< real64 > m_nodePositions;
+
+  /// Topology version of the mesh level when the node index was built, -1 if never built
+  mutable localIndex m_nodeIndexVersion;
+
+  /// Index of the bounding boxes of the cells
+  mutable SpatialIndex m_cellSpatialIndex;
+
+  /// Region index of the indexed cells
+  mutable array1d< localIndex > m_cellRegion;
+
+  /// Subregion index of the indexed cells
+  mutable array1d< localIndex > m_cellSubRegion;
+
+  /// Index in their subregion of the indexed cells
+  mutable array1d< localIndex > m_cellElement;
+
+  /// Topology version of the mesh level when the cell index was built, -1 if never built
+  mutable localIndex m_cellIndexVersion;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MESH_MESHSPATIALINDEX_HPP_ */
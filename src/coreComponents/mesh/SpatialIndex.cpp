@@ -0,0 +1,141 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SpatialIndex.cpp
+ */
+
+#include "SpatialIndex.hpp"
+
+#include "common/TimingMacros.hpp"
+
+#include <cmath>
+
+namespace geosx
+{
+
+SpatialIndex::SpatialIndex():
+  m_gridMin{ 0.0, 0.0, 0.0 },
+  m_gridMax{ 0.0, 0.0, 0.0 },
+  m_cellSize{ 1.0, 1.0, 1.0 },
+  m_numCells{ 1, 1, 1 },
+  m_cellOffsets(),
+  m_objects(),
+  m_boxMin( 0, 3 ),
+  m_boxMax( 0, 3 )
+{
+  m_cellOffsets.resize( 2 );
+}
+
+void SpatialIndex::build( arrayView2d< real64 const > const & boxMin,
+                          arrayView2d< real64 const > const & boxMax )
+{
+  GEOSX_MARK_FUNCTION;
+  GEOSX_ERROR_IF_NE( boxMin.size( 0 ), boxMax.size( 0 ) );
+  GEOSX_ERROR_IF_NE( boxMin.size( 1 ), 3 );
+  GEOSX_ERROR_IF_NE( boxMax.size( 1 ), 3 );
+
+  localIndex const numBoxes = boxMin.size( 0 );
+  m_boxMin.resize( numBoxes, 3 );
+  m_boxMax.resize( numBoxes, 3 );
+
+  // The grid covers the union of the boxes
+  for( int d = 0; d < 3; ++d )
+  {
+    m_gridMin[d] = numBoxes > 0 ? std::numeric_limits< real64 >::max() : 0.0;
+    m_gridMax[d] = numBoxes > 0 ? std::numeric_limits< real64 >::lowest() : 0.0;
+  }
+  for( localIndex a = 0; a < numBoxes; ++a )
+  {
+    for( int d = 0; d < 3; ++d )
+    {
+      m_boxMin( a, d ) = boxMin( a, d );
+      m_boxMax( a, d ) = boxMax( a, d );
+      m_gridMin[d] = std::min( m_gridMin[d], boxMin( a, d ) );
+      m_gridMax[d] = std::max( m_gridMax[d], boxMax( a, d ) );
+    }
+  }
+
+  // Choose a cell size giving about one grid cell per object, ignoring the flat dimensions
+  real64 measure = 1.0;
+  int numDims = 0;
+  for( int d = 0; d < 3; ++d )
+  {
+    if( m_gridMax[d] > m_gridMin[d] )
+    {
+      measure *= m_gridMax[d] - m_gridMin[d];
+      ++numDims;
+    }
+  }
+  real64 const targetSize = numDims > 0 ? std::pow( measure / std::max( numBoxes, localIndex( 1 ) ), 1.0 / numDims ) : 1.0;
+
+  for( int d = 0; d < 3; ++d )
+  {
+    real64 const extent = m_gridMax[d] - m_gridMin[d];
+    m_numCells[d] = 1;
+    if( extent > 0.0 )
+    {
+      m_numCells[d] = std::max( localIndex( 1 ),
+                                std::min( numBoxes, static_cast< localIndex >( std::ceil( extent / targetSize ) ) ) );
+    }
+    m_cellSize[d] = extent > 0.0 ? extent / m_numCells[d] : 1.0;
+  }
+
+  // Counting sort of the objects by grid cell: the objects of each cell are ordered by increasing index
+  localIndex const numGridCells = m_numCells[0] * m_numCells[1] * m_numCells[2];
+  m_cellOffsets.resize( numGridCells + 1 );
+  m_cellOffsets.setValues< serialPolicy >( 0 );
+
+  auto forCellsOfBox = [&]( localIndex const a, auto && cellLambda )
+  {
+    localIndex lower[3];
+    localIndex upper[3];
+    for( int d = 0; d < 3; ++d )
+    {
+      lower[d] = cellCoordinate( m_boxMin( a, d ), d );
+      upper[d] = cellCoordinate( m_boxMax( a, d ), d );
+    }
+    for( localIndex i = lower[0]; i <= upper[0]; ++i )
+    {
+      for( localIndex j = lower[1]; j <= upper[1]; ++j )
+      {
+        for( localIndex k = lower[2]; k <= upper[2]; ++k )
+        {
+          cellLambda( gridCell( i, j, k ) );
+        }
+      }
+    }
+  };
+
+  for( localIndex a = 0; a < numBoxes; ++a )
+  {
+    forCellsOfBox( a, [&]( localIndex const cell ) { ++m_cellOffsets[cell + 1]; } );
+  }
+  for( localIndex cell = 0; cell < numGridCells; ++cell )
+  {
+    m_cellOffsets[cell + 1] += m_cellOffsets[cell];
+  }
+
+  m_objects.resize( m_cellOffsets[numGridCells] );
+  array1d< localIndex > fill( numGridCells );
+  for( localIndex a = 0; a < numBoxes; ++a )
+  {
+    forCellsOfBox( a, [&]( localIndex const cell )
+    {
+      m_objects[m_cellOffsets[cell] + fill[cell]++] = a;
+    } );
+  }
+}
+
+} /* namespace geosx */
@@ -0,0 +1,203 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SpatialIndex.hpp
+ */
+
+#ifndef GEOSX_MESH_SPATIALINDEX_HPP_
+#define GEOSX_MESH_SPATIALINDEX_HPP_
+
+#include "common/DataTypes.hpp"
+
+namespace geosx
+{
+
+/**
+ * @class SpatialIndex
+ * @brief A uniform grid over the axis-aligned bounding boxes of a set of objects.
+ *
+ * Each object is registered in all the grid cells its box overlaps. The grid has about as many
+ * cells as there are objects, so that a point or a small box only visits a few candidates.
+ * The objects are identified by their index in the arrays given to build().
+ */
+class SpatialIndex
+{
+public:
+
+  /**
+   * @brief Constructor, the index is empty until build() is called.
+   */
+  SpatialIndex();
+
+  /**
+   * @brief Build the index.
+   * @param boxMin the lower corner of the box of each object (numObjects x 3)
+   * @param boxMax the upper corner of the box of each object (numObjects x 3)
+   */
+  void build( arrayView2d< real64 const > const & boxMin,
+              arrayView2d< real64 const > const & boxMax );
+
+  /**
+   * @brief Get the number of objects in the index.
+   * @return the number of objects
+   */
+  localIndex numObjects() const { return m_boxMin.size( 0 ); }
+
+  /**
+   * @brief Call a function on each object whose box contains a point.
+   * @tparam POINT type of the point, indexable by the dimension
+   * @tparam LAMBDA type of the function, called with the object index
+   * @param point the point
+   * @param lambda the function
+   *
+   * The objects are visited by increasing index.
+   */
+  template< typename POINT, typename LAMBDA >
+  void forObjectsContaining( POINT const & point, LAMBDA && lambda ) const
+  {
+    for( int d = 0; d < 3; ++d )
+    {
+      if( numObjects() == 0 || point[d] < m_gridMin[d] || point[d] > m_gridMax[d] )
+      {
+        return;
+      }
+    }
+
+    localIndex const cell = gridCell( cellCoordinate( point[0], 0 ),
+                                      cellCoordinate( point[1], 1 ),
+                                      cellCoordinate( point[2], 2 ) );
+    for( localIndex k = m_cellOffsets[cell]; k < m_cellOffsets[cell + 1]; ++k )
+    {
+      localIndex const object = m_objects[k];
+      if( m_boxMin( object, 0 ) <= point[0] && point[0] <= m_boxMax( object, 0 ) &&
+          m_boxMin( object, 1 ) <= point[1] && point[1] <= m_boxMax( object, 1 ) &&
+          m_boxMin( object, 2 ) <= point[2] && point[2] <= m_boxMax( object, 2 ) )
+      {
+        lambda( object );
+      }
+    }
+  }
+
+  /**
+   * @brief Call a function once on each object whose box overlaps a box.
+   * @tparam POINT type of the corners, indexable by the dimension
+   * @tparam LAMBDA type of the function, called with the object index
+   * @param queryMin the lower corner of the box
+   * @param queryMax the upper corner of the box
+   * @param lambda the function
+   */
+  template< typename POINT, typename LAMBDA >
+  void forObjectsInBox( POINT const & queryMin, POINT const & queryMax, LAMBDA && lambda ) const
+  {
+    localIndex lower[3];
+    localIndex upper[3];
+    for( int d = 0; d < 3; ++d )
+    {
+      if( numObjects() == 0 || queryMax[d] < m_gridMin[d] || queryMin[d] > m_gridMax[d] )
+      {
+        return;
+      }
+      lower[d] = cellCoordinate( queryMin[d], d );
+      upper[d] = cellCoordinate( queryMax[d], d );
+    }
+
+    for( localIndex i = lower[0]; i <= upper[0]; ++i )
+    {
+      for( localIndex j = lower[1]; j <= upper[1]; ++j )
+      {
+        for( localIndex k = lower[2]; k <= upper[2]; ++k )
+        {
+          localIndex const cell = gridCell( i, j, k );
+          for( localIndex p = m_cellOffsets[cell]; p < m_cellOffsets[cell + 1]; ++p )
+          {
+            localIndex const object = m_objects[p];
+
+            // An object spanning several grid cells is only reported in the cell
+            // holding the lower corner of its intersection with the query box
+            bool reported = true;
+            localIndex const cellCoordinates[3] = { i, j, k };
+            for( int d = 0; d < 3 && reported; ++d )
+            {
+              reported = m_boxMin( object, d ) <= queryMax[d] && queryMin[d] <= m_boxMax( object, d ) &&
+                         cellCoordinate( std::max( m_boxMin( object, d ), real64( queryMin[d] ) ), d ) == cellCoordinates[d];
+            }
+            if( reported )
+            {
+              lambda( object );
+            }
+          }
+        }
+      }
+    }
+  }
+
+private:
+
+  /**
+   * @brief Get the grid coordinate of a position along a dimension.
+   * @param x the position
+   * @param d the dimension
+   * @return the coordinate, clamped to the grid
+   */
+  localIndex cellCoordinate( real64 const x, int const d ) const
+  {
+    real64 const c = ( x - m_gridMin[d] ) / m_cellSize[d];
+    if( c < 1.0 )
+    {
+      return 0;
+    }
+    return c < m_numCells[d] - 1 ? static_cast< localIndex >( c ) : m_numCells[d] - 1;
+  }
+
+  /**
+   * @brief Get the index of a grid cell.
+   * @param i the coordinate along x
+   * @param j the coordinate along y
+   * @param k the coordinate along z
+   * @return the index of the cell
+   */
+  localIndex gridCell( localIndex const i, localIndex const j, localIndex const k ) const
+  {
+    return ( i * m_numCells[1] + j ) * m_numCells[2] + k;
+  }
+
+  /// Lower corner of the grid
+  real64 m_gridMin[3];
+
+  /// Upper corner of the grid
+  real64 m_gridMax[3];
+
+  /// Size of the grid cells along each dimension
+  real64 m_cellSize[3];
+
+  /// Number of grid cells along each dimension
+  localIndex m_numCells[3];
+
+  /// Offsets of the grid cells in m_objects
+  array1d< localIndex > m_cellOffsets;
+
+  /// Objects overlapping each grid cell, by increasing index
+  array1d< localIndex > m_objects;
+
+  /// Lower corner of the box of each object
+  array2d< real64 > m_boxMin;
+
+  /// Upper corner of the box of each object
+  array2d< real64 > m_boxMax;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MESH_SPATIALINDEX_HPP_ */
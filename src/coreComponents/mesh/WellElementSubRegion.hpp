@@ -479,9 +479,6 @@ private:
   /// Radius of the well element
   array1d< real64 > m_radius;
 
-  /// Depth of the local search to match perforation to reservoir elements
-  localIndex m_searchDepth;
-
 };
 
 } /* namespace geosx */
@@ -0,0 +1,188 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/DataTypes.hpp"
+#include "managers/initialization.hpp"
+#include "mesh/SpatialIndex.hpp"
+
+#include <random>
+
+using namespace geosx;
+
+namespace
+{
+
+// Random boxes of various sizes in [0,10]x[0,10]x[0,1]
+void generateBoxes( localIndex const numBoxes,
+                    array2d< real64 > & boxMin,
+                    array2d< real64 > & boxMax )
+{
+  std::mt19937 gen( 2020 );
+  std::uniform_real_distribution< real64 > position( 0.0, 1.0 );
+  std::uniform_real_distribution< real64 > size( 0.0, 0.5 );
+
+  real64 const extent[3] = { 10.0, 10.0, 1.0 };
+  boxMin.resize( numBoxes, 3 );
+  boxMax.resize( numBoxes, 3 );
+  for( localIndex a = 0; a < numBoxes; ++a )
+  {
+    for( int d = 0; d < 3; ++d )
+    {
+      boxMin( a, d ) = extent[d] * position( gen );
+      boxMax( a, d ) = boxMin( a, d ) + ( a % 10 == 0 ? 0.0 : extent[d] * size( gen ) * 0.2 );
+    }
+  }
+}
+
+}
+
+TEST( SpatialIndexTest, PointQueries )
+{
+  array2d< real64 > boxMin, boxMax;
+  generateBoxes( 1000, boxMin, boxMax );
+
+  SpatialIndex index;
+  index.build( boxMin.toViewConst(), boxMax.toViewConst() );
+  EXPECT_EQ( index.numObjects(), 1000 );
+
+  std::mt19937 gen( 0 );
+  std::uniform_real_distribution< real64 > position( -0.5, 11.0 );
+  for( int q = 0; q < 200; ++q )
+  {
+    real64 const point[3] = { position( gen ), position( gen ), 0.1 * position( gen ) };
+
+    array1d< localIndex > expected;
+    for( localIndex a = 0; a < boxMin.size( 0 ); ++a )
+    {
+      if( boxMin( a, 0 ) <= point[0] && point[0] <= boxMax( a, 0 ) &&
+          boxMin( a, 1 ) <= point[1] && point[1] <= boxMax( a, 1 ) &&
+          boxMin( a, 2 ) <= point[2] && point[2] <= boxMax( a, 2 ) )
+      {
+        expected.emplace_back( a );
+      }
+    }
+
+    array1d< localIndex > found;
+    index.forObjectsContaining( point, [&]( localIndex const a ) { found.emplace_back( a ); } );
+
+    ASSERT_EQ( found.size(), expected.size() );
+    for( localIndex i = 0; i < found.size(); ++i )
+    {
+      EXPECT_EQ( found[i], expected[i] );
+    }
+  }
+
+  // The corner of a box of zero size is found
+  real64 const corner[3] = { boxMin( 0, 0 ), boxMin( 0, 1 ), boxMin( 0, 2 ) };
+  bool foundCorner = false;
+  index.forObjectsContaining( corner, [&]( localIndex const a ) { foundCorner = foundCorner || a == 0; } );
+  EXPECT_TRUE( foundCorner );
+}
+
+TEST( SpatialIndexTest, BoxQueries )
+{
+  array2d< real64 > boxMin, boxMax;
+  generateBoxes( 1000, boxMin, boxMax );
+
+  SpatialIndex index;
+  index.build( boxMin.toViewConst(), boxMax.toViewConst() );
+
+  std::mt19937 gen( 1 );
+  std::uniform_real_distribution< real64 > position( -1.0, 11.0 );
+  std::uniform_real_distribution< real64 > size( 0.0, 4.0 );
+  for( int q = 0; q < 200; ++q )
+  {
+    real64 queryMin[3];
+    real64 queryMax[3];
+    for( int d = 0; d < 3; ++d )
+    {
+      queryMin[d] = position( gen );
+      queryMax[d] = queryMin[d] + size( gen );
+    }
+
+    array1d< integer > expected( boxMin.size( 0 ) );
+    for( localIndex a = 0; a < boxMin.size( 0 ); ++a )
+    {
+      expected[a] = boxMin( a, 0 ) <= queryMax[0] && queryMin[0] <= boxMax( a, 0 ) &&
+                    boxMin( a, 1 ) <= queryMax[1] && queryMin[1] <= boxMax( a, 1 ) &&
+                    boxMin( a, 2 ) <= queryMax[2] && queryMin[2] <= boxMax( a, 2 );
+    }
+
+    // Each overlapping box must be reported exactly once
+    array1d< integer > found( boxMin.size( 0 ) );
+    index.forObjectsInBox( queryMin, queryMax, [&]( localIndex const a ) { ++found[a]; } );
+
+    for( localIndex a = 0; a < boxMin.size( 0 ); ++a )
+    {
+      EXPECT_EQ( found[a], expected[a] );
+    }
+  }
+
+  // An unbounded query reports all the boxes
+  real64 const lowest[3] = { std::numeric_limits< real64 >::lowest(),
+                             std::numeric_limits< real64 >::lowest(),
+                             std::numeric_limits< real64 >::lowest() };
+  real64 const highest[3] = { std::numeric_limits< real64 >::max(),
+                              std::numeric_limits< real64 >::max(),
+                              std::numeric_limits< real64 >::max() };
+  localIndex numFound = 0;
+  index.forObjectsInBox( lowest, highest, [&]( localIndex const ) { ++numFound; } );
+  EXPECT_EQ( numFound, boxMin.size( 0 ) );
+}
+
+TEST( SpatialIndexTest, EmptyAndFlat )
+{
+  array2d< real64 > boxMin( 0, 3 );
+  array2d< real64 > boxMax( 0, 3 );
+
+  SpatialIndex index;
+  index.build( boxMin.toViewConst(), boxMax.toViewConst() );
+
+  real64 const origin[3] = { 0.0, 0.0, 0.0 };
+  localIndex numFound = 0;
+  index.forObjectsContaining( origin, [&]( localIndex const ) { ++numFound; } );
+  index.forObjectsInBox( origin, origin, [&]( localIndex const ) { ++numFound; } );
+  EXPECT_EQ( numFound, 0 );
+
+  // Points on a line, as the nodes of a 1D mesh
+  boxMin.resize( 11, 3 );
+  for( localIndex a = 0; a < 11; ++a )
+  {
+    boxMin( a, 0 ) = 0.1 * a;
+    boxMin( a, 1 ) = 2.0;
+    boxMin( a, 2 ) = -1.0;
+  }
+  index.build( boxMin.toViewConst(), boxMin.toViewConst() );
+
+  real64 const queryMin[3] = { 0.25, 1.0, -2.0 };
+  real64 const queryMax[3] = { 0.55, 3.0, 0.0 };
+  array1d< localIndex > found;
+  index.forObjectsInBox( queryMin, queryMax, [&]( localIndex const a ) { found.emplace_back( a ); } );
+  ASSERT_EQ( found.size(), 3 );
+  std::sort( found.begin(), found.end() );
+  EXPECT_EQ( found[0], 3 );
+  EXPECT_EQ( found[1], 4 );
+  EXPECT_EQ( found[2], 5 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,572 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CellBlockRedistribution.cpp
+ */
+
+#include "CellBlockRedistribution.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "dataRepository/BufferOps.hpp"
+#include "mesh/CellBlockManager.hpp"
+#include "mesh/NodeManager.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#if defined(GEOSX_USE_MPI) && defined(GEOSX_USE_PARMETIS)
+#include "parmetis.h"
+#endif
+
+#include <cmath>
+#include <map>
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+namespace
+{
+
+/// The buffer type used for the exchanges.
+using Buffer = std::vector< buffer_unit_type >;
+
+/// The description of a cell block received from a rank.
+struct CellBlockHeader
+{
+  /// The name of the cell block.
+  string name;
+
+  /// The element type of the cell block.
+  string elementType;
+
+  /// The number of cells received.
+  localIndex numCells;
+
+  /// The names of the external properties and their number of components.
+  std::vector< std::pair< string, integer > > properties;
+};
+
+/**
+ * @brief Get the cell blocks of the cell block manager.
+ * @param cellBlockManager the cell block manager
+ * @return the cell blocks, in the order used to number the cells consecutively
+ */
+std::vector< CellBlock * > getCellBlocks( CellBlockManager & cellBlockManager )
+{
+  std::vector< CellBlock * > cellBlocks;
+  cellBlockManager.forElementSubRegions( [&]( CellBlock & cellBlock )
+  {
+    cellBlocks.push_back( &cellBlock );
+  } );
+  return cellBlocks;
+}
+
+/**
+ * @brief Get the number of components of an external property.
+ * @param wrapper the wrapper of the external property
+ * @return the number of components
+ */
+integer numPropertyComponents( WrapperBase const & wrapper )
+{
+  if( wrapper.get_typeid() == typeid( array1d< R1Tensor > ) )
+  {
+    return 3;
+  }
+  GEOSX_ERROR_IF( wrapper.get_typeid() != typeid( array1d< real64 > ),
+                  "The external property " << wrapper.getName() << " cannot be redistributed." );
+  return 1;
+}
+
+/**
+ * @brief Pack the cells sent to a rank, with their nodes.
+ * @tparam DO_PACKING whether to pack or only compute the size of the buffer
+ * @param buffer the buffer, advanced upon completion
+ * @param cellBlocks the cell blocks of this rank
+ * @param cellLists the cells sent, for each cell block
+ * @param nodeList the nodes of the cells sent
+ * @param nodeManager the node manager
+ * @return the packed size
+ */
+template< bool DO_PACKING >
+localIndex packCells( buffer_unit_type * & buffer,
+                      std::vector< CellBlock * > const & cellBlocks,
+                      std::vector< array1d< localIndex > > const & cellLists,
+                      arrayView1d< localIndex const > const & nodeList,
+                      NodeManager const & nodeManager )
+{
+  localIndex packedSize = 0;
+
+  // The header describing the cell blocks, including those without any cell sent to keep them on every rank.
+  packedSize += bufferOps::Pack< DO_PACKING >( buffer, LvArray::integerConversion< localIndex >( cellBlocks.size() ) );
+  for( std::size_t b = 0; b < cellBlocks.size(); ++b )
+  {
+    CellBlock & cellBlock = *cellBlocks[b];
+    packedSize += bufferOps::Pack< DO_PACKING >( buffer, cellBlock.getName() );
+    packedSize += bufferOps::Pack< DO_PACKING >( buffer, cellBlock.GetElementTypeString() );
+    packedSize += bufferOps::Pack< DO_PACKING >( buffer, cellLists[b].size() );
+
+    localIndex numProperties = 0;
+    cellBlock.forExternalProperties( [&]( WrapperBase * const )
+    {
+      ++numProperties;
+    } );
+    packedSize += bufferOps::Pack< DO_PACKING >( buffer, numProperties );
+    cellBlock.forExternalProperties( [&]( WrapperBase * const wrapper )
+    {
+      packedSize += bufferOps::Pack< DO_PACKING >( buffer, wrapper->getName() );
+      packedSize += bufferOps::Pack< DO_PACKING >( buffer, numPropertyComponents( *wrapper ) );
+    } );
+  }
+
+  // The nodes, with their coordinates and the node sets they belong to.
+  arrayView1d< globalIndex const > const nodeLocalToGlobal = nodeManager.localToGlobalMap();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+
+  packedSize += bufferOps::Pack< DO_PACKING >( buffer, nodeList.size() );
+  for( localIndex const a : nodeList )
+  {
+    packedSize += bufferOps::Pack< DO_PACKING >( buffer, nodeLocalToGlobal[a] );
+    for( int i = 0; i < 3; ++i )
+    {
+      packedSize += bufferOps::Pack< DO_PACKING >( buffer, X( a, i ) );
+    }
+  }
+
+  localIndex numSets = 0;
+  nodeManager.sets().forWrappers< SortedArray< localIndex > >( [&]( auto const & )
+  {
+    ++numSets;
+  } );
+  packedSize += bufferOps::Pack< DO_PACKING >( buffer, numSets );
+  nodeManager.sets().forWrappers< SortedArray< localIndex > >( [&]( auto const & wrapper )
+  {
+    SortedArrayView< localIndex const > const set = wrapper.reference().toViewConst();
+    array1d< globalIndex > setNodes;
+    for( localIndex const a : nodeList )
+    {
+      if( set.contains( a ) )
+      {
+        setNodes.emplace_back( nodeLocalToGlobal[a] );
+      }
+    }
+    packedSize += bufferOps::Pack< DO_PACKING >( buffer, wrapper.getName() );
+    packedSize += bufferOps::Pack< DO_PACKING >( buffer, setNodes.toViewConst() );
+  } );
+
+  // The cells, with the global indices of their nodes and their external properties.
+  for( std::size_t b = 0; b < cellBlocks.size(); ++b )
+  {
+    CellBlock & cellBlock = *cellBlocks[b];
+    arrayView1d< localIndex const > const cellList = cellLists[b].toViewConst();
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const cellToNodes = cellBlock.nodeList().toViewConst();
+
+    packedSize += bufferOps::PackByIndex< DO_PACKING >( buffer, cellBlock.localToGlobalMap().toViewConst(), cellList );
+    for( localIndex const k : cellList )
+    {
+      for( localIndex a = 0; a < cellToNodes.size( 1 ); ++a )
+      {
+        packedSize += bufferOps::Pack< DO_PACKING >( buffer, nodeLocalToGlobal[ cellToNodes( k, a ) ] );
+      }
+    }
+
+    cellBlock.forExternalProperties( [&]( WrapperBase * const wrapper )
+    {
+      packedSize += DO_PACKING ? wrapper->PackByIndex( buffer, cellList, false, false )
+                               : wrapper->PackByIndexSize( cellList, false, false );
+    } );
+  }
+
+  return packedSize;
+}
+
+/**
+ * @brief Unpack the header and the nodes of the cells received from a rank.
+ * @param buffer the buffer, advanced to the cells upon completion
+ * @param headers the cell blocks received
+ * @param nodes the coordinates of the nodes received, indexed by their global index
+ * @param nodeSets the nodes of each node set received
+ */
+void unpackHeaderAndNodes( buffer_unit_type const * & buffer,
+                           std::vector< CellBlockHeader > & headers,
+                           std::map< globalIndex, std::array< real64, 3 > > & nodes,
+                           std::map< string, std::vector< globalIndex > > & nodeSets )
+{
+  localIndex numCellBlocks;
+  bufferOps::Unpack( buffer, numCellBlocks );
+  headers.resize( numCellBlocks );
+  for( CellBlockHeader & header : headers )
+  {
+    bufferOps::Unpack( buffer, header.name );
+    bufferOps::Unpack( buffer, header.elementType );
+    bufferOps::Unpack( buffer, header.numCells );
+
+    localIndex numProperties;
+    bufferOps::Unpack( buffer, numProperties );
+    header.properties.resize( numProperties );
+    for( std::pair< string, integer > & property : header.properties )
+    {
+      bufferOps::Unpack( buffer, property.first );
+      bufferOps::Unpack( buffer, property.second );
+    }
+  }
+
+  localIndex numNodes;
+  bufferOps::Unpack( buffer, numNodes );
+  for( localIndex a = 0; a < numNodes; ++a )
+  {
+    globalIndex nodeGlobalIndex;
+    std::array< real64, 3 > coords;
+    bufferOps::Unpack( buffer, nodeGlobalIndex );
+    for( int i = 0; i < 3; ++i )
+    {
+      bufferOps::Unpack( buffer, coords[i] );
+    }
+    nodes[nodeGlobalIndex] = coords;
+  }
+
+  localIndex numSets;
+  bufferOps::Unpack( buffer, numSets );
+  for( localIndex s = 0; s < numSets; ++s )
+  {
+    string setName;
+    array1d< globalIndex > setNodes;
+    bufferOps::Unpack( buffer, setName );
+    bufferOps::Unpack( buffer, setNodes );
+    std::vector< globalIndex > & nodeSet = nodeSets[setName];
+    nodeSet.insert( nodeSet.end(), setNodes.begin(), setNodes.end() );
+  }
+}
+
+/**
+ * @brief Compute the ranks sharing nodes with this rank.
+ * @param nodeLocalToGlobal the global indices of the nodes of this rank
+ * @return the neighbor ranks
+ *
+ * The nodes are sent to a rendezvous rank computed from their global index, which replies
+ * with the other ranks holding the nodes.
+ */
+std::set< int > computeNeighborRanks( arrayView1d< globalIndex const > const & nodeLocalToGlobal )
+{
+  int const numRanks = MpiWrapper::Comm_size( MPI_COMM_GEOSX );
+  int const rank = MpiWrapper::Comm_rank( MPI_COMM_GEOSX );
+
+  std::vector< std::vector< globalIndex > > sendNodes( numRanks );
+  for( globalIndex const nodeGlobalIndex : nodeLocalToGlobal )
+  {
+    sendNodes[ nodeGlobalIndex % numRanks ].push_back( nodeGlobalIndex );
+  }
+  std::vector< std::vector< globalIndex > > const recvNodes = MpiWrapper::allToAllv( sendNodes, MPI_COMM_GEOSX );
+
+  std::map< globalIndex, std::vector< int > > nodeRanks;
+  for( int r = 0; r < numRanks; ++r )
+  {
+    for( globalIndex const nodeGlobalIndex : recvNodes[r] )
+    {
+      nodeRanks[nodeGlobalIndex].push_back( r );
+    }
+  }
+
+  std::vector< std::vector< int > > sendRanks( numRanks );
+  for( auto const & nodeAndRanks : nodeRanks )
+  {
+    for( int const r : nodeAndRanks.second )
+    {
+      sendRanks[r].insert( sendRanks[r].end(), nodeAndRanks.second.begin(), nodeAndRanks.second.end() );
+    }
+  }
+  std::vector< std::vector< int > > const recvRanks = MpiWrapper::allToAllv( sendRanks, MPI_COMM_GEOSX );
+
+  std::set< int > neighborRanks;
+  for( std::vector< int > const & ranks : recvRanks )
+  {
+    neighborRanks.insert( ranks.begin(), ranks.end() );
+  }
+  neighborRanks.erase( rank );
+  return neighborRanks;
+}
+
+} // namespace
+
+array1d< int > partitionCellGraph( CellBlockManager & cellBlockManager,
+                                   NodeManager const & nodeManager,
+                                   string const & weightFieldName )
+{
+  GEOSX_MARK_FUNCTION;
+
+  std::vector< CellBlock * > const cellBlocks = getCellBlocks( cellBlockManager );
+  localIndex numCells = 0;
+  for( CellBlock const * const cellBlock : cellBlocks )
+  {
+    numCells += cellBlock->size();
+  }
+
+  int const numRanks = MpiWrapper::Comm_size( MPI_COMM_GEOSX );
+  array1d< int > targetRanks( numCells );
+  if( numRanks == 1 )
+  {
+    return targetRanks;
+  }
+
+#if defined(GEOSX_USE_MPI) && defined(GEOSX_USE_PARMETIS)
+  array1d< localIndex > numCellsPerRank;
+  MpiWrapper::allGather( numCells, numCellsPerRank );
+
+  std::vector< idx_t > cellDist( numRanks + 1, 0 );
+  for( int r = 0; r < numRanks; ++r )
+  {
+    GEOSX_ERROR_IF_EQ_MSG( numCellsPerRank[r], 0,
+                           "The graph partitioning requires at least one cell on each rank before the partitioning." );
+    cellDist[r + 1] = cellDist[r] + LvArray::integerConversion< idx_t >( numCellsPerRank[r] );
+  }
+
+  // The cells in the mesh format expected by ParMETIS, which builds the dual graph.
+  arrayView1d< globalIndex const > const nodeLocalToGlobal = nodeManager.localToGlobalMap();
+  std::vector< idx_t > cellPtr( 1, 0 );
+  std::vector< idx_t > cellNodes;
+  std::vector< idx_t > cellWeights;
+  cellPtr.reserve( numCells + 1 );
+  cellWeights.reserve( numCells );
+
+  for( CellBlock * const cellBlock : cellBlocks )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const cellToNodes = cellBlock->nodeList().toViewConst();
+    bool const hasWeights = !weightFieldName.empty() && cellBlock->hasWrapper( weightFieldName );
+    array1d< real64 > const unitWeights;
+    arrayView1d< real64 const > const weights = hasWeights
+                                                ? cellBlock->getReference< array1d< real64 > >( weightFieldName ).toViewConst()
+                                                : unitWeights.toViewConst();
+
+    for( localIndex k = 0; k < cellBlock->size(); ++k )
+    {
+      for( localIndex a = 0; a < cellToNodes.size( 1 ); ++a )
+      {
+        cellNodes.push_back( LvArray::integerConversion< idx_t >( nodeLocalToGlobal[ cellToNodes( k, a ) ] ) );
+      }
+      cellPtr.push_back( LvArray::integerConversion< idx_t >( cellNodes.size() ) );
+      cellWeights.push_back( hasWeights ? std::max( idx_t( 1 ), idx_t( std::lround( weights[k] ) ) ) : 1 );
+    }
+  }
+
+  // Two cells are connected when they share a face, i.e. at least three nodes.
+  idx_t weightFlag = weightFieldName.empty() ? 0 : 2;
+  idx_t numFlag = 0;
+  idx_t numConstraints = 1;
+  idx_t numCommonNodes = 3;
+  idx_t numParts = numRanks;
+  std::vector< real_t > targetPartWeights( numRanks, 1.0 / numRanks );
+  real_t imbalanceTolerance = 1.05;
+  idx_t options[3] = { 0, 0, 0 };
+  idx_t edgeCut = 0;
+  std::vector< idx_t > parts( numCells );
+  MPI_Comm comm = MPI_COMM_GEOSX;
+
+  int const result = ParMETIS_V3_PartMeshKway( cellDist.data(), cellPtr.data(), cellNodes.data(),
+                                               weightFlag == 0 ? nullptr : cellWeights.data(), &weightFlag, &numFlag,
+                                               &numConstraints, &numCommonNodes, &numParts,
+                                               targetPartWeights.data(), &imbalanceTolerance, options,
+                                               &edgeCut, parts.data(), &comm );
+  GEOSX_ERROR_IF_NE_MSG( result, METIS_OK, "ParMETIS failed to partition the cell graph" );
+
+  for( localIndex k = 0; k < numCells; ++k )
+  {
+    targetRanks[k] = LvArray::integerConversion< int >( parts[k] );
+  }
+#else
+  GEOSX_UNUSED_VAR( nodeManager );
+  GEOSX_UNUSED_VAR( weightFieldName );
+  GEOSX_ERROR( "The graph partitioning of the cells requires GEOSX to be built with MPI and ParMETIS." );
+#endif
+
+  return targetRanks;
+}
+
+void redistributeCellBlocks( arrayView1d< int const > const & targetRanks,
+                             CellBlockManager & cellBlockManager,
+                             NodeManager & nodeManager,
+                             std::set< int > & neighborRanks )
+{
+  GEOSX_MARK_FUNCTION;
+
+  int const numRanks = MpiWrapper::Comm_size( MPI_COMM_GEOSX );
+  std::vector< CellBlock * > const cellBlocks = getCellBlocks( cellBlockManager );
+
+  // Sort the cells and their nodes by target rank, the cells staying on this rank being sent to itself.
+  std::vector< std::vector< array1d< localIndex > > > cellLists( numRanks, std::vector< array1d< localIndex > >( cellBlocks.size() ) );
+  std::vector< std::set< localIndex > > nodeLists( numRanks );
+  localIndex cellIndex = 0;
+  for( std::size_t b = 0; b < cellBlocks.size(); ++b )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const cellToNodes = cellBlocks[b]->nodeList().toViewConst();
+    for( localIndex k = 0; k < cellBlocks[b]->size(); ++k, ++cellIndex )
+    {
+      int const r = targetRanks[cellIndex];
+      cellLists[r][b].emplace_back( k );
+      for( localIndex a = 0; a < cellToNodes.size( 1 ); ++a )
+      {
+        nodeLists[r].insert( cellToNodes( k, a ) );
+      }
+    }
+  }
+  GEOSX_ERROR_IF_NE( cellIndex, targetRanks.size() );
+
+  std::vector< Buffer > sendBuffers( numRanks );
+  for( int r = 0; r < numRanks; ++r )
+  {
+    array1d< localIndex > nodeList;
+    nodeList.reserve( nodeLists[r].size() );
+    for( localIndex const a : nodeLists[r] )
+    {
+      nodeList.emplace_back( a );
+    }
+
+    buffer_unit_type * junk = nullptr;
+    sendBuffers[r].resize( packCells< false >( junk, cellBlocks, cellLists[r], nodeList.toViewConst(), nodeManager ) );
+    buffer_unit_type * buffer = sendBuffers[r].data();
+    packCells< true >( buffer, cellBlocks, cellLists[r], nodeList.toViewConst(), nodeManager );
+  }
+
+  std::vector< Buffer > const recvBuffers = MpiWrapper::allToAllv( sendBuffers, MPI_COMM_GEOSX );
+
+  std::vector< std::vector< CellBlockHeader > > headers( numRanks );
+  std::vector< buffer_unit_type const * > cellBuffers( numRanks );
+  std::map< globalIndex, std::array< real64, 3 > > nodes;
+  std::map< string, std::vector< globalIndex > > nodeSets;
+  for( int r = 0; r < numRanks; ++r )
+  {
+    cellBuffers[r] = recvBuffers[r].data();
+    unpackHeaderAndNodes( cellBuffers[r], headers[r], nodes, nodeSets );
+  }
+
+  // Rebuild the nodes, ordered by global index.
+  nodeManager.resize( LvArray::integerConversion< localIndex >( nodes.size() ) );
+  {
+    arrayView1d< globalIndex > const nodeLocalToGlobal = nodeManager.localToGlobalMap();
+    arrayView2d< real64, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+    localIndex a = 0;
+    for( auto const & node : nodes )
+    {
+      nodeLocalToGlobal[a] = node.first;
+      for( int i = 0; i < 3; ++i )
+      {
+        X( a, i ) = node.second[i];
+      }
+      ++a;
+    }
+  }
+  nodeManager.ConstructGlobalToLocalMap();
+  unordered_map< globalIndex, localIndex > const & nodeGlobalToLocal = nodeManager.globalToLocalMap();
+
+  Group & nodeSetsGroup = nodeManager.sets();
+  nodeSetsGroup.forWrappers< SortedArray< localIndex > >( [&]( auto & wrapper )
+  {
+    wrapper.reference().clear();
+  } );
+  for( auto const & nodeSet : nodeSets )
+  {
+    SortedArray< localIndex > & set = nodeSetsGroup.hasWrapper( nodeSet.first )
+                                      ? nodeSetsGroup.getReference< SortedArray< localIndex > >( nodeSet.first )
+                                      : nodeSetsGroup.registerWrapper< SortedArray< localIndex > >( nodeSet.first )->reference();
+    for( globalIndex const nodeGlobalIndex : nodeSet.second )
+    {
+      set.insert( nodeGlobalToLocal.at( nodeGlobalIndex ) );
+    }
+  }
+
+  // Resize the cell blocks, creating those received by this rank for the first time.
+  std::map< string, localIndex > numCellsPerBlock;
+  for( CellBlock * const cellBlock : cellBlocks )
+  {
+    numCellsPerBlock[ cellBlock->getName() ] = 0;
+  }
+  for( int r = 0; r < numRanks; ++r )
+  {
+    for( CellBlockHeader const & header : headers[r] )
+    {
+      numCellsPerBlock[ header.name ] += header.numCells;
+
+      CellBlock * cellBlock = cellBlockManager.GetRegion( header.name );
+      if( cellBlock == nullptr )
+      {
+        cellBlock = cellBlockManager.GetGroup( keys::cellBlocks )->RegisterGroup< CellBlock >( header.name );
+        cellBlock->SetElementType( header.elementType );
+      }
+      for( std::pair< string, integer > const & property : header.properties )
+      {
+        if( !cellBlock->hasWrapper( property.first ) )
+        {
+          if( property.second == 3 )
+          {
+            cellBlock->AddProperty< array1d< R1Tensor > >( property.first );
+          }
+          else
+          {
+            cellBlock->AddProperty< array1d< real64 > >( property.first );
+          }
+        }
+      }
+    }
+  }
+
+  for( auto const & blockAndSize : numCellsPerBlock )
+  {
+    CellBlock & cellBlock = *cellBlockManager.GetRegion( blockAndSize.first );
+    cellBlock.resize( blockAndSize.second );
+    cellBlock.nodeList().resize( blockAndSize.second, cellBlock.numNodesPerElement() );
+  }
+
+  // Unpack the cells, in the order of the source ranks.
+  std::map< string, localIndex > cellOffsets;
+  for( int r = 0; r < numRanks; ++r )
+  {
+    buffer_unit_type const * buffer = cellBuffers[r];
+    for( CellBlockHeader const & header : headers[r] )
+    {
+      CellBlock & cellBlock = *cellBlockManager.GetRegion( header.name );
+      localIndex & offset = cellOffsets[ header.name ];
+
+      array1d< localIndex > unpackList( header.numCells );
+      for( localIndex i = 0; i < header.numCells; ++i )
+      {
+        unpackList[i] = offset + i;
+      }
+
+      arrayView1d< globalIndex > cellLocalToGlobal = cellBlock.localToGlobalMap();
+      bufferOps::UnpackByIndex( buffer, cellLocalToGlobal, unpackList.toViewConst() );
+
+      arrayView2d< localIndex, cells::NODE_MAP_USD > const cellToNodes = cellBlock.nodeList().toView();
+      for( localIndex const k : unpackList )
+      {
+        for( localIndex a = 0; a < cellToNodes.size( 1 ); ++a )
+        {
+          globalIndex nodeGlobalIndex;
+          bufferOps::Unpack( buffer, nodeGlobalIndex );
+          cellToNodes( k, a ) = nodeGlobalToLocal.at( nodeGlobalIndex );
+        }
+      }
+
+      for( std::pair< string, integer > const & property : header.properties )
+      {
+        cellBlock.getWrapperBase( property.first )->UnpackByIndex( buffer, unpackList.toViewConst(), false, false );
+      }
+
+      offset += header.numCells;
+    }
+    GEOSX_ERROR_IF_NE( buffer, recvBuffers[r].data() + recvBuffers[r].size() );
+  }
+
+  neighborRanks = computeNeighborRanks( nodeManager.localToGlobalMap().toViewConst() );
+}
+
+} /* namespace geosx */
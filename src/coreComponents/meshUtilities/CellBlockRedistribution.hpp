@@ -0,0 +1,66 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CellBlockRedistribution.hpp
+ */
+
+#ifndef GEOSX_MESHUTILITIES_CELLBLOCKREDISTRIBUTION_HPP_
+#define GEOSX_MESHUTILITIES_CELLBLOCKREDISTRIBUTION_HPP_
+
+#include "common/DataTypes.hpp"
+
+#include <set>
+
+namespace geosx
+{
+
+class CellBlockManager;
+class NodeManager;
+
+/**
+ * @brief Compute the rank of each cell with a graph partitioning of the cells.
+ * @param cellBlockManager the cell blocks holding the cells of this rank
+ * @param nodeManager the node manager holding the nodes of the cells of this rank
+ * @param weightFieldName the name of a cell field holding the weight of the cells,
+ *                        or an empty string to give the same weight to all the cells
+ * @return the rank of each cell, the cells of the cell blocks being numbered consecutively
+ *
+ * The dual graph of the cells (two cells being connected when they share a face) is built
+ * and partitioned with ParMETIS in as many parts as there are ranks. The weights are rounded to
+ * the nearest positive integer, the cells of the cell blocks without the weight field having a
+ * weight of one.
+ */
+array1d< int > partitionCellGraph( CellBlockManager & cellBlockManager,
+                                   NodeManager const & nodeManager,
+                                   string const & weightFieldName );
+
+/**
+ * @brief Move the cells and their nodes to their new rank.
+ * @param targetRanks the rank of each cell, as returned by partitionCellGraph
+ * @param cellBlockManager the cell blocks holding the cells of this rank
+ * @param nodeManager the node manager holding the nodes of the cells of this rank
+ * @param neighborRanks the ranks sharing nodes with this rank after the redistribution
+ *
+ * This must be called before the ghosting: only the nodes of the cells, the cell-to-node maps,
+ * the node sets and the external properties of the cell blocks are redistributed.
+ */
+void redistributeCellBlocks( arrayView1d< int const > const & targetRanks,
+                             CellBlockManager & cellBlockManager,
+                             NodeManager & nodeManager,
+                             std::set< int > & neighborRanks );
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MESHUTILITIES_CELLBLOCKREDISTRIBUTION_HPP_ */
@@ -0,0 +1,429 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CellBlockReordering.cpp
+ */
+
+#include "CellBlockReordering.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "mesh/CellBlockManager.hpp"
+#include "mesh/NodeManager.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+namespace
+{
+
+/**
+ * @brief Get the cell blocks of the cell block manager.
+ * @param cellBlockManager the cell block manager
+ * @return the cell blocks, in the order used to number the cells consecutively
+ */
+std::vector< CellBlock * > getCellBlocks( CellBlockManager & cellBlockManager )
+{
+  std::vector< CellBlock * > cellBlocks;
+  cellBlockManager.forElementSubRegions( [&]( CellBlock & cellBlock )
+  {
+    cellBlocks.push_back( &cellBlock );
+  } );
+  return cellBlocks;
+}
+
+/**
+ * @brief Get the cell-to-node maps of the cell blocks.
+ * @param cellBlocks the cell blocks
+ * @return the cell-to-node map of each cell block
+ */
+std::vector< arrayView2d< localIndex const, cells::NODE_MAP_USD > >
+getCellToNodes( std::vector< CellBlock * > const & cellBlocks )
+{
+  std::vector< arrayView2d< localIndex const, cells::NODE_MAP_USD > > cellToNodes;
+  for( CellBlock const * const cellBlock : cellBlocks )
+  {
+    cellToNodes.emplace_back( cellBlock->nodeList().toViewConst() );
+  }
+  return cellToNodes;
+}
+
+/**
+ * @brief Spread the 21 lowest bits of an integer to every third bit.
+ * @param x the integer
+ * @return the spread bits
+ */
+std::uint64_t spreadBits( std::uint64_t x )
+{
+  x &= 0x1fffff;
+  x = ( x | x << 32 ) & 0x1f00000000ffff;
+  x = ( x | x << 16 ) & 0x1f0000ff0000ff;
+  x = ( x | x << 8 ) & 0x100f00f00f00f00f;
+  x = ( x | x << 4 ) & 0x10c30c30c30c30c3;
+  x = ( x | x << 2 ) & 0x1249249249249249;
+  return x;
+}
+
+/**
+ * @brief Order the cells along the Morton curve of their centers.
+ * @param cellToNodes the cell-to-node map of each cell block
+ * @param nodeManager the node manager
+ * @param numCells the number of cells of the cell blocks
+ * @return the cells in their new order, the cells of the cell blocks being numbered consecutively
+ *
+ * The centers are quantized on 21 bits per direction in the bounding box of the nodes.
+ */
+std::vector< localIndex >
+computeMortonOrder( std::vector< arrayView2d< localIndex const, cells::NODE_MAP_USD > > const & cellToNodes,
+                    NodeManager const & nodeManager,
+                    localIndex const numCells )
+{
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+
+  real64 xMin[3] = { std::numeric_limits< real64 >::max(), std::numeric_limits< real64 >::max(), std::numeric_limits< real64 >::max() };
+  real64 xMax[3] = { std::numeric_limits< real64 >::lowest(), std::numeric_limits< real64 >::lowest(), std::numeric_limits< real64 >::lowest() };
+  for( localIndex a = 0; a < X.size( 0 ); ++a )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      xMin[i] = std::min( xMin[i], X( a, i ) );
+      xMax[i] = std::max( xMax[i], X( a, i ) );
+    }
+  }
+
+  real64 scale[3];
+  for( int i = 0; i < 3; ++i )
+  {
+    scale[i] = xMax[i] > xMin[i] ? ( ( 1 << 21 ) - 1 ) / ( xMax[i] - xMin[i] ) : 0.0;
+  }
+
+  std::vector< std::uint64_t > keys;
+  keys.reserve( numCells );
+  for( arrayView2d< localIndex const, cells::NODE_MAP_USD > const & blockCellToNodes : cellToNodes )
+  {
+    localIndex const numNodesPerCell = blockCellToNodes.size( 1 );
+    for( localIndex k = 0; k < blockCellToNodes.size( 0 ); ++k )
+    {
+      std::uint64_t key = 0;
+      for( int i = 0; i < 3; ++i )
+      {
+        real64 center = 0.0;
+        for( localIndex a = 0; a < numNodesPerCell; ++a )
+        {
+          center += X( blockCellToNodes( k, a ), i );
+        }
+        center /= numNodesPerCell;
+        key |= spreadBits( static_cast< std::uint64_t >( ( center - xMin[i] ) * scale[i] ) ) << i;
+      }
+      keys.push_back( key );
+    }
+  }
+
+  std::vector< localIndex > order( numCells );
+  std::iota( order.begin(), order.end(), 0 );
+  std::stable_sort( order.begin(), order.end(), [&]( localIndex const c0, localIndex const c1 )
+  {
+    return keys[c0] < keys[c1];
+  } );
+  return order;
+}
+
+/**
+ * @brief Order the cells with the reverse Cuthill-McKee algorithm.
+ * @param cellToNodes the cell-to-node map of each cell block
+ * @param numNodes the number of nodes
+ * @param numCells the number of cells of the cell blocks
+ * @return the cells in their new order, the cells of the cell blocks being numbered consecutively
+ *
+ * Two cells are connected when they share a node. Each connected component is traversed breadth
+ * first from its cell of lowest degree, the neighbors of a cell being visited by increasing degree.
+ */
+std::vector< localIndex >
+computeReverseCuthillMcKeeOrder( std::vector< arrayView2d< localIndex const, cells::NODE_MAP_USD > > const & cellToNodes,
+                                 localIndex const numNodes,
+                                 localIndex const numCells )
+{
+  // The node-to-cell map, in compressed row format.
+  std::vector< localIndex > nodeCellOffsets( numNodes + 1, 0 );
+  for( arrayView2d< localIndex const, cells::NODE_MAP_USD > const & blockCellToNodes : cellToNodes )
+  {
+    for( localIndex k = 0; k < blockCellToNodes.size( 0 ); ++k )
+    {
+      for( localIndex a = 0; a < blockCellToNodes.size( 1 ); ++a )
+      {
+        ++nodeCellOffsets[ blockCellToNodes( k, a ) + 1 ];
+      }
+    }
+  }
+  std::partial_sum( nodeCellOffsets.begin(), nodeCellOffsets.end(), nodeCellOffsets.begin() );
+
+  std::vector< localIndex > nodeCells( nodeCellOffsets.back() );
+  std::vector< localIndex > nodeCellPositions( nodeCellOffsets.begin(), nodeCellOffsets.end() - 1 );
+  localIndex cellIndex = 0;
+  for( arrayView2d< localIndex const, cells::NODE_MAP_USD > const & blockCellToNodes : cellToNodes )
+  {
+    for( localIndex k = 0; k < blockCellToNodes.size( 0 ); ++k, ++cellIndex )
+    {
+      for( localIndex a = 0; a < blockCellToNodes.size( 1 ); ++a )
+      {
+        nodeCells[ nodeCellPositions[ blockCellToNodes( k, a ) ]++ ] = cellIndex;
+      }
+    }
+  }
+
+  // The cell graph, in compressed row format.
+  std::vector< localIndex > cellNeighborOffsets( 1, 0 );
+  std::vector< localIndex > cellNeighbors;
+  std::vector< localIndex > lastVisitor( numCells, -1 );
+  cellNeighborOffsets.reserve( numCells + 1 );
+  cellIndex = 0;
+  for( arrayView2d< localIndex const, cells::NODE_MAP_USD > const & blockCellToNodes : cellToNodes )
+  {
+    for( localIndex k = 0; k < blockCellToNodes.size( 0 ); ++k, ++cellIndex )
+    {
+      for( localIndex a = 0; a < blockCellToNodes.size( 1 ); ++a )
+      {
+        localIndex const node = blockCellToNodes( k, a );
+        for( localIndex j = nodeCellOffsets[node]; j < nodeCellOffsets[node + 1]; ++j )
+        {
+          localIndex const neighbor = nodeCells[j];
+          if( neighbor != cellIndex && lastVisitor[neighbor] != cellIndex )
+          {
+            lastVisitor[neighbor] = cellIndex;
+            cellNeighbors.push_back( neighbor );
+          }
+        }
+      }
+      cellNeighborOffsets.push_back( LvArray::integerConversion< localIndex >( cellNeighbors.size() ) );
+    }
+  }
+
+  auto const lowerDegree = [&]( localIndex const c0, localIndex const c1 )
+  {
+    return cellNeighborOffsets[c0 + 1] - cellNeighborOffsets[c0] < cellNeighborOffsets[c1 + 1] - cellNeighborOffsets[c1];
+  };
+
+  std::vector< localIndex > startCells( numCells );
+  std::iota( startCells.begin(), startCells.end(), 0 );
+  std::stable_sort( startCells.begin(), startCells.end(), lowerDegree );
+
+  std::vector< localIndex > order;
+  order.reserve( numCells );
+  std::vector< bool > visited( numCells, false );
+  std::vector< localIndex > neighbors;
+  for( localIndex const startCell : startCells )
+  {
+    if( visited[startCell] )
+    {
+      continue;
+    }
+    visited[startCell] = true;
+    order.push_back( startCell );
+
+    for( std::size_t head = order.size() - 1; head < order.size(); ++head )
+    {
+      localIndex const cell = order[head];
+      neighbors.clear();
+      for( localIndex j = cellNeighborOffsets[cell]; j < cellNeighborOffsets[cell + 1]; ++j )
+      {
+        localIndex const neighbor = cellNeighbors[j];
+        if( !visited[neighbor] )
+        {
+          visited[neighbor] = true;
+          neighbors.push_back( neighbor );
+        }
+      }
+      std::stable_sort( neighbors.begin(), neighbors.end(), lowerDegree );
+      order.insert( order.end(), neighbors.begin(), neighbors.end() );
+    }
+  }
+
+  std::reverse( order.begin(), order.end() );
+  return order;
+}
+
+/**
+ * @brief Permute the values of an array.
+ * @tparam T the type of the values
+ * @param values the values, permuted upon completion
+ * @param newToOld the old index of each new index
+ */
+template< typename T >
+void permuteValues( arrayView1d< T > const & values,
+                    arrayView1d< localIndex const > const & newToOld )
+{
+  array1d< T > oldValues( values.size() );
+  for( localIndex i = 0; i < values.size(); ++i )
+  {
+    oldValues[i] = values[i];
+  }
+  for( localIndex i = 0; i < values.size(); ++i )
+  {
+    values[i] = oldValues[ newToOld[i] ];
+  }
+}
+
+/**
+ * @brief Permute the rows of a two-dimensional array.
+ * @tparam T the type of the values
+ * @tparam USD the unit stride dimension of the array
+ * @param values the values, permuted upon completion
+ * @param newToOld the old index of each new row
+ */
+template< typename T, int USD >
+void permuteRows( arrayView2d< T, USD > const & values,
+                  arrayView1d< localIndex const > const & newToOld )
+{
+  array2d< T > oldValues( values.size( 0 ), values.size( 1 ) );
+  for( localIndex i = 0; i < values.size( 0 ); ++i )
+  {
+    for( localIndex j = 0; j < values.size( 1 ); ++j )
+    {
+      oldValues( i, j ) = values( i, j );
+    }
+  }
+  for( localIndex i = 0; i < values.size( 0 ); ++i )
+  {
+    for( localIndex j = 0; j < values.size( 1 ); ++j )
+    {
+      values( i, j ) = oldValues( newToOld[i], j );
+    }
+  }
+}
+
+} // namespace
+
+void reorderCellBlocks( MeshReorderingMethod const method,
+                        CellBlockManager & cellBlockManager,
+                        NodeManager & nodeManager )
+{
+  GEOSX_MARK_FUNCTION;
+
+  if( method == MeshReorderingMethod::none )
+  {
+    return;
+  }
+
+  std::vector< CellBlock * > const cellBlocks = getCellBlocks( cellBlockManager );
+  std::vector< arrayView2d< localIndex const, cells::NODE_MAP_USD > > const cellToNodes = getCellToNodes( cellBlocks );
+  std::vector< localIndex > blockOffsets( 1, 0 );
+  for( CellBlock const * const cellBlock : cellBlocks )
+  {
+    blockOffsets.push_back( blockOffsets.back() + cellBlock->size() );
+  }
+  localIndex const numCells = blockOffsets.back();
+  localIndex const numNodes = nodeManager.size();
+
+  std::vector< localIndex > const order = method == MeshReorderingMethod::morton
+                                          ? computeMortonOrder( cellToNodes, nodeManager, numCells )
+                                          : computeReverseCuthillMcKeeOrder( cellToNodes, numNodes, numCells );
+  GEOSX_ERROR_IF_NE( LvArray::integerConversion< localIndex >( order.size() ), numCells );
+
+  // Sort the cells of each block by their position in the order, and number the nodes by first use.
+  std::vector< array1d< localIndex > > newToOldCells( cellBlocks.size() );
+  array1d< localIndex > oldToNewNodes( numNodes );
+  oldToNewNodes.setValues< serialPolicy >( -1 );
+  localIndex numOrderedNodes = 0;
+  for( localIndex const cellIndex : order )
+  {
+    std::size_t const b = std::upper_bound( blockOffsets.begin(), blockOffsets.end(), cellIndex ) - blockOffsets.begin() - 1;
+    localIndex const k = cellIndex - blockOffsets[b];
+    newToOldCells[b].emplace_back( k );
+    for( localIndex a = 0; a < cellToNodes[b].size( 1 ); ++a )
+    {
+      localIndex & newNode = oldToNewNodes[ cellToNodes[b]( k, a ) ];
+      if( newNode < 0 )
+      {
+        newNode = numOrderedNodes++;
+      }
+    }
+  }
+
+  // The nodes without any cell keep their relative order after the others.
+  array1d< localIndex > newToOldNodes( numNodes );
+  for( localIndex a = 0; a < numNodes; ++a )
+  {
+    if( oldToNewNodes[a] < 0 )
+    {
+      oldToNewNodes[a] = numOrderedNodes++;
+    }
+    newToOldNodes[ oldToNewNodes[a] ] = a;
+  }
+
+  // Permute the nodes.
+  arrayView2d< real64, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+  permuteRows( X, newToOldNodes.toViewConst() );
+  arrayView1d< globalIndex > const nodeLocalToGlobal = nodeManager.localToGlobalMap();
+  permuteValues( nodeLocalToGlobal, newToOldNodes.toViewConst() );
+  nodeManager.ConstructGlobalToLocalMap();
+
+  nodeManager.sets().forWrappers< SortedArray< localIndex > >( [&]( auto & wrapper )
+  {
+    SortedArray< localIndex > & set = wrapper.reference();
+    array1d< localIndex > newNodes;
+    newNodes.reserve( set.size() );
+    for( localIndex const a : set )
+    {
+      newNodes.emplace_back( oldToNewNodes[a] );
+    }
+    set.clear();
+    for( localIndex const a : newNodes )
+    {
+      set.insert( a );
+    }
+  } );
+
+  // Permute the cells and renumber their nodes.
+  for( std::size_t b = 0; b < cellBlocks.size(); ++b )
+  {
+    CellBlock & cellBlock = *cellBlocks[b];
+    arrayView1d< localIndex const > const newToOld = newToOldCells[b].toViewConst();
+
+    arrayView2d< localIndex, cells::NODE_MAP_USD > const blockCellToNodes = cellBlock.nodeList().toView();
+    permuteRows( blockCellToNodes, newToOld );
+    for( localIndex k = 0; k < blockCellToNodes.size( 0 ); ++k )
+    {
+      for( localIndex a = 0; a < blockCellToNodes.size( 1 ); ++a )
+      {
+        blockCellToNodes( k, a ) = oldToNewNodes[ blockCellToNodes( k, a ) ];
+      }
+    }
+
+    arrayView1d< globalIndex > const cellLocalToGlobal = cellBlock.localToGlobalMap();
+    permuteValues( cellLocalToGlobal, newToOld );
+
+    cellBlock.forExternalProperties( [&]( WrapperBase * const wrapper )
+    {
+      if( wrapper->get_typeid() == typeid( array1d< R1Tensor > ) )
+      {
+        permuteValues( cellBlock.getReference< array1d< R1Tensor > >( wrapper->getName() ).toView(), newToOld );
+      }
+      else
+      {
+        GEOSX_ERROR_IF( wrapper->get_typeid() != typeid( array1d< real64 > ),
+                        "The external property " << wrapper->getName() << " cannot be reordered." );
+        permuteValues( cellBlock.getReference< array1d< real64 > >( wrapper->getName() ).toView(), newToOld );
+      }
+    } );
+  }
+}
+
+} /* namespace geosx */
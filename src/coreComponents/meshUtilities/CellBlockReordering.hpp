@@ -0,0 +1,66 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CellBlockReordering.hpp
+ */
+
+#ifndef GEOSX_MESHUTILITIES_CELLBLOCKREORDERING_HPP_
+#define GEOSX_MESHUTILITIES_CELLBLOCKREORDERING_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/EnumStrings.hpp"
+
+namespace geosx
+{
+
+class CellBlockManager;
+class NodeManager;
+
+/**
+ * @brief The methods used to reorder the local cells and nodes of a generated mesh.
+ */
+enum class MeshReorderingMethod : integer
+{
+  none,               ///< keep the order of the mesh generator
+  morton,             ///< sort the cells along the Morton (Z-order) curve of their centers
+  reverseCuthillMcKee ///< reverse Cuthill-McKee ordering of the graph of the cells sharing a node
+};
+
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( MeshReorderingMethod,
+              "none",
+              "morton",
+              "reverseCuthillMcKee" )
+
+/**
+ * @brief Reorder the local cells of the cell blocks and the local nodes to improve memory locality.
+ * @param method the reordering method
+ * @param cellBlockManager the cell blocks holding the cells of this rank
+ * @param nodeManager the node manager holding the nodes of the cells of this rank
+ *
+ * One ordering is computed for all the cells of the rank, the cells of each cell block being
+ * sorted accordingly, and the nodes are then numbered in the order in which the reordered cells
+ * first reference them. The global indices are not modified, only the local numbering is.
+ * This must be called at the end of the mesh generation, before the faces and edges are built:
+ * only the node coordinates, the node sets, the cell-to-node maps and the external properties of
+ * the cell blocks are permuted, the faces and edges then inheriting the ordering when they are built.
+ */
+void reorderCellBlocks( MeshReorderingMethod const method,
+                        CellBlockManager & cellBlockManager,
+                        NodeManager & nodeManager );
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MESHUTILITIES_CELLBLOCKREORDERING_HPP_ */
@@ -44,7 +44,8 @@ InternalMeshGenerator::InternalMeshGenerator( string const & name, Group * const
 // }),
   m_dim( 0 ),
   m_min(),
-  m_max()
+  m_max(),
+  m_reorderingMethod( MeshReorderingMethod::none )
 {
 
   /*
@@ -123,6 +124,12 @@ InternalMeshGenerator::InternalMeshGenerator( string const & name, Group * const
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "pattern by which to decompose the hex mesh into prisms (more explanation required)" );
 
+  registerWrapper( keys::reorderingMethod, &m_reorderingMethod )->
+    setApplyDefaultValue( m_reorderingMethod )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Method used to reorder the local cells and nodes to improve memory locality. Valid options:\n* " +
+                    EnumStrings< MeshReorderingMethod >::concat( "\n* " ) );
+
 }
 
 InternalMeshGenerator::~InternalMeshGenerator()
@@ -927,6 +934,8 @@ void InternalMeshGenerator::GenerateMesh( DomainPartition * const domain )
   {
     RemapMesh( domain );
   }
+
+  reorderCellBlocks( m_reorderingMethod, *elementManager, *nodeManager );
 }
 
 /**
@@ -25,6 +25,7 @@
 #include "dataRepository/Group.hpp"
 #include "codingUtilities/Utilities.hpp"
 #include "MeshGeneratorBase.hpp"
+#include "CellBlockReordering.hpp"
 
 namespace geosx
 {
@@ -62,6 +63,8 @@ string const cellBlockNames = "cellBlockNames";
 string const elementTypes = "elementTypes";
 /// key for triangle pattern identifier
 string const trianglePattern = "trianglePattern";
+/// key for the reordering method of the cells and nodes
+string const reorderingMethod = "reorderingMethod";
 }
 ///@}
 
@@ -184,6 +187,9 @@ private:
    */
   int m_trianglePattern;
 
+  /// Method used to reorder the local cells and nodes after the generation
+  MeshReorderingMethod m_reorderingMethod;
+
   /// Node perturbation amplitude value
   realT m_fPerturb=0.0;
   /// Random seed for generation of the node perturbation field
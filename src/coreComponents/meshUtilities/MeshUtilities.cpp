@@ -22,7 +22,7 @@
 #include "dataRepository/xmlWrapper.hpp"
 #include "SimpleGeometricObjects/SimpleGeometricObjectBase.hpp"
 #include "common/TimingMacros.hpp"
-#include "mesh/NodeManager.hpp"
+#include "mesh/MeshLevel.hpp"
 
 namespace geosx
 {
@@ -42,10 +42,13 @@ MeshUtilities::~MeshUtilities()
 
 
 void MeshUtilities::GenerateNodesets( dataRepository::Group const * geometries,
-                                      NodeManager * const nodeManager )
+                                      MeshLevel & mesh )
 {
+  GEOSX_MARK_FUNCTION;
+
+  NodeManager * const nodeManager = mesh.getNodeManager();
   arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager->referencePosition();
-  localIndex const numNodes = nodeManager->size();
+  MeshSpatialIndex const & spatialIndex = mesh.getSpatialIndex();
   Group & sets = nodeManager->sets();
 
   for( int i = 0; i < geometries->GetSubGroups().size(); ++i )
@@ -55,13 +58,20 @@ void MeshUtilities::GenerateNodesets( dataRepository::Group const * geometries,
     {
       string name = object->getName();
       SortedArray< localIndex > & targetSet = sets.registerWrapper< SortedArray< localIndex > >( name )->reference();
-      for( localIndex a=0; a<numNodes; ++a )
+
+      R1Tensor boxMin, boxMax;
+      object->GetBoundingBox( boxMin, boxMax );
+
+      array1d< localIndex > nodes;
+      spatialIndex.forNodesInBox( boxMin, boxMax, [&]( localIndex const a )
       {
         if( object->IsCoordInObject( X[a] ))
         {
-          targetSet.insert( a );
+          nodes.emplace_back( a );
         }
-      }
+      } );
+      std::sort( nodes.begin(), nodes.end() );
+      targetSet.insert( nodes.begin(), nodes.end() );
     }
 
   }
@@ -31,7 +31,7 @@ class Group;
 
 class ObjectManagerBase;
 class xmlWrapper;
-class NodeManager;
+class MeshLevel;
 
 
 /**
@@ -63,10 +63,13 @@ public:
   /**
    * @brief Build all the node sets from a geometric object in the DomainPartition.
    * @param[in] geometry a pointer to the group in the data repository
-   * @param[in] nodeManager pointer to the NodeManager object in the DomainPartition
+   * @param[inout] mesh the mesh level whose node manager receives the node sets
+   *
+   * Only the nodes found by the spatial index of @p mesh in the bounding box of
+   * each geometric object are tested.
    */
   static void GenerateNodesets( dataRepository::Group const * geometry,
-                                NodeManager * const nodeManager );
+                                MeshLevel & mesh );
 
 //  static void GenerateFasesetsAndAssociatedNodesets( xmlWrapper const & hdn,
 //                                                     Group&
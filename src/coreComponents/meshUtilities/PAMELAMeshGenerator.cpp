@@ -20,6 +20,7 @@
 
 #include "managers/DomainPartition.hpp"
 
+#include <algorithm>
 #include <math.h>
 
 #include "mpiCommunications/PartitionBase.hpp"
@@ -29,6 +30,7 @@
 #include "MeshDataWriters/MeshParts.hpp"
 
 #include "mesh/MeshBody.hpp"
+#include "meshUtilities/CellBlockRedistribution.hpp"
 
 namespace geosx
 {
@@ -38,7 +40,9 @@ using namespace dataRepository;
 string const PAMELAMeshGenerator::DecodePAMELALabels::m_separator = "_";
 
 PAMELAMeshGenerator::PAMELAMeshGenerator( string const & name, Group * const parent ):
-  MeshGeneratorBase( name, parent )
+  MeshGeneratorBase( name, parent ),
+  m_partitionMethod( PartitionMethod::pamela ),
+  m_reorderingMethod( MeshReorderingMethod::none )
 {
 
   registerWrapper( viewKeyStruct::filePathString, &m_filePath )->
@@ -57,6 +61,20 @@ PAMELAMeshGenerator::PAMELAMeshGenerator( string const & name, Group * const par
   registerWrapper( viewKeyStruct::reverseZString, &m_isZReverse )->
     setInputFlag( InputFlags::OPTIONAL )->
     setDefaultValue( 0 )->setDescription( "0 : Z coordinate is upward, 1 : Z coordinate is downward" );
+  registerWrapper( viewKeyStruct::partitionMethodString, &m_partitionMethod )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( m_partitionMethod )->
+    setDescription( "Method used to partition the mesh. Valid options:\n* " + EnumStrings< PartitionMethod >::concat( "\n* " ) );
+  registerWrapper( viewKeyStruct::partitionWeightFieldString, &m_partitionWeightField )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Name in GEOSX of an imported cell field holding the weights of the cells in the parmetis partitioning, "
+                    "e.g. to account for the cost of the cells near wells or fractures. "
+                    "The weights are rounded to the nearest positive integer. By default all the cells have the same weight." );
+  registerWrapper( viewKeyStruct::reorderingMethodString, &m_reorderingMethod )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( m_reorderingMethod )->
+    setDescription( "Method used to reorder the local cells and nodes to improve memory locality. Valid options:\n* " +
+                    EnumStrings< MeshReorderingMethod >::concat( "\n* " ) );
 }
 
 PAMELAMeshGenerator::~PAMELAMeshGenerator()
@@ -67,6 +85,12 @@ void PAMELAMeshGenerator::GenerateElementRegions( DomainPartition & GEOSX_UNUSED
 
 void PAMELAMeshGenerator::PostProcessInput()
 {
+  GEOSX_ERROR_IF( !m_partitionWeightField.empty() && m_partitionMethod != PartitionMethod::parmetis,
+                  getName() << ": " << viewKeyStruct::partitionWeightFieldString << " requires the parmetis partitioning" );
+  GEOSX_ERROR_IF( !m_partitionWeightField.empty() &&
+                  std::find( m_fieldNamesInGEOSX.begin(), m_fieldNamesInGEOSX.end(), m_partitionWeightField ) == m_fieldNamesInGEOSX.end(),
+                  getName() << ": the partition weight field " << m_partitionWeightField << " is not imported" );
+
   m_pamelaMesh =
     std::unique_ptr< PAMELA::Mesh >
       ( PAMELA::MeshFactory::makeMesh( m_filePath ) );
@@ -391,6 +415,14 @@ void PAMELAMeshGenerator::GenerateMesh( DomainPartition * const domain )
     }
   }
 
+  if( m_partitionMethod == PartitionMethod::parmetis )
+  {
+    GEOSX_LOG_RANK_0( "Partitioning the cell graph with ParMETIS" );
+    array1d< int > const targetRanks = partitionCellGraph( *cellBlockManager, *nodeManager, m_partitionWeightField );
+    redistributeCellBlocks( targetRanks.toViewConst(), *cellBlockManager, *nodeManager, domain->getMetisNeighborList() );
+  }
+
+  reorderCellBlocks( m_reorderingMethod, *cellBlockManager, *nodeManager );
 }
 
 void PAMELAMeshGenerator::GetElemToNodesRelationInBox( const std::string & GEOSX_UNUSED_PARAM( elementType ),
@@ -19,6 +19,7 @@
 #ifndef GEOSX_MESHUTILITIES_PAMELAMESHGENERATOR_HPP
 #define GEOSX_MESHUTILITIES_PAMELAMESHGENERATOR_HPP
 
+#include "common/EnumStrings.hpp"
 #include "dataRepository/Group.hpp"
 #include "codingUtilities/Utilities.hpp"
 #include "codingUtilities/StringUtilities.hpp"
@@ -28,6 +29,7 @@
 #include "MeshDataWriters/Writer.hpp"
 
 #include "MeshGeneratorBase.hpp"
+#include "CellBlockReordering.hpp"
 
 namespace geosx
 {
@@ -56,6 +58,15 @@ public:
  */
   static string CatalogName() { return "PAMELAMeshGenerator"; }
 
+  /**
+   * @brief The methods used to partition the mesh.
+   */
+  enum class PartitionMethod : integer
+  {
+    pamela,  ///< the partitioning of PAMELA, balancing the number of cells
+    parmetis ///< a partitioning of the cell graph with ParMETIS, balancing the weights of the cells
+  };
+
 ///@cond DO_NOT_DOCUMENT
   struct viewKeyStruct
   {
@@ -64,6 +75,9 @@ public:
     constexpr static auto fieldsToImportString = "fieldsToImport";
     constexpr static auto fieldNamesInGEOSXString = "fieldNamesInGEOSX";
     constexpr static auto reverseZString = "reverseZ";
+    constexpr static auto partitionMethodString = "partitionMethod";
+    constexpr static auto partitionWeightFieldString = "partitionWeightField";
+    constexpr static auto reorderingMethodString = "reorderingMethod";
   };
 /// @endcond
 
@@ -116,6 +130,15 @@ private:
   /// z pointing direction flag, 0 (default) is upward, 1 is downward
   int m_isZReverse;
 
+  /// The method used to partition the mesh
+  PartitionMethod m_partitionMethod;
+
+  /// Name of the imported field holding the weights of the cells in the partitioning
+  string m_partitionWeightField;
+
+  /// The method used to reorder the local cells and nodes after the partitioning
+  MeshReorderingMethod m_reorderingMethod;
+
   /// Map from PAMELA enumeration element type to string
   const std::unordered_map< PAMELA::ELEMENTS::TYPE, string, PAMELA::ELEMENTS::EnumClassHash > ElementToLabel
     =
@@ -164,6 +187,11 @@ private:
   };
 };
 
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( PAMELAMeshGenerator::PartitionMethod,
+              "pamela",
+              "parmetis" )
+
 }
 
 #endif /* GEOSX_MESHUTILITIES_PAMELAMESHGENERATOR_HPP */
@@ -20,7 +20,6 @@
 
 #include "mpiCommunications/MpiWrapper.hpp"
 #include "managers/DomainPartition.hpp"
-#include "mesh/MeshForLoopInterface.hpp"
 #include "meshUtilities/Perforation.hpp"
 #include "meshUtilities/ComputationalGeometry.hpp"
 
@@ -203,13 +202,6 @@ void PerforationData::DecideWellDirection( R1Tensor const & vecWellElemCenterToP
 void PerforationData::ConnectToMeshElements( MeshLevel const & mesh,
                                              InternalWellGenerator const & wellGeometry )
 {
-  ElementRegionManager const * const elemManager = mesh.getElemManager();
-  NodeManager const * const nodeManager = mesh.getNodeManager();
-  ElementRegionManager::ElementViewAccessor< arrayView1d< R1Tensor const > >
-  elemCenter = elemManager->ConstructViewAccessor< array1d< R1Tensor >, arrayView1d< R1Tensor const > >( ElementSubRegionBase::
-                                                                                                           viewKeyStruct::
-                                                                                                           elementCenterString );
-
   arrayView1d< R1Tensor const > const & perfCoordsGlobal = wellGeometry.GetPerfCoords();
   arrayView1d< real64 const >   const & perfTransGlobal  = wellGeometry.GetPerfTransmissibility();
 
@@ -221,37 +213,11 @@ void PerforationData::ConnectToMeshElements( MeshLevel const & mesh,
   {
     R1Tensor const & coords = perfCoordsGlobal[iperfGlobal];
 
-    // TODO actually trace coords
     // TODO what if a fracture element is located
 
-    // find the closest reservoir element
-    auto ret = minLocOverElemsInMesh( &mesh, [&] ( localIndex const er,
-                                                   localIndex const esr,
-                                                   localIndex const ei ) -> real64
-    {
-      R1Tensor v = coords;
-      v -= elemCenter[er][esr][ei];
-      return v.L2_Norm();
-    } );
-
-    // save the region, subregion and index
-    localIndex const er  = std::get< 0 >( ret.second );
-    localIndex const esr = std::get< 1 >( ret.second );
-    localIndex const ei  = std::get< 2 >( ret.second );
-
-    // a ghostRank check may be inserted if needed
-    // (not needed in the current implementation)
-
-    // check if perforation location is indeed inside the element
-    CellBlock const * const cellBlock = elemManager->GetRegion( er )->GetSubRegion< CellElementSubRegion >( esr );
-    array1d< array1d< localIndex > > faceNodes( cellBlock->numFacesPerElement() );
-
-    for( localIndex kf = 0; kf < cellBlock->numFacesPerElement(); ++kf )
-    {
-      cellBlock->GetFaceNodes( ei, kf, faceNodes[kf] );
-    }
-
-    if( !computationalGeometry::IsPointInsidePolyhedron( nodeManager->referencePosition(), faceNodes, coords ))
+    // find the reservoir element containing the perforation, if any
+    localIndex er, esr, ei;
+    if( !mesh.getSpatialIndex().findCellContaining( coords, er, esr, ei ) )
     {
       continue;
     }
@@ -136,6 +136,28 @@ bool BoundedPlane::IsCoordInObject( const R1Tensor & coord ) const
   return isInside;
 }
 
+void BoundedPlane::GetBoundingBox( R1Tensor & boxMin, R1Tensor & boxMax ) const
+{
+  boxMin = m_points[0];
+  boxMax = m_points[0];
+  for( int i = 1; i < 4; ++i )
+  {
+    for( int d = 0; d < 3; ++d )
+    {
+      boxMin[d] = std::min( boxMin[d], m_points[i][d] );
+      boxMax[d] = std::max( boxMax[d], m_points[i][d] );
+    }
+  }
+
+  // Margin for the tolerance of IsCoordInObject and rounding errors
+  real64 const margin = 1e-12 * ( m_dimensions[0] + m_dimensions[1] ) + 1e-15;
+  for( int d = 0; d < 3; ++d )
+  {
+    boxMin[d] -= margin;
+    boxMax[d] += margin;
+  }
+}
+
 REGISTER_CATALOG_ENTRY( SimpleGeometricObjectBase, BoundedPlane, std::string const &, Group * const )
 
 } /* namespace geosx */
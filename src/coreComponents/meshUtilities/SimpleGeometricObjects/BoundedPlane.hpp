@@ -67,6 +67,8 @@ public:
 
   bool IsCoordInObject( const R1Tensor & coord ) const override final;
 
+  void GetBoundingBox( R1Tensor & boxMin, R1Tensor & boxMax ) const override final;
+
   /**
    * @brief Find the bounds of the plane.
    */
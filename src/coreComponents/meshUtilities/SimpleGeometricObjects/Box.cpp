@@ -137,6 +137,31 @@ bool Box::IsCoordInObject( const R1Tensor & coord ) const
   return rval;
 }
 
+void Box::GetBoundingBox( R1Tensor & boxMin, R1Tensor & boxMax ) const
+{
+  if( std::fabs( m_strikeAngle ) < 1e-20 )
+  {
+    boxMin = m_min;
+    boxMax = m_max;
+  }
+  else
+  {
+    // Extent of the box rotated around its center, with a margin for rounding errors
+    real64 const halfLength = 0.5 * ( m_max[0] - m_min[0] );
+    real64 const halfWidth = 0.5 * ( m_max[1] - m_min[1] );
+    real64 const margin = 1e-12 * ( halfLength + halfWidth );
+    R1Tensor halfExtent;
+    halfExtent[0] = std::fabs( m_cosStrike ) * halfLength + std::fabs( m_sinStrike ) * halfWidth + margin;
+    halfExtent[1] = std::fabs( m_sinStrike ) * halfLength + std::fabs( m_cosStrike ) * halfWidth + margin;
+    halfExtent[2] = 0.5 * ( m_max[2] - m_min[2] );
+
+    boxMin = m_boxCenter;
+    boxMin -= halfExtent;
+    boxMax = m_boxCenter;
+    boxMax += halfExtent;
+  }
+}
+
 REGISTER_CATALOG_ENTRY( SimpleGeometricObjectBase, Box, std::string const &, Group * const )
 
 } /* namespace geosx */
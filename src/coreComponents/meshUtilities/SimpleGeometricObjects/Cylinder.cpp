@@ -78,6 +78,17 @@ bool Cylinder::IsCoordInObject( const R1Tensor & coord ) const
   return rval;
 }
 
+void Cylinder::GetBoundingBox( R1Tensor & boxMin, R1Tensor & boxMax ) const
+{
+  // IsCoordInObject accepts the coordinates projecting on both sides of m_point1
+  for( int d = 0; d < 3; ++d )
+  {
+    real64 const mirror = 2.0 * m_point1[d] - m_point2[d];
+    boxMin[d] = std::min( mirror, m_point2[d] ) - m_radius;
+    boxMax[d] = std::max( mirror, m_point2[d] ) + m_radius;
+  }
+}
+
 REGISTER_CATALOG_ENTRY( SimpleGeometricObjectBase, Cylinder, std::string const &, Group * const )
 
 } /* namespace geosx */
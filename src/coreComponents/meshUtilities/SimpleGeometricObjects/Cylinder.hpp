@@ -68,6 +68,8 @@ public:
 
   bool IsCoordInObject( const R1Tensor & coord ) const override final;
 
+  void GetBoundingBox( R1Tensor & boxMin, R1Tensor & boxMax ) const override final;
+
 
 private:
 
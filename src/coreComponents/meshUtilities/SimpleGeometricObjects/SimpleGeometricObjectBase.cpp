@@ -32,6 +32,15 @@ SimpleGeometricObjectBase::SimpleGeometricObjectBase( std::string const & name,
 SimpleGeometricObjectBase::~SimpleGeometricObjectBase()
 {}
 
+void SimpleGeometricObjectBase::GetBoundingBox( R1Tensor & boxMin, R1Tensor & boxMax ) const
+{
+  for( int d = 0; d < 3; ++d )
+  {
+    boxMin[d] = std::numeric_limits< real64 >::lowest();
+    boxMax[d] = std::numeric_limits< real64 >::max();
+  }
+}
+
 
 SimpleGeometricObjectBase::CatalogInterface::CatalogType & SimpleGeometricObjectBase::GetCatalog()
 {
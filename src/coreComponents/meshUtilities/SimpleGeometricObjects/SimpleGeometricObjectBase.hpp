@@ -94,6 +94,16 @@ public:
    */
   virtual bool IsCoordInObject( const R1Tensor & coord ) const = 0;
 
+  /**
+   * @brief Get an axis-aligned box containing all the coordinates in the object.
+   * @param[out] boxMin the lower corner of the box
+   * @param[out] boxMax the upper corner of the box
+   *
+   * The box is used to restrict the coordinates tested with IsCoordInObject(). The default
+   * implementation returns an unbounded box.
+   */
+  virtual void GetBoundingBox( R1Tensor & boxMin, R1Tensor & boxMax ) const;
+
 };
 
 
@@ -0,0 +1,258 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "mesh/CellBlockManager.hpp"
+#include "mesh/NodeManager.hpp"
+#include "meshUtilities/CellBlockRedistribution.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+#include <set>
+#include <vector>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+
+namespace
+{
+
+/// The number of cells of the strip of hexahedra along x.
+globalIndex constexpr numGlobalCells = 4;
+
+/// The number of nodes of each x layer of the strip.
+globalIndex constexpr numNodesPerLayer = 4;
+
+/// The number of cells of each rank before the redistribution.
+localIndex constexpr numCellsPerRank = 2;
+
+/**
+ * @brief Get the global index of a node of a cell of the strip.
+ * @param cellGlobalIndex the global index of the cell
+ * @param a the index of the node in the cell, x varying fastest
+ * @return the global index of the node
+ */
+globalIndex cellNode( globalIndex const cellGlobalIndex, localIndex const a )
+{
+  return numNodesPerLayer * ( cellGlobalIndex + a % 2 ) + a / 2;
+}
+
+/**
+ * @brief Get a coordinate of a node of the strip.
+ * @param nodeGlobalIndex the global index of the node
+ * @param i the direction
+ * @return the coordinate
+ */
+real64 nodeCoordinate( globalIndex const nodeGlobalIndex, int const i )
+{
+  globalIndex const indices[3] = { nodeGlobalIndex / numNodesPerLayer, nodeGlobalIndex % 2, ( nodeGlobalIndex % numNodesPerLayer ) / 2 };
+  return static_cast< real64 >( indices[i] );
+}
+
+/// The value of the external property of a cell.
+real64 cellProperty( globalIndex const cellGlobalIndex )
+{
+  return 10.0 * cellGlobalIndex;
+}
+
+/**
+ * @brief A strip of hexahedra along x, each rank holding two consecutive cells and their nodes.
+ *
+ * The node set "xneg" holds the nodes at x = 0 and the node set "all" holds all the nodes.
+ */
+class CellBlockRedistributionTest : public ::testing::Test
+{
+protected:
+
+  CellBlockRedistributionTest():
+    cellBlockManager( "cellManager", nullptr ),
+    nodeManager( "nodeManager", nullptr )
+  {}
+
+  void SetUp() override
+  {
+    ASSERT_EQ( MpiWrapper::Comm_size( MPI_COMM_GEOSX ), 2 );
+    rank = MpiWrapper::Comm_rank( MPI_COMM_GEOSX );
+
+    globalIndex const firstCell = rank * numCellsPerRank;
+    globalIndex const firstNode = firstCell * numNodesPerLayer;
+
+    localIndex const numNodes = ( numCellsPerRank + 1 ) * numNodesPerLayer;
+    nodeManager.resize( numNodes );
+    arrayView1d< globalIndex > const nodeLocalToGlobal = nodeManager.localToGlobalMap();
+    arrayView2d< real64, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+    nodeManager.CreateSet( "xneg" );
+    nodeManager.CreateSet( "all" );
+    SortedArray< localIndex > & xneg = nodeManager.sets().getReference< SortedArray< localIndex > >( "xneg" );
+    SortedArray< localIndex > & all = nodeManager.sets().getReference< SortedArray< localIndex > >( "all" );
+    for( localIndex a = 0; a < numNodes; ++a )
+    {
+      globalIndex const nodeGlobalIndex = firstNode + a;
+      nodeLocalToGlobal[a] = nodeGlobalIndex;
+      for( int i = 0; i < 3; ++i )
+      {
+        X( a, i ) = nodeCoordinate( nodeGlobalIndex, i );
+      }
+      if( nodeGlobalIndex < numNodesPerLayer )
+      {
+        xneg.insert( a );
+      }
+      all.insert( a );
+    }
+    nodeManager.ConstructGlobalToLocalMap();
+
+    CellBlock & cellBlock = *cellBlockManager.GetGroup( keys::cellBlocks )->RegisterGroup< CellBlock >( "cb1" );
+    cellBlock.SetElementType( "C3D8" );
+    cellBlock.resize( numCellsPerRank );
+    cellBlock.nodeList().resize( numCellsPerRank, cellBlock.numNodesPerElement() );
+    array1d< real64 > & property = cellBlock.AddProperty< array1d< real64 > >( "cellProperty" );
+    property.resize( numCellsPerRank );
+
+    arrayView1d< globalIndex > const cellLocalToGlobal = cellBlock.localToGlobalMap();
+    arrayView2d< localIndex, cells::NODE_MAP_USD > const cellToNodes = cellBlock.nodeList().toView();
+    for( localIndex k = 0; k < numCellsPerRank; ++k )
+    {
+      cellLocalToGlobal[k] = firstCell + k;
+      property[k] = cellProperty( firstCell + k );
+      for( localIndex a = 0; a < cellToNodes.size( 1 ); ++a )
+      {
+        cellToNodes( k, a ) = nodeManager.globalToLocalMap( cellNode( firstCell + k, a ) );
+      }
+    }
+  }
+
+  /**
+   * @brief Check the cells, nodes, node sets and neighbors of this rank after the redistribution.
+   * @param expectedCells the global indices of the cells of this rank, in the order of their source rank
+   * @param expectedNeighbors the ranks expected to share nodes with this rank
+   * @param neighborRanks the neighbor ranks computed by the redistribution
+   */
+  void checkRedistribution( std::vector< globalIndex > const & expectedCells,
+                            std::set< int > const & expectedNeighbors,
+                            std::set< int > const & neighborRanks )
+  {
+    // The cells received by this rank, with the external property moved along.
+    CellBlock const & cellBlock = *cellBlockManager.GetRegion( "cb1" );
+    ASSERT_EQ( cellBlock.size(), LvArray::integerConversion< localIndex >( expectedCells.size() ) );
+    arrayView1d< globalIndex const > const cellLocalToGlobal = cellBlock.localToGlobalMap();
+    arrayView1d< real64 const > const property = cellBlock.getReference< array1d< real64 > >( "cellProperty" );
+    for( localIndex k = 0; k < cellBlock.size(); ++k )
+    {
+      EXPECT_EQ( cellLocalToGlobal[k], expectedCells[k] );
+      EXPECT_DOUBLE_EQ( property[k], cellProperty( expectedCells[k] ) );
+    }
+
+    // The nodes are the nodes of the cells, numbered by global index.
+    std::set< globalIndex > expectedNodes;
+    for( globalIndex const cellGlobalIndex : expectedCells )
+    {
+      for( localIndex a = 0; a < cellBlock.numNodesPerElement(); ++a )
+      {
+        expectedNodes.insert( cellNode( cellGlobalIndex, a ) );
+      }
+    }
+    ASSERT_EQ( nodeManager.size(), LvArray::integerConversion< localIndex >( expectedNodes.size() ) );
+    arrayView1d< globalIndex const > const nodeLocalToGlobal = nodeManager.localToGlobalMap();
+    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+    localIndex a = 0;
+    for( globalIndex const nodeGlobalIndex : expectedNodes )
+    {
+      EXPECT_EQ( nodeLocalToGlobal[a], nodeGlobalIndex );
+      for( int i = 0; i < 3; ++i )
+      {
+        EXPECT_DOUBLE_EQ( X( a, i ), nodeCoordinate( nodeGlobalIndex, i ) );
+      }
+      ++a;
+    }
+
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const cellToNodes = cellBlock.nodeList().toViewConst();
+    for( localIndex k = 0; k < cellBlock.size(); ++k )
+    {
+      for( localIndex b = 0; b < cellToNodes.size( 1 ); ++b )
+      {
+        EXPECT_EQ( nodeLocalToGlobal[ cellToNodes( k, b ) ], cellNode( expectedCells[k], b ) );
+      }
+    }
+
+    // The node sets are rebuilt in the new local numbering.
+    SortedArrayView< localIndex const > const xneg = nodeManager.sets().getReference< SortedArray< localIndex > >( "xneg" ).toViewConst();
+    SortedArrayView< localIndex const > const all = nodeManager.sets().getReference< SortedArray< localIndex > >( "all" ).toViewConst();
+    EXPECT_EQ( all.size(), nodeManager.size() );
+    localIndex numExpectedXneg = 0;
+    for( localIndex b = 0; b < nodeManager.size(); ++b )
+    {
+      bool const isXneg = nodeLocalToGlobal[b] < numNodesPerLayer;
+      numExpectedXneg += isXneg ? 1 : 0;
+      EXPECT_EQ( xneg.contains( b ), isXneg ) << nodeLocalToGlobal[b];
+      EXPECT_TRUE( all.contains( b ) ) << nodeLocalToGlobal[b];
+    }
+    EXPECT_EQ( xneg.size(), numExpectedXneg );
+
+    EXPECT_EQ( neighborRanks, expectedNeighbors );
+  }
+
+  CellBlockManager cellBlockManager;
+  NodeManager nodeManager;
+  int rank = 0;
+};
+
+TEST_F( CellBlockRedistributionTest, interleaved )
+{
+  // The first cell of each rank goes to rank 0 and the second to rank 1.
+  array1d< int > targetRanks( numCellsPerRank );
+  targetRanks[0] = 0;
+  targetRanks[1] = 1;
+
+  std::set< int > neighborRanks;
+  redistributeCellBlocks( targetRanks.toViewConst(), cellBlockManager, nodeManager, neighborRanks );
+
+  // Rank 0 holds the cells 0 and 2, rank 1 the cells 1 and 3: they share the nodes of the x = 1, 2 and 3 layers.
+  std::vector< globalIndex > const expectedCells = rank == 0 ? std::vector< globalIndex >{ 0, 2 }
+                                                             : std::vector< globalIndex >{ 1, 3 };
+  checkRedistribution( expectedCells, { 1 - rank }, neighborRanks );
+}
+
+TEST_F( CellBlockRedistributionTest, allOnRankZero )
+{
+  // All the cells go to rank 0.
+  array1d< int > const targetRanks( numCellsPerRank );
+
+  std::set< int > neighborRanks;
+  redistributeCellBlocks( targetRanks.toViewConst(), cellBlockManager, nodeManager, neighborRanks );
+
+  // Rank 1 keeps an empty cell block and no nodes, so that no rank has a neighbor.
+  std::vector< globalIndex > expectedCells;
+  if( rank == 0 )
+  {
+    for( globalIndex k = 0; k < numGlobalCells; ++k )
+    {
+      expectedCells.push_back( k );
+    }
+  }
+  checkRedistribution( expectedCells, {}, neighborRanks );
+}
+
+} // namespace
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,219 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "managers/DomainPartition.hpp"
+#include "dataRepository/xmlWrapper.hpp"
+#include "mesh/CellBlockManager.hpp"
+#include "mesh/NodeManager.hpp"
+#include "meshUtilities/MeshManager.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+
+namespace
+{
+
+/**
+ * @brief Generate a mesh that is thin along x.
+ * @param reorderingMethod the reordering method of the generator
+ * @return the domain holding the mesh
+ *
+ * The generator numbers the nodes with x varying slowest, so that the nodes of every cell
+ * of this mesh are about a whole y-z layer apart without reordering.
+ */
+std::unique_ptr< DomainPartition > GenerateInternalMesh( string const & reorderingMethod )
+{
+  MeshManager meshManager( "mesh", nullptr );
+
+  string const inputStringMesh =
+    "<Mesh>"
+    "  <InternalMesh name=\"mesh1\""
+    "                elementTypes=\"{C3D8, C3D8}\""
+    "                xCoords=\"{0, 1, 2}\""
+    "                yCoords=\"{0, 1}\""
+    "                zCoords=\"{0, 1}\""
+    "                nx=\"{1, 2}\""
+    "                ny=\"{10}\""
+    "                nz=\"{10}\""
+    "                cellBlockNames=\"{cb1, cb2}\""
+    "                reorderingMethod=\"" + reorderingMethod + "\"/>"
+    "</Mesh>";
+
+  xmlWrapper::xmlDocument xmlDocument;
+  xmlDocument.load_buffer( inputStringMesh.c_str(), inputStringMesh.size() );
+
+  xmlWrapper::xmlNode xmlMeshNode = xmlDocument.child( "Mesh" );
+  meshManager.ProcessInputFileRecursive( xmlMeshNode );
+  meshManager.PostProcessInputRecursive();
+
+  std::unique_ptr< DomainPartition > domain( new DomainPartition( "domain", nullptr ) );
+  meshManager.GenerateMeshes( domain.get() );
+  return domain;
+}
+
+void CompareMeshes( DomainPartition & reference, DomainPartition & reordered )
+{
+  NodeManager const & refNodeManager = *reference.getMeshBody( 0 )->getMeshLevel( 0 )->getNodeManager();
+  NodeManager const & newNodeManager = *reordered.getMeshBody( 0 )->getMeshLevel( 0 )->getNodeManager();
+  ASSERT_EQ( refNodeManager.size(), newNodeManager.size() );
+
+  arrayView1d< globalIndex const > const refNodeLocalToGlobal = refNodeManager.localToGlobalMap();
+  arrayView1d< globalIndex const > const newNodeLocalToGlobal = newNodeManager.localToGlobalMap();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const refX = refNodeManager.referencePosition();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const newX = newNodeManager.referencePosition();
+
+  // Nodes with the same global index are at the same position
+  for( localIndex a = 0; a < newNodeManager.size(); ++a )
+  {
+    localIndex const refNode = refNodeManager.globalToLocalMap( newNodeLocalToGlobal[a] );
+    for( int i = 0; i < 3; ++i )
+    {
+      EXPECT_DOUBLE_EQ( newX( a, i ), refX( refNode, i ) );
+    }
+  }
+
+  // The node sets hold the same global nodes
+  refNodeManager.sets().forWrappers< SortedArray< localIndex > >( [&]( auto const & wrapper )
+  {
+    SortedArrayView< localIndex const > const refSet = wrapper.reference().toViewConst();
+    SortedArrayView< localIndex const > const newSet =
+      newNodeManager.sets().template getReference< SortedArray< localIndex > >( wrapper.getName() ).toViewConst();
+    ASSERT_EQ( refSet.size(), newSet.size() );
+    for( localIndex const a : newSet )
+    {
+      EXPECT_TRUE( refSet.contains( refNodeManager.globalToLocalMap( newNodeLocalToGlobal[a] ) ) );
+    }
+  } );
+
+  // Cells with the same global index have the same global nodes
+  CellBlockManager & refCellBlockManager = *reference.GetGroup< CellBlockManager >( keys::cellManager );
+  CellBlockManager & newCellBlockManager = *reordered.GetGroup< CellBlockManager >( keys::cellManager );
+  newCellBlockManager.forElementSubRegions( [&]( CellBlock & newCellBlock )
+  {
+    CellBlock const & refCellBlock = *refCellBlockManager.GetRegion( newCellBlock.getName() );
+    ASSERT_EQ( refCellBlock.size(), newCellBlock.size() );
+
+    std::map< globalIndex, localIndex > refCellGlobalToLocal;
+    for( localIndex k = 0; k < refCellBlock.size(); ++k )
+    {
+      refCellGlobalToLocal[ refCellBlock.localToGlobalMap()[k] ] = k;
+    }
+
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const refCellToNodes = refCellBlock.nodeList().toViewConst();
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const newCellToNodes = newCellBlock.nodeList().toViewConst();
+    for( localIndex k = 0; k < newCellBlock.size(); ++k )
+    {
+      localIndex const refCell = refCellGlobalToLocal.at( newCellBlock.localToGlobalMap()[k] );
+      for( localIndex a = 0; a < newCellToNodes.size( 1 ); ++a )
+      {
+        EXPECT_EQ( newNodeLocalToGlobal[ newCellToNodes( k, a ) ], refNodeLocalToGlobal[ refCellToNodes( refCell, a ) ] );
+      }
+    }
+  } );
+}
+
+/**
+ * @brief Check that the reordering changed the local numbering of the nodes and of the cells.
+ * @param reference the mesh generated without reordering
+ * @param reordered the reordered mesh
+ */
+void CheckNumberingChanged( DomainPartition & reference, DomainPartition & reordered )
+{
+  NodeManager const & refNodeManager = *reference.getMeshBody( 0 )->getMeshLevel( 0 )->getNodeManager();
+  NodeManager const & newNodeManager = *reordered.getMeshBody( 0 )->getMeshLevel( 0 )->getNodeManager();
+
+  localIndex numMovedNodes = 0;
+  for( localIndex a = 0; a < newNodeManager.size(); ++a )
+  {
+    numMovedNodes += newNodeManager.localToGlobalMap()[a] != refNodeManager.localToGlobalMap()[a];
+  }
+  EXPECT_GT( numMovedNodes, 0 );
+
+  CellBlockManager & refCellBlockManager = *reference.GetGroup< CellBlockManager >( keys::cellManager );
+  CellBlockManager & newCellBlockManager = *reordered.GetGroup< CellBlockManager >( keys::cellManager );
+  newCellBlockManager.forElementSubRegions( [&]( CellBlock & newCellBlock )
+  {
+    CellBlock const & refCellBlock = *refCellBlockManager.GetRegion( newCellBlock.getName() );
+    localIndex numMovedCells = 0;
+    for( localIndex k = 0; k < newCellBlock.size(); ++k )
+    {
+      numMovedCells += newCellBlock.localToGlobalMap()[k] != refCellBlock.localToGlobalMap()[k];
+    }
+    EXPECT_GT( numMovedCells, 0 ) << newCellBlock.getName();
+  } );
+}
+
+/**
+ * @brief Compute the sum over the cells of the span of their local node indices.
+ * @param domain the domain holding the mesh
+ * @return the sum of the differences between the highest and the lowest node index of each cell
+ */
+localIndex ComputeCellToNodeSpan( DomainPartition & domain )
+{
+  localIndex span = 0;
+  CellBlockManager & cellBlockManager = *domain.GetGroup< CellBlockManager >( keys::cellManager );
+  cellBlockManager.forElementSubRegions( [&]( CellBlock & cellBlock )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const cellToNodes = cellBlock.nodeList().toViewConst();
+    for( localIndex k = 0; k < cellBlock.size(); ++k )
+    {
+      localIndex minNode = cellToNodes( k, 0 );
+      localIndex maxNode = cellToNodes( k, 0 );
+      for( localIndex a = 1; a < cellToNodes.size( 1 ); ++a )
+      {
+        minNode = std::min( minNode, cellToNodes( k, a ) );
+        maxNode = std::max( maxNode, cellToNodes( k, a ) );
+      }
+      span += maxNode - minNode;
+    }
+  } );
+  return span;
+}
+
+}
+
+TEST( CellBlockReordering, Morton )
+{
+  std::unique_ptr< DomainPartition > const reference = GenerateInternalMesh( "none" );
+  std::unique_ptr< DomainPartition > const reordered = GenerateInternalMesh( "morton" );
+  CompareMeshes( *reference, *reordered );
+  CheckNumberingChanged( *reference, *reordered );
+  EXPECT_LT( ComputeCellToNodeSpan( *reordered ), ComputeCellToNodeSpan( *reference ) );
+}
+
+TEST( CellBlockReordering, ReverseCuthillMcKee )
+{
+  std::unique_ptr< DomainPartition > const reference = GenerateInternalMesh( "none" );
+  std::unique_ptr< DomainPartition > const reordered = GenerateInternalMesh( "reverseCuthillMcKee" );
+  CompareMeshes( *reference, *reordered );
+  CheckNumberingChanged( *reference, *reordered );
+  EXPECT_LT( ComputeCellToNodeSpan( *reordered ), ComputeCellToNodeSpan( *reference ) );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -761,6 +761,8 @@ void CommunicationTools::FindGhosts( MeshLevel & meshLevel,
   edgeManager.compressRelationMaps();
   faceManager.compressRelationMaps();
 
+  meshLevel.incrementTopologyVersion();
+
   CommunicationTools::releaseCommID( commID );
 }
 
@@ -197,6 +197,23 @@ int MpiWrapper::Waitall( int count, MPI_Request array_of_requests[], MPI_Status
   return 0;
 }
 
+int MpiWrapper::Startall( int count, MPI_Request array_of_requests[] )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Startall( count, array_of_requests );
+#endif
+  return 0;
+}
+
+int MpiWrapper::Request_free( MPI_Request * request )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Request_free( request );
+#endif
+  *request = MPI_REQUEST_NULL;
+  return 0;
+}
+
 double MpiWrapper::Wtime( void )
 {
 #ifdef GEOSX_USE_MPI
@@ -196,6 +196,10 @@ public:
 
   static int Waitall( int count, MPI_Request array_of_requests[], MPI_Status array_of_statuses[] );
 
+  static int Startall( int count, MPI_Request array_of_requests[] );
+
+  static int Request_free( MPI_Request * request );
+
   static double Wtime( void );
 
 
@@ -320,6 +324,19 @@ public:
   template< typename T >
   static int allReduce( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Iallreduce.
+   * @param[in] sendbuf The pointer to the sending buffer.
+   * @param[out] recvbuf The pointer to the receive buffer, valid once @p request has completed.
+   * @param[in] count The number of values to send/receive.
+   * @param[in] op The MPI_Op to perform.
+   * @param[in] comm The MPI_Comm over which the reduction operates.
+   * @param[out] request The MPI_Request to wait on.
+   * @return The return value of the underlying call to MPI_Iallreduce().
+   */
+  template< typename T >
+  static int iAllReduce( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm, MPI_Request * request );
+
 
   template< typename T >
   static int scan( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm );
@@ -391,6 +408,53 @@ public:
                       int root,
                       MPI_Comm comm );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Alltoall.
+   * @tparam T The type of the values exchanged
+   * @param[in] sendbuf The pointer to the sending buffer.
+   * @param[in] count The number of values sent to (and received from) each rank.
+   * @param[out] recvbuf The pointer to the receive buffer.
+   * @param[in] comm The MPI_Comm over which the exchange operates.
+   * @return The return value of the underlying call to MPI_Alltoall().
+   */
+  template< typename T >
+  static int allToAll( T const * const sendbuf,
+                       int count,
+                       T * const recvbuf,
+                       MPI_Comm comm );
+
+  /**
+   * @brief Strongly typed wrapper around MPI_Alltoallv.
+   * @tparam T The type of the values exchanged
+   * @param[in] sendbuf The pointer to the sending buffer.
+   * @param[in] sendcounts The number of values sent to each rank.
+   * @param[in] sdispls The displacements in \p sendbuf of the values sent to each rank.
+   * @param[out] recvbuf The pointer to the receive buffer.
+   * @param[in] recvcounts The number of values received from each rank.
+   * @param[in] rdispls The displacements in \p recvbuf of the values received from each rank.
+   * @param[in] comm The MPI_Comm over which the exchange operates.
+   * @return The return value of the underlying call to MPI_Alltoallv().
+   */
+  template< typename T >
+  static int allToAllv( T const * const sendbuf,
+                        int const * sendcounts,
+                        int const * sdispls,
+                        T * const recvbuf,
+                        int const * recvcounts,
+                        int const * rdispls,
+                        MPI_Comm comm );
+
+  /**
+   * @brief Exchange arrays of values of different sizes between all the ranks.
+   * @tparam T The type of the values exchanged
+   * @param[in] sendBuffers The values sent to each rank.
+   * @param[in] comm The MPI_Comm over which the exchange operates.
+   * @return The values received from each rank.
+   */
+  template< typename T >
+  static std::vector< std::vector< T > > allToAllv( std::vector< std::vector< T > > const & sendBuffers,
+                                                    MPI_Comm comm );
+
 
   /**
    * @brief Returns an MPI_Datatype from a c type.
@@ -459,6 +523,42 @@ public:
                     MPI_Comm comm,
                     MPI_Request * request );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Send_init()
+   * @param[in] buf The pointer to the buffer that contains the data to be sent.
+   * @param[in] count The number of elements in \p buf.
+   * @param[in] dest The rank of the destination process within \p comm.
+   * @param[in] tag The message tag that is be used to distinguish different types of messages.
+   * @param[in] comm The handle to the MPI_Comm.
+   * @param[out] request Pointer to the persistent MPI_Request associated with this request.
+   * @return The return code from MPI_Send_init.
+   */
+  template< typename T >
+  static int Send_init( T const * const buf,
+                        int count,
+                        int dest,
+                        int tag,
+                        MPI_Comm comm,
+                        MPI_Request * request );
+
+  /**
+   * @brief Strongly typed wrapper around MPI_Recv_init()
+   * @param[out] buf The pointer to the buffer that contains the data to be received.
+   * @param[in] count The number of elements in \p buf
+   * @param[in] source The rank of the source process within \p comm.
+   * @param[in] tag The message tag that is be used to distinguish different types of messages
+   * @param[in] comm The handle to the MPI_Comm
+   * @param[out] request Pointer to the persistent MPI_Request associated with this request.
+   * @return The return code from MPI_Recv_init.
+   */
+  template< typename T >
+  static int Recv_init( T * const buf,
+                        int count,
+                        int source,
+                        int tag,
+                        MPI_Comm comm,
+                        MPI_Request * request );
+
   /**
    * @brief Convenience function for a MPI_Reduce using a MPI_MIN operation.
    * @param value the value to send into the reduction.
@@ -626,6 +726,24 @@ int MpiWrapper::allReduce( T const * const sendbuf,
 #endif
 }
 
+template< typename T >
+int MpiWrapper::iAllReduce( T const * const sendbuf,
+                            T * const recvbuf,
+                            int count,
+                            MPI_Op MPI_PARAM( op ),
+                            MPI_Comm MPI_PARAM( comm ),
+                            MPI_Request * const request )
+{
+#ifdef GEOSX_USE_MPI
+  MPI_Datatype const MPI_TYPE = getMpiType< T >();
+  return MPI_Iallreduce( sendbuf, recvbuf, count, MPI_TYPE, op, comm, request );
+#else
+  memcpy( recvbuf, sendbuf, count*sizeof(T) );
+  *request = MPI_REQUEST_NULL;
+  return 0;
+#endif
+}
+
 template< typename T >
 int MpiWrapper::scan( T const * const sendbuf,
                       T * const recvbuf,
@@ -740,6 +858,81 @@ int MpiWrapper::gatherv( TS const * const sendbuf,
 #endif
 }
 
+template< typename T >
+int MpiWrapper::allToAll( T const * const sendbuf,
+                          int count,
+                          T * const recvbuf,
+                          MPI_Comm MPI_PARAM( comm ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Alltoall( sendbuf, count, getMpiType< T >(), recvbuf, count, getMpiType< T >(), comm );
+#else
+  memcpy( recvbuf, sendbuf, count * sizeof( T ) );
+  return 0;
+#endif
+}
+
+template< typename T >
+int MpiWrapper::allToAllv( T const * const sendbuf,
+                           int const * sendcounts,
+                           int const * sdispls,
+                           T * const recvbuf,
+                           int const * recvcounts,
+                           int const * rdispls,
+                           MPI_Comm MPI_PARAM( comm ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Alltoallv( sendbuf, sendcounts, sdispls, getMpiType< T >(),
+                        recvbuf, recvcounts, rdispls, getMpiType< T >(), comm );
+#else
+  GEOSX_ERROR_IF_NE_MSG( sendcounts[0], recvcounts[0], "size of send buffer and receive buffer are not equal" );
+  memcpy( recvbuf + rdispls[0], sendbuf + sdispls[0], sendcounts[0] * sizeof( T ) );
+  return 0;
+#endif
+}
+
+template< typename T >
+std::vector< std::vector< T > > MpiWrapper::allToAllv( std::vector< std::vector< T > > const & sendBuffers,
+                                                       MPI_Comm comm )
+{
+  int const numRanks = LvArray::integerConversion< int >( sendBuffers.size() );
+  GEOSX_ERROR_IF_NE( numRanks, Comm_size( comm ) );
+
+  std::vector< int > sendCounts( numRanks );
+  std::vector< int > sendDispls( numRanks + 1, 0 );
+  for( int r = 0; r < numRanks; ++r )
+  {
+    sendCounts[r] = LvArray::integerConversion< int >( sendBuffers[r].size() );
+    sendDispls[r + 1] = sendDispls[r] + sendCounts[r];
+  }
+
+  std::vector< int > recvCounts( numRanks );
+  allToAll( sendCounts.data(), 1, recvCounts.data(), comm );
+
+  std::vector< int > recvDispls( numRanks + 1, 0 );
+  for( int r = 0; r < numRanks; ++r )
+  {
+    recvDispls[r + 1] = recvDispls[r] + recvCounts[r];
+  }
+
+  std::vector< T > sendBuffer( sendDispls[numRanks] );
+  for( int r = 0; r < numRanks; ++r )
+  {
+    std::copy( sendBuffers[r].begin(), sendBuffers[r].end(), sendBuffer.begin() + sendDispls[r] );
+  }
+
+  std::vector< T > recvBuffer( recvDispls[numRanks] );
+  allToAllv( sendBuffer.data(), sendCounts.data(), sendDispls.data(),
+             recvBuffer.data(), recvCounts.data(), recvDispls.data(), comm );
+
+  std::vector< std::vector< T > > recvBuffers( numRanks );
+  for( int r = 0; r < numRanks; ++r )
+  {
+    recvBuffers[r].assign( recvBuffer.begin() + recvDispls[r], recvBuffer.begin() + recvDispls[r + 1] );
+  }
+  return recvBuffers;
+}
+
 template< typename T >
 int MpiWrapper::iRecv( T * const buf,
                        int count,
@@ -770,6 +963,38 @@ int MpiWrapper::iRecv( T * const buf,
 #endif
 }
 
+template< typename T >
+int MpiWrapper::Send_init( T const * const MPI_PARAM( buf ),
+                           int MPI_PARAM( count ),
+                           int MPI_PARAM( dest ),
+                           int MPI_PARAM( tag ),
+                           MPI_Comm MPI_PARAM( comm ),
+                           MPI_Request * MPI_PARAM( request ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Send_init( buf, count, getMpiType< T >(), dest, tag, comm, request );
+#else
+  GEOSX_ERROR( "Not implemented!" );
+  return MPI_SUCCESS;
+#endif
+}
+
+template< typename T >
+int MpiWrapper::Recv_init( T * const MPI_PARAM( buf ),
+                           int MPI_PARAM( count ),
+                           int MPI_PARAM( source ),
+                           int MPI_PARAM( tag ),
+                           MPI_Comm MPI_PARAM( comm ),
+                           MPI_Request * MPI_PARAM( request ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Recv_init( buf, count, getMpiType< T >(), source, tag, comm, request );
+#else
+  GEOSX_ERROR( "Not implemented!" );
+  return MPI_SUCCESS;
+#endif
+}
+
 template< typename T >
 int MpiWrapper::recv( array1d< T > & buf,
                       int MPI_PARAM( source ),
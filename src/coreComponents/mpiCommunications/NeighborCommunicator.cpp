@@ -558,6 +558,15 @@ int NeighborCommunicator::PackCommSizeForSync( std::map< string, string_array >
                                                MeshLevel const & mesh,
                                                int const commID,
                                                bool on_device )
+{
+  int const bufferSize = PackSizeForSync( fieldNames, mesh, on_device );
+  this->m_sendBufferSize[commID] = bufferSize;
+  return bufferSize;
+}
+
+int NeighborCommunicator::PackSizeForSync( std::map< string, string_array > const & fieldNames,
+                                           MeshLevel const & mesh,
+                                           bool on_device ) const
 {
   GEOSX_MARK_FUNCTION;
 
@@ -595,7 +604,6 @@ int NeighborCommunicator::PackCommSizeForSync( std::map< string, string_array >
     } );
   }
 
-  this->m_sendBufferSize[commID] = bufferSize;
   return bufferSize;
 }
 
@@ -604,6 +612,20 @@ void NeighborCommunicator::PackCommBufferForSync( std::map< string, string_array
                                                   MeshLevel const & mesh,
                                                   int const commID,
                                                   bool on_device )
+{
+  buffer_type & sendBuffer = SendBuffer( commID );
+  int const bufferSize =  LvArray::integerConversion< int >( sendBuffer.size());
+
+  int const packedSize = PackCommBufferForSync( fieldNames, mesh, sendBuffer.data(), on_device );
+
+  GEOSX_ERROR_IF_NE( bufferSize, packedSize );
+}
+
+
+int NeighborCommunicator::PackCommBufferForSync( std::map< string, string_array > const & fieldNames,
+                                                 MeshLevel const & mesh,
+                                                 buffer_unit_type * sendBufferPtr,
+                                                 bool on_device ) const
 {
   GEOSX_MARK_FUNCTION;
 
@@ -616,10 +638,6 @@ void NeighborCommunicator::PackCommBufferForSync( std::map< string, string_array
   arrayView1d< localIndex const > const & edgeGhostsToSend = edgeManager.getNeighborData( m_neighborRank ).ghostsToSend();
   arrayView1d< localIndex const > const & faceGhostsToSend = faceManager.getNeighborData( m_neighborRank ).ghostsToSend();
 
-  buffer_type & sendBuffer = SendBuffer( commID );
-  int const bufferSize =  LvArray::integerConversion< int >( sendBuffer.size());
-  buffer_unit_type * sendBufferPtr = sendBuffer.data();
-
   int packedSize = 0;
   if( fieldNames.count( "node" ) > 0 )
   {
@@ -644,7 +662,7 @@ void NeighborCommunicator::PackCommBufferForSync( std::map< string, string_array
     } );
   }
 
-  GEOSX_ERROR_IF_NE( bufferSize, packedSize );
+  return packedSize;
 }
 
 
@@ -659,10 +677,16 @@ void NeighborCommunicator::UnpackBufferForSync( std::map< string, string_array >
                                                 int const commID,
                                                 bool on_device )
 {
-  GEOSX_MARK_FUNCTION;
+  UnpackBufferForSync( fieldNames, mesh, ReceiveBuffer( commID ).data(), on_device );
+}
 
-  buffer_type const & receiveBuffer = ReceiveBuffer( commID );
-  buffer_unit_type const * receiveBufferPtr = receiveBuffer.data();
+
+int NeighborCommunicator::UnpackBufferForSync( std::map< string, string_array > const & fieldNames,
+                                               MeshLevel * const mesh,
+                                               buffer_unit_type const * receiveBufferPtr,
+                                               bool on_device )
+{
+  GEOSX_MARK_FUNCTION;
 
   NodeManager & nodeManager = *(mesh->getNodeManager());
   EdgeManager & edgeManager = *(mesh->getEdgeManager());
@@ -697,6 +721,8 @@ void NeighborCommunicator::UnpackBufferForSync( std::map< string, string_array >
       unpackedSize += subRegion.Unpack( receiveBufferPtr, subRegion.getNeighborData( m_neighborRank ).ghostsToReceive(), 0, on_device );
     } );
   }
+
+  return unpackedSize;
 }
 
 
@@ -270,11 +270,35 @@ public:
                               int const commID,
                               bool on_device = false );
 
+  /**
+   * @brief Pack the synchronized fields into an externally owned buffer.
+   * @param fieldNames map from the object type ("node", "edge", "face", "elems") to the fields to pack
+   * @param meshLevel the mesh level holding the fields
+   * @param sendBufferPtr pointer to the start of a buffer of at least PackSizeForSync() bytes
+   * @param on_device whether the fields are packed on device
+   * @return the number of bytes packed
+   */
+  int PackCommBufferForSync( std::map< string, string_array > const & fieldNames,
+                             MeshLevel const & meshLevel,
+                             buffer_unit_type * sendBufferPtr,
+                             bool on_device ) const;
+
   int PackCommSizeForSync( std::map< string, string_array > const & fieldNames,
                            MeshLevel const & meshLevel,
                            int const commID,
                            bool on_device = false );
 
+  /**
+   * @brief Compute the size of the buffer needed to synchronize fields with this neighbor.
+   * @param fieldNames map from the object type ("node", "edge", "face", "elems") to the fields to pack
+   * @param meshLevel the mesh level holding the fields
+   * @param on_device whether the fields are packed on device
+   * @return the size of the buffer in bytes
+   */
+  int PackSizeForSync( std::map< string, string_array > const & fieldNames,
+                       MeshLevel const & meshLevel,
+                       bool on_device ) const;
+
   void SendRecvBuffers( int const commID );
 
   void UnpackBufferForSync( std::map< string, string_array > const & fieldNames,
@@ -282,6 +306,19 @@ public:
                             int const commID,
                             bool on_device = false );
 
+  /**
+   * @brief Unpack the synchronized fields from an externally owned buffer.
+   * @param fieldNames map from the object type ("node", "edge", "face", "elems") to the fields to unpack
+   * @param meshLevel the mesh level holding the fields
+   * @param receiveBufferPtr pointer to the start of the received buffer
+   * @param on_device whether the fields are unpacked on device
+   * @return the number of bytes unpacked
+   */
+  int UnpackBufferForSync( std::map< string, string_array > const & fieldNames,
+                           MeshLevel * const meshLevel,
+                           buffer_unit_type const * receiveBufferPtr,
+                           bool on_device );
+
   void SetNeighborRank( int const rank ) { m_neighborRank = rank; }
   int NeighborRank() const { return m_neighborRank; }
 
@@ -0,0 +1,202 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PersistentCommPlan.cpp
+ */
+
+#include "mpiCommunications/PersistentCommPlan.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/NeighborCommunicator.hpp"
+#include "mesh/MeshLevel.hpp"
+
+namespace geosx
+{
+
+PersistentCommPlan::PersistentCommPlan():
+  m_fieldNames(),
+  m_onDevice( false ),
+  m_topologyVersion( -1 ),
+  m_commID( -1 ),
+  m_neighborRanks(),
+  m_sendBuffers(),
+  m_recvBuffers(),
+  m_sendRequests(),
+  m_recvRequests(),
+  m_sendStatuses(),
+  m_recvStatuses()
+{}
+
+PersistentCommPlan::~PersistentCommPlan()
+{
+  invalidate();
+  if( m_commID >= 0 )
+  {
+    CommunicationTools::releaseCommID( m_commID );
+  }
+}
+
+bool PersistentCommPlan::isValid( MeshLevel const & mesh,
+                                  std::vector< NeighborCommunicator > const & neighbors ) const
+{
+  if( m_topologyVersion < 0 || m_topologyVersion != mesh.topologyVersion() )
+  {
+    return false;
+  }
+
+  if( m_neighborRanks.size() != LvArray::integerConversion< localIndex >( neighbors.size() ) )
+  {
+    return false;
+  }
+
+  for( std::size_t i = 0; i < neighbors.size(); ++i )
+  {
+    if( m_neighborRanks[i] != neighbors[i].NeighborRank() )
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void PersistentCommPlan::invalidate()
+{
+  for( localIndex i = 0; i < m_sendRequests.size(); ++i )
+  {
+    if( m_sendRequests[i] != MPI_REQUEST_NULL )
+    {
+      MpiWrapper::Request_free( &m_sendRequests[i] );
+    }
+    if( m_recvRequests[i] != MPI_REQUEST_NULL )
+    {
+      MpiWrapper::Request_free( &m_recvRequests[i] );
+    }
+  }
+
+  m_sendRequests.clear();
+  m_recvRequests.clear();
+  m_topologyVersion = -1;
+}
+
+void PersistentCommPlan::setup( std::map< string, string_array > const & fieldNames,
+                                MeshLevel const & mesh,
+                                std::vector< NeighborCommunicator > const & neighbors,
+                                bool on_device )
+{
+  GEOSX_MARK_FUNCTION;
+
+  invalidate();
+
+  if( m_commID < 0 )
+  {
+    m_commID = CommunicationTools::reserveCommID();
+  }
+
+  m_fieldNames = fieldNames;
+  m_onDevice = on_device;
+
+  int const numNeighbors = LvArray::integerConversion< int >( neighbors.size() );
+  int const myRank = MpiWrapper::Comm_rank();
+
+  m_neighborRanks.resize( numNeighbors );
+  m_sendBuffers.resize( numNeighbors );
+  m_recvBuffers.resize( numNeighbors );
+  m_sendRequests.resize( numNeighbors );
+  m_recvRequests.resize( numNeighbors );
+  m_sendStatuses.resize( numNeighbors );
+  m_recvStatuses.resize( numNeighbors );
+
+  // exchange the buffer sizes once, they do not change until the topology does
+  array1d< int > sendSizes( numNeighbors );
+  array1d< int > recvSizes( numNeighbors );
+  for( int i = 0; i < numNeighbors; ++i )
+  {
+    NeighborCommunicator const & neighbor = neighbors[i];
+    m_neighborRanks[i] = neighbor.NeighborRank();
+    sendSizes[i] = neighbor.PackSizeForSync( m_fieldNames, mesh, m_onDevice );
+
+    MpiWrapper::iSend( &sendSizes[i], 1, m_neighborRanks[i],
+                       CommTag( myRank, m_neighborRanks[i], m_commID ),
+                       MPI_COMM_GEOSX, &m_sendRequests[i] );
+    MpiWrapper::iRecv( &recvSizes[i], 1, m_neighborRanks[i],
+                       CommTag( m_neighborRanks[i], myRank, m_commID ),
+                       MPI_COMM_GEOSX, &m_recvRequests[i] );
+  }
+  MpiWrapper::Waitall( numNeighbors, m_recvRequests.data(), m_recvStatuses.data() );
+  MpiWrapper::Waitall( numNeighbors, m_sendRequests.data(), m_sendStatuses.data() );
+
+  // allocate the buffers and bind the persistent requests to them
+  for( int i = 0; i < numNeighbors; ++i )
+  {
+    m_sendBuffers[i].resize( sendSizes[i] );
+    m_recvBuffers[i].resize( recvSizes[i] );
+
+    MpiWrapper::Send_init( m_sendBuffers[i].data(), sendSizes[i], m_neighborRanks[i],
+                           CommTag( myRank, m_neighborRanks[i], m_commID ),
+                           MPI_COMM_GEOSX, &m_sendRequests[i] );
+    MpiWrapper::Recv_init( m_recvBuffers[i].data(), recvSizes[i], m_neighborRanks[i],
+                           CommTag( m_neighborRanks[i], myRank, m_commID ),
+                           MPI_COMM_GEOSX, &m_recvRequests[i] );
+  }
+
+  m_topologyVersion = mesh.topologyVersion();
+}
+
+void PersistentCommPlan::packSendRecv( MeshLevel const & mesh,
+                                       std::vector< NeighborCommunicator > & neighbors )
+{
+  GEOSX_MARK_FUNCTION;
+  GEOSX_ASSERT( isValid( mesh, neighbors ) );
+
+  int const numNeighbors = LvArray::integerConversion< int >( neighbors.size() );
+
+  // receives are posted first so that the messages can land directly in the receive buffers
+  MpiWrapper::Startall( numNeighbors, m_recvRequests.data() );
+
+  for( int i = 0; i < numNeighbors; ++i )
+  {
+    int const packedSize = neighbors[i].PackCommBufferForSync( m_fieldNames, mesh, m_sendBuffers[i].data(), m_onDevice );
+    GEOSX_ERROR_IF_NE( packedSize, LvArray::integerConversion< int >( m_sendBuffers[i].size() ) );
+  }
+
+  MpiWrapper::Startall( numNeighbors, m_sendRequests.data() );
+}
+
+void PersistentCommPlan::unpack( MeshLevel & mesh,
+                                 std::vector< NeighborCommunicator > & neighbors )
+{
+  GEOSX_MARK_FUNCTION;
+
+  int const numNeighbors = LvArray::integerConversion< int >( neighbors.size() );
+
+  for( int count = 0; count < numNeighbors; ++count )
+  {
+    int neighborIndex;
+    MpiWrapper::Waitany( numNeighbors,
+                         m_recvRequests.data(),
+                         &neighborIndex,
+                         m_recvStatuses.data() );
+
+    neighbors[neighborIndex].UnpackBufferForSync( m_fieldNames, &mesh, m_recvBuffers[neighborIndex].data(), m_onDevice );
+  }
+
+  MpiWrapper::Waitall( numNeighbors,
+                       m_sendRequests.data(),
+                       m_sendStatuses.data() );
+}
+
+} /* namespace geosx */
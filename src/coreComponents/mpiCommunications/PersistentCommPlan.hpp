@@ -0,0 +1,138 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PersistentCommPlan.hpp
+ */
+
+#ifndef GEOSX_MPICOMMUNICATIONS_PERSISTENTCOMMPLAN_HPP_
+#define GEOSX_MPICOMMUNICATIONS_PERSISTENTCOMMPLAN_HPP_
+
+#include "MpiWrapper.hpp"
+
+#include "common/DataTypes.hpp"
+
+namespace geosx
+{
+
+class MeshLevel;
+class NeighborCommunicator;
+
+/**
+ * @class PersistentCommPlan
+ * @brief Reusable plan for the repeated synchronization of a fixed set of fields.
+ * @details The plan computes the buffer sizes for every neighbor once, exchanges them once,
+ *          allocates its own send/receive buffers and creates persistent MPI requests on them.
+ *          Each subsequent synchronization only packs, starts the requests and unpacks, without
+ *          any size handshake or buffer reallocation. The plan records the topology version of
+ *          the mesh it was built for and must be rebuilt (see isValid()) whenever it changes.
+ */
+class PersistentCommPlan
+{
+public:
+
+  /**
+   * @brief Constructor.
+   */
+  PersistentCommPlan();
+
+  /**
+   * @brief Destructor, releases the persistent requests and the communication identifier.
+   */
+  ~PersistentCommPlan();
+
+  PersistentCommPlan( PersistentCommPlan const & ) = delete;
+  PersistentCommPlan & operator=( PersistentCommPlan const & ) = delete;
+
+  /**
+   * @brief Check whether the plan may be used to synchronize fields on a mesh.
+   * @param mesh the mesh level on which the fields live
+   * @param neighbors the neighbors of the rank
+   * @return true if the plan was set up for the current topology of @p mesh and the same neighbors
+   */
+  bool isValid( MeshLevel const & mesh,
+                std::vector< NeighborCommunicator > const & neighbors ) const;
+
+  /**
+   * @brief Build the plan. This is a collective call among neighbors.
+   * @param fieldNames map from the object type ("node", "edge", "face", "elems") to the fields to synchronize
+   * @param mesh the mesh level on which the fields live
+   * @param neighbors the neighbors of the rank
+   * @param on_device whether the fields are packed/unpacked on device
+   */
+  void setup( std::map< string, string_array > const & fieldNames,
+              MeshLevel const & mesh,
+              std::vector< NeighborCommunicator > const & neighbors,
+              bool on_device = false );
+
+  /**
+   * @brief Release the persistent requests, the plan has to be set up again before further use.
+   */
+  void invalidate();
+
+  /**
+   * @brief Pack the fields and start the persistent sends and receives.
+   * @param mesh the mesh level on which the fields live
+   * @param neighbors the neighbors of the rank
+   */
+  void packSendRecv( MeshLevel const & mesh,
+                     std::vector< NeighborCommunicator > & neighbors );
+
+  /**
+   * @brief Wait for the receives started by packSendRecv(), unpack them and complete the sends.
+   * @param mesh the mesh level on which the fields live
+   * @param neighbors the neighbors of the rank
+   */
+  void unpack( MeshLevel & mesh,
+               std::vector< NeighborCommunicator > & neighbors );
+
+private:
+
+  /// Fields synchronized by the plan
+  std::map< string, string_array > m_fieldNames;
+
+  /// Whether packing/unpacking happens on device
+  bool m_onDevice;
+
+  /// Topology version of the mesh the plan was built for, -1 when the plan is not set up
+  localIndex m_topologyVersion;
+
+  /// Communication identifier (i.e. message tag) reserved by the plan
+  int m_commID;
+
+  /// Ranks of the neighbors the plan was built for
+  array1d< int > m_neighborRanks;
+
+  /// Send buffer of each neighbor
+  std::vector< buffer_type > m_sendBuffers;
+
+  /// Receive buffer of each neighbor
+  std::vector< buffer_type > m_recvBuffers;
+
+  /// Persistent send requests
+  array1d< MPI_Request > m_sendRequests;
+
+  /// Persistent receive requests
+  array1d< MPI_Request > m_recvRequests;
+
+  /// Send statuses
+  array1d< MPI_Status > m_sendStatuses;
+
+  /// Receive statuses
+  array1d< MPI_Status > m_recvStatuses;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MPICOMMUNICATIONS_PERSISTENTCOMMPLAN_HPP_ */
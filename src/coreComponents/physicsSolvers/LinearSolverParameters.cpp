@@ -45,6 +45,13 @@ LinearSolverParametersInput::LinearSolverParametersInput( std::string const & na
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Whether to stop the simulation if the linear solver reports an error" );
 
+  registerWrapper( viewKeyStruct::matrixFreeString, &m_parameters.matrixFree )->
+    setApplyDefaultValue( m_parameters.matrixFree )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Whether to apply the system operator without assembling the matrix, if supported by the physics solver. "
+                    "Only the diagonal of the matrix is assembled, for the preconditioner. "
+                    "Requires an iterative solver and a jacobi, chebyshev or none preconditioner" );
+
   registerWrapper( viewKeyStruct::directCheckResTolString, &m_parameters.direct.checkResidualTolerance )->
     setApplyDefaultValue( m_parameters.direct.checkResidualTolerance )->
     setInputFlag( InputFlags::OPTIONAL )->
@@ -109,6 +116,12 @@ LinearSolverParametersInput::LinearSolverParametersInput( std::string const & na
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Weakest-allowed tolerance for adaptive method" );
 
+  registerWrapper( viewKeyStruct::krylovOrthoString, &m_parameters.krylov.orthogonalization )->
+    setApplyDefaultValue( m_parameters.krylov.orthogonalization )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Orthogonalization of the Krylov basis (GMRES only). Available options are:\n* " +
+                    EnumStrings< LinearSolverParameters::Krylov::Orthogonalization >::concat( "\n* " ) );
+
   registerWrapper( viewKeyStruct::amgNumSweepsString, &m_parameters.amg.numSweeps )->
     setApplyDefaultValue( m_parameters.amg.numSweeps )->
     setInputFlag( InputFlags::OPTIONAL )->
@@ -140,6 +153,38 @@ LinearSolverParametersInput::LinearSolverParametersInput( std::string const & na
     setApplyDefaultValue( m_parameters.ilu.threshold )->
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "ILU(T) threshold factor" );
+
+  registerWrapper( viewKeyStruct::chebyshevDegreeString, &m_parameters.chebyshev.degree )->
+    setApplyDefaultValue( m_parameters.chebyshev.degree )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Degree of the Chebyshev polynomial preconditioner" );
+
+  registerWrapper( viewKeyStruct::chebyshevEigRatioString, &m_parameters.chebyshev.eigRatio )->
+    setApplyDefaultValue( m_parameters.chebyshev.eigRatio )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Ratio of the estimated largest eigenvalue of the Jacobi-scaled operator to the smallest eigenvalue "
+                    "targeted by the Chebyshev polynomial preconditioner" );
+
+  registerWrapper( viewKeyStruct::precondMaxReuseString, &m_parameters.precondReuse.maxReuse )->
+    setApplyDefaultValue( m_parameters.precondReuse.maxReuse )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Maximum number of linear solves (across Newton iterations and time steps) reusing a preconditioner "
+                    "after its setup. 0 recomputes the preconditioner at every solve. "
+                    "Reuse requires an iterative solver and replaces the solvers of the linear algebra package "
+                    "by the native Krylov solvers" );
+
+  registerWrapper( viewKeyStruct::precondIterFactorString, &m_parameters.precondReuse.iterFactor )->
+    setApplyDefaultValue( m_parameters.precondReuse.iterFactor )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "A reused preconditioner is recomputed when the number of Krylov iterations exceeds "
+                    "this factor times the number of iterations of the first solve after its setup" );
+
+  registerWrapper( viewKeyStruct::precondRefreshValuesString, &m_parameters.precondReuse.refreshValues )->
+    setApplyDefaultValue( m_parameters.precondReuse.refreshValues )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Whether a preconditioner reaching precondMaxReuse is only refreshed for the new matrix values "
+                    "when the sparsity is unchanged, keeping the AMG coarsening and interpolation (Trilinos/ML, PETSc/GAMG) "
+                    "and symbolic factorizations. Setups caused by iteration growth or failed solves are always full" );
 }
 
 void LinearSolverParametersInput::PostProcessInput()
@@ -149,6 +194,8 @@ void LinearSolverParametersInput::PostProcessInput()
   static const std::set< integer > binaryOptions = { 0, 1 };
 
   GEOSX_ERROR_IF( binaryOptions.count( m_parameters.stopIfError ) == 0, viewKeyStruct::stopIfErrorString << " option can be either 0 (false) or 1 (true)" );
+  GEOSX_ERROR_IF( binaryOptions.count( m_parameters.matrixFree ) == 0, viewKeyStruct::matrixFreeString << " option can be either 0 (false) or 1 (true)" );
+  GEOSX_ERROR_IF( binaryOptions.count( m_parameters.precondReuse.refreshValues ) == 0, viewKeyStruct::precondRefreshValuesString << " option can be either 0 (false) or 1 (true)" );
   GEOSX_ERROR_IF( binaryOptions.count( m_parameters.direct.equilibrate ) == 0, viewKeyStruct::directEquilString << " option can be either 0 (false) or 1 (true)" );
   GEOSX_ERROR_IF( binaryOptions.count( m_parameters.direct.replaceTinyPivot ) == 0, viewKeyStruct::directReplTinyPivotString << " option can be either 0 (false) or 1 (true)" );
   GEOSX_ERROR_IF( binaryOptions.count( m_parameters.direct.iterativeRefine ) == 0, viewKeyStruct::directIterRefString << " option can be either 0 (false) or 1 (true)" );
@@ -162,14 +209,33 @@ void LinearSolverParametersInput::PostProcessInput()
 
   GEOSX_ERROR_IF_LT_MSG( m_parameters.krylov.relTolerance, 0.0, "Invalid value of " << viewKeyStruct::krylovTolString );
   GEOSX_ERROR_IF_GT_MSG( m_parameters.krylov.relTolerance, 1.0, "Invalid value of " << viewKeyStruct::krylovTolString );
+  GEOSX_ERROR_IF( m_parameters.krylov.orthogonalization == LinearSolverParameters::Krylov::Orthogonalization::cgs2 &&
+                  m_parameters.solverType != LinearSolverParameters::SolverType::gmres,
+                  viewKeyStruct::krylovOrthoString << " = " << m_parameters.krylov.orthogonalization <<
+                  " is only available with " << viewKeyStruct::solverTypeString << " = " << LinearSolverParameters::SolverType::gmres );
 
   GEOSX_ERROR_IF_LT_MSG( m_parameters.ilu.fill, 0, "Invalid value of " << viewKeyStruct::iluFillString );
   GEOSX_ERROR_IF_LT_MSG( m_parameters.ilu.threshold, 0.0, "Invalid value of " << viewKeyStruct::iluThresholdString );
 
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.chebyshev.degree, 1, "Invalid value of " << viewKeyStruct::chebyshevDegreeString );
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.chebyshev.eigRatio, 1.0, "Invalid value of " << viewKeyStruct::chebyshevEigRatioString );
+
   GEOSX_ERROR_IF_LT_MSG( m_parameters.amg.numSweeps, 0, "Invalid value of " << viewKeyStruct::amgNumSweepsString );
   GEOSX_ERROR_IF_LT_MSG( m_parameters.amg.threshold, 0.0, "Invalid value of " << viewKeyStruct::amgThresholdString );
   GEOSX_ERROR_IF_GT_MSG( m_parameters.amg.threshold, 1.0, "Invalid value of " << viewKeyStruct::amgThresholdString );
 
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.precondReuse.maxReuse, 0, "Invalid value of " << viewKeyStruct::precondMaxReuseString );
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.precondReuse.iterFactor, 1.0, "Invalid value of " << viewKeyStruct::precondIterFactorString );
+
+  if( m_parameters.precondReuse.maxReuse > 0 )
+  {
+    GEOSX_WARNING_IF( m_parameters.solverType == LinearSolverParameters::SolverType::direct,
+                      getName() << ": " << viewKeyStruct::precondMaxReuseString << " is ignored by the direct solver" );
+    GEOSX_LOG_RANK_0_IF( m_parameters.solverType != LinearSolverParameters::SolverType::direct,
+                         getName() << ": " << viewKeyStruct::precondMaxReuseString << " > 0, the linear systems are solved "
+                         "with the native Krylov solvers instead of those of the linear algebra package" );
+  }
+
   // TODO input validation for other AMG parameters ?
 }
 
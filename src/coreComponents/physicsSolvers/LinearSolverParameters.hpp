@@ -71,6 +71,7 @@ public:
     static constexpr auto solverTypeString         = "solverType";         ///< Solver type key
     static constexpr auto preconditionerTypeString = "preconditionerType"; ///< Preconditioner type key
     static constexpr auto stopIfErrorString        = "stopIfError";        ///< stop if error key
+    static constexpr auto matrixFreeString         = "matrixFree";         ///< matrix-free operator key
 
     static constexpr auto directCheckResTolString   = "directCheckResTol";    ///< direct solver check residual tolerance key
     static constexpr auto directEquilString         = "directEquil";          ///< direct solver equilibrate key
@@ -85,6 +86,7 @@ public:
     static constexpr auto krylovTolString         = "krylovTol";         ///< Krylov tolerance key
     static constexpr auto krylovAdaptiveTolString = "krylovAdaptiveTol"; ///< Krylov adaptive tolerance key
     static constexpr auto krylovWeakTolString     = "krylovWeakestTol";  ///< Krylov weakest tolerance key
+    static constexpr auto krylovOrthoString       = "krylovOrthogonalization"; ///< Krylov orthogonalization key
 
     static constexpr auto amgNumSweepsString = "amgNumSweeps";             ///< AMG number of sweeps key
     static constexpr auto amgSmootherString  = "amgSmootherType";          ///< AMG smoother type key
@@ -93,6 +95,13 @@ public:
 
     static constexpr auto iluFillString      = "iluFill";       ///< ILU fill key
     static constexpr auto iluThresholdString = "iluThreshold";  ///< ILU threshold key
+
+    static constexpr auto chebyshevDegreeString   = "chebyshevDegree";   ///< Chebyshev polynomial degree key
+    static constexpr auto chebyshevEigRatioString = "chebyshevEigRatio"; ///< Chebyshev eigenvalue ratio key
+
+    static constexpr auto precondMaxReuseString   = "precondMaxReuse";   ///< Preconditioner max reuse key
+    static constexpr auto precondIterFactorString = "precondIterFactor"; ///< Preconditioner reuse iteration factor key
+    static constexpr auto precondRefreshValuesString = "precondRefreshValues"; ///< Preconditioner values-only refresh key
   } viewKeys;
 
 private:
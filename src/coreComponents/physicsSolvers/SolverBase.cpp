@@ -16,8 +16,8 @@
 #include "PhysicsSolverManager.hpp"
 
 #include "common/TimingMacros.hpp"
+#include "linearAlgebra/solvers/PreconditionerChebyshev.hpp"
 #include "linearAlgebra/utilities/LinearSolverParameters.hpp"
-#include "linearAlgebra/solvers/KrylovSolver.hpp"
 #include "managers/DomainPartition.hpp"
 
 namespace geosx
@@ -33,6 +33,10 @@ SolverBase::SolverBase( std::string const & name,
   m_maxStableDt{ 1e99 },
   m_nextDt( 1e99 ),
   m_dofManager( name ),
+  m_systemSetupTopologyVersion( -1 ),
+  m_precondStructureVersion( -1 ),
+  m_precondNumSolves( 0 ),
+  m_precondSetupIterations( 0 ),
   m_linearSolverParameters( groupKeyStruct::linearSolverParametersString, this ),
   m_nonlinearSolverParameters( groupKeyStruct::nonlinearSolverParametersString, this )
 {
@@ -240,7 +244,7 @@ real64 SolverBase::LinearImplicitStep( real64 const & time_n,
                            m_localRhs.toView() );
 
   // Compose parallel LA matrix/rhs out of local LA matrix/rhs
-  m_matrix.create( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
+  CreateParallelMatrix();
   m_rhs.create( m_localRhs.toViewConst(), MPI_COMM_GEOSX );
   m_solution.createWithLocalSize( m_matrix.numLocalCols(), MPI_COMM_GEOSX );
 
@@ -535,7 +539,7 @@ real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
       }
 
       // Compose parallel LA matrix/rhs out of local LA matrix/rhs
-      m_matrix.create( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
+      CreateParallelMatrix();
       m_rhs.create( m_localRhs.toViewConst(), MPI_COMM_GEOSX );
       m_solution.createWithLocalSize( m_matrix.numLocalCols(), MPI_COMM_GEOSX );
 
@@ -650,6 +654,19 @@ void SolverBase::SetupSystem( DomainPartition & domain,
   localSolution.setName( this->getName() + "/localSolution" );
 }
 
+bool SolverBase::SetupSystemIfTopologyChanged( DomainPartition & domain )
+{
+  localIndex const topologyVersion = domain.getMeshBody( 0 )->getMeshLevel( 0 )->topologyVersion();
+  if( m_systemSetupTopologyVersion >= 0 && m_systemSetupTopologyVersion == topologyVersion )
+  {
+    return false;
+  }
+
+  SetupSystem( domain, m_dofManager, m_localMatrix, m_localRhs, m_localSolution );
+  m_systemSetupTopologyVersion = topologyVersion;
+  return true;
+}
+
 void SolverBase::AssembleSystem( real64 const GEOSX_UNUSED_PARAM( time ),
                                  real64 const GEOSX_UNUSED_PARAM( dt ),
                                  DomainPartition & GEOSX_UNUSED_PARAM( domain ),
@@ -784,7 +801,22 @@ void SolverBase::SolveSystem( DofManager const & dofManager,
   //       so we can have constant access to last solve statistics, convergence history, etc.
   //       This requires unifying "LAI interface" solvers with "native" Krylov solvers somehow.
 
-  if( params.solverType == LinearSolverParameters::SolverType::direct || !m_precond )
+  // Preconditioner reuse requires the "native" iterative solvers, which keep the preconditioner outside the solve
+  // (LinearSolverParametersInput logs this replacement of the solvers of the linear algebra package)
+  bool const reusePrecond = params.precondReuse.maxReuse > 0;
+
+  // Matrix-free operators and the Chebyshev preconditioner also require the "native" iterative solvers
+  bool const chebyshev = params.preconditionerType == LinearSolverParameters::PreconditionerType::chebyshev;
+  GEOSX_ERROR_IF( m_systemOperator && params.solverType == LinearSolverParameters::SolverType::direct,
+                  getName() << ": a matrix-free system operator requires an iterative linear solver" );
+
+  // Pipelined CG and CGS2 orthogonalization in GMRES are only provided by the "native" iterative solvers
+  bool const nativeKrylov = params.solverType == LinearSolverParameters::SolverType::pipecg ||
+                            ( params.solverType == LinearSolverParameters::SolverType::gmres &&
+                              params.krylov.orthogonalization == LinearSolverParameters::Krylov::Orthogonalization::cgs2 );
+
+  if( params.solverType == LinearSolverParameters::SolverType::direct ||
+      ( !m_precond && !reusePrecond && !m_systemOperator && !chebyshev && !nativeKrylov ) )
   {
     LinearSolver solver( params );
     solver.solve( matrix, solution, rhs, &dofManager );
@@ -792,10 +824,39 @@ void SolverBase::SolveSystem( DofManager const & dofManager,
   }
   else
   {
-    m_precond->compute( matrix, dofManager );
-    std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::Create( params, matrix, *m_precond );
-    solver->solve( rhs, solution );
-    m_linearSolverResult = solver->result();
+    if( !m_precond )
+    {
+      if( chebyshev )
+      {
+        m_precond = std::make_unique< PreconditionerChebyshev< LAInterface > >( params.chebyshev, m_systemOperator.get() );
+      }
+      else
+      {
+        m_precond = LAInterface::createPreconditioner( params );
+      }
+    }
+
+    LinearOperator< ParallelVector > const & systemOperator = m_systemOperator ? *m_systemOperator : matrix;
+    bool const precondComputed = SetupPreconditioner( dofManager, matrix, false );
+    KrylovSolver< ParallelVector > & solver = GetKrylovSolver( params, systemOperator );
+    solver.solve( rhs, solution );
+    m_linearSolverResult = solver.result();
+
+    // A failure with a reused preconditioner is not conclusive: solve again with an up-to-date one
+    if( !m_linearSolverResult.success() && !precondComputed )
+    {
+      GEOSX_LOG_LEVEL_RANK_0( 1, getName() << ": linear solve failed with a reused preconditioner, recomputing it" );
+      SetupPreconditioner( dofManager, matrix, true );
+      solution.zero();
+      solver.solve( rhs, solution );
+      m_linearSolverResult = solver.result();
+    }
+
+    ++m_precondNumSolves;
+    if( m_precondNumSolves == 1 )
+    {
+      m_precondSetupIterations = m_linearSolverResult.numIterations;
+    }
   }
 
   //  Keep for debugging comparisons
@@ -817,6 +878,91 @@ void SolverBase::SolveSystem( DofManager const & dofManager,
   }
 }
 
+bool SolverBase::SetupPreconditioner( DofManager const & dofManager,
+                                      ParallelMatrix const & matrix,
+                                      bool const forceSetup )
+{
+  LinearSolverParameters::PrecondReuse const & reuse = m_linearSolverParameters.get().precondReuse;
+
+  if( reuse.maxReuse <= 0 )
+  {
+    m_precond->compute( matrix, dofManager );
+    m_precondNumSolves = 0;
+    return true;
+  }
+
+  // The preconditioner refers to the matrix it was computed from: it can only be kept while this matrix
+  // object keeps its storage, i.e. while only the values are updated in place
+  bool const sameStorage = m_precond->ready() &&
+                           &m_precond->matrix() == &matrix &&
+                           m_precondStructureVersion == matrix.structureVersion();
+
+  bool const fullSetup = forceSetup ||
+                         !sameStorage ||
+                         !m_linearSolverResult.success() ||
+                         m_linearSolverResult.numIterations > reuse.iterFactor * m_precondSetupIterations;
+
+  if( fullSetup )
+  {
+    m_precond->compute( matrix, dofManager );
+  }
+  else if( m_precondNumSolves > reuse.maxReuse )
+  {
+    if( reuse.refreshValues )
+    {
+      m_precond->recompute( matrix, dofManager );
+    }
+    else
+    {
+      m_precond->compute( matrix, dofManager );
+    }
+  }
+  else
+  {
+    return false;
+  }
+
+  m_precondStructureVersion = matrix.structureVersion();
+  m_precondNumSolves = 0;
+  return true;
+}
+
+void SolverBase::CreateParallelMatrix()
+{
+  if( m_precond && m_precond->ready() && &m_precond->matrix() == &m_matrix &&
+      !m_matrix.hasLocalMatrixStructure( m_localMatrix.toViewConst(), MPI_COMM_GEOSX ) )
+  {
+    m_precond->clear();
+  }
+  m_matrix.create( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
+}
+
+KrylovSolver< ParallelVector > & SolverBase::GetKrylovSolver( LinearSolverParameters const & params,
+                                                              LinearOperator< ParallelVector > const & op )
+{
+  LinearSolverParameters const & last = m_krylovSolverParameters;
+  bool const reuseSolver = m_krylovSolver &&
+                           &m_krylovSolver->getOperator() == &op &&
+                           &m_krylovSolver->getPreconditioner() == m_precond.get() &&
+                           last.solverType == params.solverType &&
+                           last.isSymmetric == params.isSymmetric &&
+                           last.logLevel == params.logLevel &&
+                           last.krylov.maxIterations == params.krylov.maxIterations &&
+                           last.krylov.maxRestart == params.krylov.maxRestart &&
+                           last.krylov.orthogonalization == params.krylov.orthogonalization;
+
+  if( reuseSolver )
+  {
+    m_krylovSolver->setTolerance( params.krylov.relTolerance );
+  }
+  else
+  {
+    m_krylovSolver = KrylovSolver< ParallelVector >::Create( params, op, *m_precond );
+    m_krylovSolverParameters = params;
+  }
+  return *m_krylovSolver;
+}
+
 bool SolverBase::CheckSystemSolution( DomainPartition const & GEOSX_UNUSED_PARAM( domain ),
                                       DofManager const & GEOSX_UNUSED_PARAM( dofManager ),
                                       arrayView1d< real64 const > const & GEOSX_UNUSED_PARAM( localSolution ),
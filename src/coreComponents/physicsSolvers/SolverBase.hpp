@@ -19,6 +19,7 @@
 #include "common/DataTypes.hpp"
 #include "dataRepository/ExecutableGroup.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
 #include "linearAlgebra/utilities/LinearSolverResult.hpp"
 #include "linearAlgebra/DofManager.hpp"
 #include "managers/DomainPartition.hpp"
@@ -87,6 +88,12 @@ public:
   ParallelVector & getSystemSolution() { return m_solution; }
   ParallelVector const & getSystemSolution() const { return m_solution; }
 
+  /**
+   * @brief Getter for the operator applied in place of the system matrix
+   * @return a pointer to the matrix-free operator of this solver, or nullptr if the system matrix is assembled
+   */
+  LinearOperator< ParallelVector > const * getSystemOperator() const { return m_systemOperator.get(); }
+
   /**
    * @brief Getter for degree-of-freedom manager
    * @return a reference to degree-of-freedom manager of this solver
@@ -299,6 +306,19 @@ public:
                array1d< real64 > & localSolution,
                bool const setSparsity = true );
 
+  /**
+   * @brief Set up the solver's own linear system, unless the current setup is still valid
+   * @param domain the domain containing the mesh and fields
+   * @return true if the linear system has been set up, false if the previous setup was reused
+   *
+   * The DOF numbering, the sparsity pattern and the sizes of the linear system only depend on the
+   * mesh topology. They are therefore kept across time steps and rebuilt only when the topology
+   * version of the mesh (see MeshLevel::topologyVersion()) differs from the one used for the
+   * previous setup, e.g. after fracture propagation or ghost rebuilding. Only the setups done through
+   * this function are tracked: a direct call to SetupSystem does not record the topology version.
+   */
+  bool SetupSystemIfTopologyChanged( DomainPartition & domain );
+
   /**
    * @brief function to assemble the linear system matrix and rhs
    * @param time the time at the beginning of the step
@@ -711,6 +731,9 @@ protected:
   /// Data structure to handle degrees of freedom
   DofManager m_dofManager;
 
+  /// Topology version of the mesh used for the last setup of the linear system (-1 if never set up)
+  localIndex m_systemSetupTopologyVersion;
+
   /// System matrix, rhs and solution
   ParallelMatrix m_matrix;
   ParallelVector m_rhs;
@@ -721,9 +744,27 @@ protected:
   array1d< real64 > m_localRhs;
   array1d< real64 > m_localSolution;
 
+  /// Operator applied by the "native" iterative solver in place of the system matrix (matrix-free solvers only)
+  std::unique_ptr< LinearOperator< ParallelVector > > m_systemOperator;
+
   /// Custom preconditioner for the "native" iterative solver
   std::unique_ptr< PreconditionerBase< LAInterface > > m_precond;
 
+  /// Storage version (see MatrixBase::structureVersion()) of the matrix the preconditioner was computed from
+  integer m_precondStructureVersion;
+
+  /// Number of linear solves performed with the current preconditioner setup
+  integer m_precondNumSolves;
+
+  /// Number of Krylov iterations of the first solve after the last preconditioner setup
+  integer m_precondSetupIterations;
+
+  /// "Native" iterative solver, kept with its work vectors between solves
+  std::unique_ptr< KrylovSolver< ParallelVector > > m_krylovSolver;
+
+  /// Linear solver parameters the "native" iterative solver was created with
+  LinearSolverParameters m_krylovSolverParameters;
+
   /// Linear solver parameters
   LinearSolverParametersInput m_linearSolverParameters;
 
@@ -733,8 +774,47 @@ protected:
   /// Nonlinear solver parameters
   NonlinearSolverParameters m_nonlinearSolverParameters;
 
+  /**
+   * @brief Create the parallel system matrix from the local one
+   *
+   * A preconditioner computed from the matrix is released first when the sparsity pattern has changed,
+   * since some implementations must not outlive the matrix storage they were computed from.
+   */
+  void CreateParallelMatrix();
+
 private:
 
+  /**
+   * @brief Compute the preconditioner of the "native" iterative solver, or keep the previous one
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @param matrix the system matrix
+   * @param forceSetup whether to compute the preconditioner regardless of the reuse policy
+   * @return true if the preconditioner has been computed, false if the previous one is reused
+   *
+   * When preconditioner reuse is enabled in the linear solver parameters, the preconditioner is kept
+   * until it has been used for the allowed number of solves, the Krylov iteration count has grown
+   * beyond the allowed factor, the last solve failed or the matrix storage has been re-created.
+   * The preconditioner refers to @p matrix, whose values are updated in place while its sparsity
+   * pattern is unchanged: no copy of the matrix is kept. When only the number of solves is
+   * exceeded and values-only refresh is enabled, the preconditioner is refreshed with
+   * PreconditionerBase::recompute() rather than computed again.
+   */
+  bool SetupPreconditioner( DofManager const & dofManager,
+                            ParallelMatrix const & matrix,
+                            bool const forceSetup );
+
+  /**
+   * @brief Get the "native" iterative solver, creating it if needed
+   * @param params the linear solver parameters
+   * @param op the system operator, either the matrix or a matrix-free operator
+   * @return the solver, set up with the tolerance of @p params
+   *
+   * The solver is only created again when the operator or preconditioner objects, or the parameters
+   * other than the tolerance, have changed, so that repeated solves reuse its work vectors.
+   */
+  KrylovSolver< ParallelVector > & GetKrylovSolver( LinearSolverParameters const & params,
+                                                    LinearOperator< ParallelVector > const & op );
+
   /// List of names of regions the solver will be applied to
   array1d< string > m_targetRegionNames;
 
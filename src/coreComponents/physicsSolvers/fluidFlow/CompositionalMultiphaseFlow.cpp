@@ -439,13 +439,13 @@ void CompositionalMultiphaseFlow::UpdateFluidModel( Group & dataGroup, localInde
   {
     typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
 
-    // MultiFluid models are not thread-safe or device-capable yet
-    FluidUpdateKernel::Launch< serialPolicy >( dataGroup.size(),
-                                               fluidWrapper,
-                                               pres,
-                                               dPres,
-                                               m_temperature,
-                                               compFrac );
+    // MultiFluid models are thread-safe on the host but not device-capable yet
+    FluidUpdateKernel::Launch< parallelHostPolicy >( dataGroup.size(),
+                                                     fluidWrapper,
+                                                     pres,
+                                                     dPres,
+                                                     m_temperature,
+                                                     compFrac );
   } );
 }
 
@@ -590,7 +590,8 @@ real64 CompositionalMultiphaseFlow::SolverStep( real64 const & time_n,
 
   real64 dt_return;
 
-  SetupSystem( domain, m_dofManager, m_localMatrix, m_localRhs, m_localSolution );
+  // setup dof numbers and linear system (reused until the mesh topology changes)
+  SetupSystemIfTopologyChanged( domain );
 
   ImplicitStepSetup( time_n, dt, domain );
 
@@ -686,6 +687,32 @@ void CompositionalMultiphaseFlow::SetupDofs( DomainPartition const & domain,
   dofManager.addCoupling( viewKeyStruct::dofFieldString, fluxApprox );
 }
 
+void CompositionalMultiphaseFlow::SetupSystem( DomainPartition & domain,
+                                               DofManager & dofManager,
+                                               CRSMatrix< real64, globalIndex > & localMatrix,
+                                               array1d< real64 > & localRhs,
+                                               array1d< real64 > & localSolution,
+                                               bool const setSparsity )
+{
+  GEOSX_MARK_FUNCTION;
+
+  SolverBase::SetupSystem( domain,
+                           dofManager,
+                           localMatrix,
+                           localRhs,
+                           localSolution,
+                           setSparsity );
+
+  if( setSparsity )
+  {
+    ComputeCellStencilAssemblyMap( domain,
+                                   dofManager,
+                                   viewKeyStruct::dofFieldString,
+                                   m_numDofPerCell,
+                                   localMatrix.toViewConst() );
+  }
+}
+
 void CompositionalMultiphaseFlow::AssembleSystem( real64 const GEOSX_UNUSED_PARAM( time_n ),
                                                   real64 const dt,
                                                   DomainPartition & domain,
@@ -846,11 +873,17 @@ void CompositionalMultiphaseFlow::AssembleFluxTerms( real64 const dt,
   elemDofNumber = mesh.getElemManager()->ConstructArrayViewAccessor< globalIndex, 1 >( dofKey );
   elemDofNumber.setName( getName() + "/accessors/" + dofKey );
 
+  // TODO: the flux kernel reads every cell field through the [er][esr][ei] accessors.
+  //       Flat, globally cell-indexed storage of the solver fields, with stencils holding flat cell ids,
+  //       needs the fields to be owned by the solver rather than by the subregion wrappers that output,
+  //       restart, boundary conditions and ghost synchronization use. Gathering copies of the fields
+  //       before each assembly is not an option: it costs a pass over the largest derived fields.
   fluxApprox.forAllStencils( mesh, [&] ( auto const & stencil )
   {
     KernelLaunchSelector1< FluxKernel >( m_numComponents,
                                          m_numPhases,
                                          stencil,
+                                         stencil.hasAssemblyMap( dofKey ),
                                          dofManager.rankOffset(),
                                          elemDofNumber.toNestedViewConst(),
                                          m_elemGhostRank.toNestedViewConst(),
@@ -1114,12 +1147,12 @@ void CompositionalMultiphaseFlow::ApplyDirichletBC( real64 const time,
     {
       typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
 
-      // MultiFluid models are not thread-safe or device-capable yet
-      FluidUpdateKernel::Launch< serialPolicy >( targetSet,
-                                                 fluidWrapper,
-                                                 bcPres,
-                                                 m_temperature,
-                                                 compFrac );
+      // MultiFluid models are thread-safe on the host but not device-capable yet
+      FluidUpdateKernel::Launch< parallelHostPolicy >( targetSet,
+                                                       fluidWrapper,
+                                                       bcPres,
+                                                       m_temperature,
+                                                       compFrac );
     } );
 
     forAll< parallelDevicePolicy<> >( targetSet.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
@@ -113,6 +113,14 @@ public:
   SetupDofs( DomainPartition const & domain,
              DofManager & dofManager ) const override;
 
+  virtual void
+  SetupSystem( DomainPartition & domain,
+               DofManager & dofManager,
+               CRSMatrix< real64, globalIndex > & localMatrix,
+               array1d< real64 > & localRhs,
+               array1d< real64 > & localSolution,
+               bool const setSparsity = true ) override;
+
   virtual void
   AssembleSystem( real64 const time_n,
                   real64 const dt,
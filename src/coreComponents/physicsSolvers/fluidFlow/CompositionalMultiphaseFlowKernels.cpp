@@ -20,6 +20,7 @@
 
 #include "finiteVolume/CellElementStencilTPFA.hpp"
 #include "finiteVolume/FaceElementStencil.hpp"
+#include "linearAlgebra/utilities/BlockRowAssembly.hpp"
 
 namespace geosx
 {
@@ -1009,6 +1010,7 @@ void
 FluxKernel::
   Launch( localIndex const numPhases,
           STENCIL_TYPE const & stencil,
+          bool const useAssemblyMap,
           globalIndex const rankOffset,
           ElementViewConst< arrayView1d< globalIndex const > > const & dofNumber,
           ElementViewConst< arrayView1d< integer const > > const & ghostRank,
@@ -1038,6 +1040,7 @@ FluxKernel::
   typename STENCIL_TYPE::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
   typename STENCIL_TYPE::IndexContainerViewConstType const & sei = stencil.getElementIndices();
   typename STENCIL_TYPE::WeightContainerViewConstType const & weights = stencil.getWeights();
+  arrayView3d< localIndex const > const & assemblyMap = stencil.getAssemblyMap();
 
   localIndex constexpr NUM_ELEMS   = STENCIL_TYPE::NUM_POINT_IN_FLUX;
   localIndex constexpr MAX_STENCIL = STENCIL_TYPE::MAX_STENCIL_SIZE;
@@ -1106,10 +1109,25 @@ FluxKernel::
         for( localIndex ic = 0; ic < NC; ++ic )
         {
           RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[localRow + ic], localFlux[i * NC + ic] );
-          localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow + ic,
-                                                                            dofColIndices,
-                                                                            localFluxJacobian[i * NC + ic].dataIfContiguous(),
-                                                                            stencilSize * NDOF );
+        }
+
+        // The component balance rows of the cell share their columns: locate them once for the block
+        // (the matrix storage stays scalar, only the column search is shared)
+        if( useAssemblyMap )
+        {
+          addToBlockRowAtPositions< parallelDeviceAtomic, NC, NDOF >( localMatrix,
+                                                                      localRow,
+                                                                      assemblyMap[iconn][i].dataIfContiguous(),
+                                                                      stencilSize,
+                                                                      localFluxJacobian[i * NC].dataIfContiguous() );
+        }
+        else
+        {
+          addToBlockRowBinarySearchUnsorted< parallelDeviceAtomic, NC, MAX_STENCIL * NDOF >( localMatrix,
+                                                                                             localRow,
+                                                                                             dofColIndices,
+                                                                                             localFluxJacobian[i * NC].dataIfContiguous(),
+                                                                                             stencilSize * NDOF );
         }
       }
     }
@@ -1121,6 +1139,7 @@ FluxKernel::
   void FluxKernel:: \
     Launch< NC, STENCIL_TYPE >( localIndex const numPhases, \
                                 STENCIL_TYPE const & stencil, \
+                                bool const useAssemblyMap, \
                                 globalIndex const rankOffset, \
                                 ElementViewConst< arrayView1d< globalIndex const > > const & dofNumber, \
                                 ElementViewConst< arrayView1d< integer const > > const & ghostRank, \
@@ -446,6 +446,7 @@ struct FluxKernel
   static void
   Launch( localIndex const numPhases,
           STENCIL_TYPE const & stencil,
+          bool const useAssemblyMap,
           globalIndex const rankOffset,
           ElementViewConst< arrayView1d< globalIndex const > > const & dofNumber,
           ElementViewConst< arrayView1d< integer const > > const & ghostRank,
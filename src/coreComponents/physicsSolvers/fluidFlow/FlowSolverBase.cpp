@@ -18,6 +18,7 @@
 
 #include "FlowSolverBase.hpp"
 
+#include "common/TimingMacros.hpp"
 #include "finiteVolume/FiniteVolumeManager.hpp"
 #include "finiteVolume/FluxApproximationBase.hpp"
 #include "managers/DomainPartition.hpp"
@@ -280,6 +281,34 @@ void FlowSolverBase::ResetViews( MeshLevel & mesh )
 #endif
 }
 
+void FlowSolverBase::ComputeCellStencilAssemblyMap( DomainPartition & domain,
+                                                    DofManager const & dofManager,
+                                                    string const & fieldName,
+                                                    localIndex const numDofPerCell,
+                                                    CRSMatrixView< real64 const, globalIndex const > const & localMatrix ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_discretizationName );
+
+  string const & dofKey = dofManager.getKey( fieldName );
+  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > >
+  elemDofNumber = mesh.getElemManager()->ConstructArrayViewAccessor< globalIndex, 1 >( dofKey );
+  elemDofNumber.setName( getName() + "/accessors/" + dofKey );
+
+  CellElementStencilTPFA & stencil =
+    fluxApprox.getStencil< CellElementStencilTPFA >( mesh, FluxApproximationBase::viewKeyStruct::cellStencilString );
+  stencil.computeAssemblyMap( dofKey,
+                              elemDofNumber.toNestedViewConst(),
+                              numDofPerCell,
+                              dofManager.rankOffset(),
+                              localMatrix );
+}
+
 std::vector< string > FlowSolverBase::getConstitutiveRelations( string const & regionName ) const
 {
 
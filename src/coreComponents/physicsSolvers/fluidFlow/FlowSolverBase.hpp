@@ -117,6 +117,25 @@ public:
   virtual void ResetViews( MeshLevel & mesh );
 
 
+  /**
+   * @brief Compute the assembly map of the cell stencil of the discretization for a linear system.
+   * @param domain the domain partition
+   * @param dofManager the degree-of-freedom manager of the system
+   * @param fieldName the name of the cell-centered degree-of-freedom field
+   * @param numDofPerCell the number of degrees of freedom of each cell
+   * @param localMatrix the local matrix of the system, with its final sparsity pattern
+   *
+   * The map lets the flux kernels add their contributions to the matrix without searching the
+   * columns in each row (see StencilBase::computeAssemblyMap). It must be computed after each
+   * setup of the linear system. The fracture stencils, which change when fractures propagate,
+   * are assembled with column searches.
+   */
+  void ComputeCellStencilAssemblyMap( DomainPartition & domain,
+                                      DofManager const & dofManager,
+                                      string const & fieldName,
+                                      localIndex const numDofPerCell,
+                                      CRSMatrixView< real64 const, globalIndex const > const & localMatrix ) const;
+
   std::unique_ptr< CRSMatrix< real64, localIndex > > & getRefDerivativeFluxResidual_dAperture()
   {
     return m_derivativeFluxResidual_dAperture;
@@ -295,8 +295,8 @@ real64 SinglePhaseBase::SolverStep( real64 const & time_n,
 
   real64 dt_return;
 
-  // setup dof numbers and linear system
-  SetupSystem( domain, m_dofManager, m_localMatrix, m_localRhs, m_localSolution );
+  // setup dof numbers and linear system (reused until the mesh topology changes)
+  SetupSystemIfTopologyChanged( domain );
 
   ImplicitStepSetup( time_n, dt, domain );
 
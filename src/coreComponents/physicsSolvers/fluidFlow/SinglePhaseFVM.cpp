@@ -80,6 +80,15 @@ void SinglePhaseFVM< BASE >::SetupSystem( DomainPartition & domain,
                      localSolution,
                      setSparsity );
 
+  if( setSparsity )
+  {
+    this->ComputeCellStencilAssemblyMap( domain,
+                                         dofManager,
+                                         viewKeyStruct::pressureString,
+                                         1,
+                                         localMatrix.toViewConst() );
+  }
+
   MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
 
   std::unique_ptr< CRSMatrix< real64, localIndex > > &
@@ -236,6 +245,7 @@ void SinglePhaseFVM< BASE >::AssembleFluxTerms( real64 const GEOSX_UNUSED_PARAM(
   fluxApprox.forAllStencils( mesh, [&]( auto const & stencil )
   {
     FluxKernel::Launch( stencil,
+                        stencil.hasAssemblyMap( dofKey ),
                         dt,
                         dofManager.rankOffset(),
                         elemDofNumber.toNestedViewConst(),
@@ -18,6 +18,8 @@
 
 #include "SinglePhaseFVMKernels.hpp"
 
+#include "linearAlgebra/utilities/BlockRowAssembly.hpp"
+
 namespace geosx
 {
 
@@ -360,6 +362,7 @@ FluxKernel::ComputeJunction( localIndex const numFluxElems,
 template<>
 void FluxKernel::
   Launch< CellElementStencilTPFA >( CellElementStencilTPFA const & stencil,
+                                    bool const useAssemblyMap,
                                     real64 const dt,
                                     globalIndex const rankOffset,
                                     ElementViewConst< arrayView1d< globalIndex > > const & dofNumber,
@@ -393,6 +396,7 @@ void FluxKernel::
   typename CellElementStencilTPFA::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
   typename CellElementStencilTPFA::IndexContainerViewConstType const & sei = stencil.getElementIndices();
   typename CellElementStencilTPFA::WeightContainerViewConstType const & weights = stencil.getWeights();
+  arrayView3d< localIndex const > const & assemblyMap = stencil.getAssemblyMap();
 
   forAll< parallelDevicePolicy<> >( stencil.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
   {
@@ -433,10 +437,21 @@ void FluxKernel::
         GEOSX_ASSERT_GT( localMatrix.numRows(), localRow );
 
         RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[localRow], localFlux[i] );
-        localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow,
-                                                                          dofColIndices.data(),
-                                                                          localFluxJacobian[i].dataIfContiguous(),
-                                                                          stencilSize );
+        if( useAssemblyMap )
+        {
+          addToBlockRowAtPositions< parallelDeviceAtomic, 1, 1 >( localMatrix,
+                                                                  localRow,
+                                                                  assemblyMap[iconn][i].dataIfContiguous(),
+                                                                  stencilSize,
+                                                                  localFluxJacobian[i].dataIfContiguous() );
+        }
+        else
+        {
+          localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow,
+                                                                            dofColIndices.data(),
+                                                                            localFluxJacobian[i].dataIfContiguous(),
+                                                                            stencilSize );
+        }
       }
     }
   } );
@@ -445,6 +460,7 @@ void FluxKernel::
 template<>
 void FluxKernel::
   Launch< FaceElementStencil >( FaceElementStencil const & stencil,
+                                bool const GEOSX_UNUSED_PARAM( useAssemblyMap ),
                                 real64 const dt,
                                 globalIndex const rankOffset,
                                 ElementViewConst< arrayView1d< globalIndex const > > const & dofNumber,
@@ -138,6 +138,7 @@ struct FluxKernel
    * @brief launches the kernel to assemble the flux contributions to the linear system.
    * @tparam STENCIL_TYPE The type of the stencil that is being used.
    * @param[in] stencil The stencil object.
+   * @param[in] useAssemblyMap Whether the assembly map of the stencil is valid for @p localMatrix
    * @param[in] dt The timestep for the integration step.
    * @param[in] dofNumber The dofNumbers for each element
    * @param[in] pres The pressures in each element
@@ -153,6 +154,7 @@ struct FluxKernel
   template< typename STENCIL_TYPE >
   static void
     Launch( STENCIL_TYPE const & stencil,
+            bool const useAssemblyMap,
             real64 const dt,
             globalIndex const rankOffset,
             ElementViewConst< arrayView1d< globalIndex const > > const & dofNumber,
@@ -640,11 +640,7 @@ protected:
 
     DomainPartition & domain = *problemManager->getDomainPartition();
 
-    solver->SetupSystem( domain,
-                         solver->getDofManager(),
-                         solver->getLocalMatrix(),
-                         solver->getLocalRhs(),
-                         solver->getLocalSolution() );
+    solver->SetupSystemIfTopologyChanged( domain );
 
     solver->ImplicitStepSetup( time, dt, domain );
   }
@@ -743,6 +739,29 @@ TEST_F( CompositionalMultiphaseFlowTest, jacobianNumericalCheck_volumeBalance )
   } );
 }
 
+TEST_F( CompositionalMultiphaseFlowTest, setupSystemOnlyAfterTopologyChange )
+{
+  DomainPartition & domain = *problemManager->getDomainPartition();
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  DofManager const & dofManager = solver->getDofManager();
+
+  // The fixture has already set up the system for the current topology
+  EXPECT_FALSE( solver->SetupSystemIfTopologyChanged( domain ) );
+
+  // The step setup leaves the linear system alone, so that the next step reuses it
+  solver->ImplicitStepSetup( time, dt, domain );
+  EXPECT_FALSE( solver->SetupSystemIfTopologyChanged( domain ) );
+
+  // A topology change invalidates the setup, which the start of the next SolverStep rebuilds once
+  mesh.incrementTopologyVersion();
+  EXPECT_TRUE( solver->SetupSystemIfTopologyChanged( domain ) );
+  EXPECT_FALSE( solver->SetupSystemIfTopologyChanged( domain ) );
+
+  EXPECT_EQ( solver->getLocalMatrix().numRows(), dofManager.numLocalDofs() );
+  EXPECT_EQ( solver->getLocalMatrix().numColumns(), dofManager.numGlobalDofs() );
+  EXPECT_EQ( solver->getLocalRhs().size(), dofManager.numLocalDofs() );
+}
+
 int main( int argc, char * * argv )
 {
   ::testing::InitGoogleTest( &argc, argv );
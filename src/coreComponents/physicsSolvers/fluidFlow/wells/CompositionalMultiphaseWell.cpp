@@ -349,12 +349,12 @@ void CompositionalMultiphaseWell::UpdateFluidModel( WellElementSubRegion & subRe
   {
     typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
 
-    CompositionalMultiphaseFlowKernels::FluidUpdateKernel::Launch< serialPolicy >( subRegion.size(),
-                                                                                   fluidWrapper,
-                                                                                   pres,
-                                                                                   dPres,
-                                                                                   m_temperature,
-                                                                                   compFrac );
+    CompositionalMultiphaseFlowKernels::FluidUpdateKernel::Launch< parallelHostPolicy >( subRegion.size(),
+                                                                                         fluidWrapper,
+                                                                                         pres,
+                                                                                         dPres,
+                                                                                         m_temperature,
+                                                                                         compFrac );
   } );
 }
 
@@ -484,11 +484,11 @@ void CompositionalMultiphaseWell::InitializeWells( DomainPartition & domain )
     {
       typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
 
-      CompositionalMultiphaseFlowKernels::FluidUpdateKernel::Launch< serialPolicy >( subRegion.size(),
-                                                                                     fluidWrapper,
-                                                                                     wellElemPressure,
-                                                                                     m_temperature,
-                                                                                     wellElemCompFrac );
+      CompositionalMultiphaseFlowKernels::FluidUpdateKernel::Launch< parallelHostPolicy >( subRegion.size(),
+                                                                                           fluidWrapper,
+                                                                                           wellElemPressure,
+                                                                                           m_temperature,
+                                                                                           wellElemCompFrac );
     } );
 
     CompDensInitializationKernel::Launch< parallelDevicePolicy<> >( subRegion.size(),
@@ -107,8 +107,8 @@ real64 ReservoirSolverBase::SolverStep( real64 const & time_n,
 
   real64 dt_return = dt;
 
-  // setup the coupled linear system
-  SetupSystem( domain, m_dofManager, m_localMatrix, m_localRhs, m_localSolution );
+  // setup the coupled linear system (reused until the mesh topology changes)
+  SetupSystemIfTopologyChanged( domain );
 
   // setup reservoir and well systems
   ImplicitStepSetup( time_n, dt, domain );
@@ -255,6 +255,13 @@ void ReservoirSolverBase::SetupSystem( DomainPartition & domain,
   localMatrix.setName( this->getName() + "/localMatrix" );
   localRhs.setName( this->getName() + "/localRhs" );
   localSolution.setName( this->getName() + "/localSolution" );
+
+  // Locate the reservoir flux connections in the coupled matrix
+  m_flowSolver->ComputeCellStencilAssemblyMap( domain,
+                                               dofManager,
+                                               m_wellSolver->ResElementDofName(),
+                                               m_wellSolver->NumDofPerResElement(),
+                                               localMatrix.toViewConst() );
 }
 
 
@@ -23,7 +23,9 @@
 #include "mpiCommunications/CommunicationTools.hpp"
 #include "common/TimingMacros.hpp"
 #include "common/DataTypes.hpp"
+#include "finiteElement/FiniteElementDiscretization.hpp"
 #include "finiteElement/FiniteElementDiscretizationManager.hpp"
+#include "managers/NumericalMethodsManager.hpp"
 #include "managers/DomainPartition.hpp"
 
 namespace geosx
@@ -76,6 +78,21 @@ void LaplaceFEM::RegisterDataOnMesh( Group * const MeshBodies )
 }
 //END_SPHINX_INCLUDE_02
 
+void LaplaceFEM::InitializePreSubGroups( Group * const rootGroup )
+{
+  SolverBase::InitializePreSubGroups( rootGroup );
+
+  DomainPartition const & domain = *rootGroup->GetGroup< DomainPartition >( keys::domain );
+  FiniteElementDiscretizationManager const &
+  feDiscretizationManager = domain.getNumericalMethodManager().getFiniteElementDiscretizationManager();
+
+  FiniteElementDiscretization const *
+    feDiscretization = feDiscretizationManager.GetGroup< FiniteElementDiscretization >( m_discretizationName );
+  GEOSX_ERROR_IF( feDiscretization == nullptr, getName() << ": FE discretization not found: " << m_discretizationName );
+  GEOSX_ERROR_IF( feDiscretization->isUniformStrain(),
+                  getName() << ": the UniformStrain formulation of " << m_discretizationName << " is not supported by this solver" );
+}
+
 real64 LaplaceFEM::SolverStep( real64 const & time_n,
                                real64 const & dt,
                                const int cycleNumber,
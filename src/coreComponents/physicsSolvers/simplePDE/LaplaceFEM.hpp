@@ -39,6 +39,8 @@ public:
 
   virtual void RegisterDataOnMesh( Group * const MeshBodies ) override final;
 
+  virtual void InitializePreSubGroups( Group * const rootGroup ) override final;
+
 //END_SPHINX_INCLUDE_02
 /**
  * @defgroup Solver Interface Functions
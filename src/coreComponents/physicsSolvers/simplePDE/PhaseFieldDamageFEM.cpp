@@ -169,6 +169,21 @@ void PhaseFieldDamageFEM::PostProcessInput()
   // m_linearSolverParameters.amg.coarseType = "direct";
 }
 
+void PhaseFieldDamageFEM::InitializePreSubGroups( Group * const rootGroup )
+{
+  SolverBase::InitializePreSubGroups( rootGroup );
+
+  DomainPartition const & domain = *rootGroup->GetGroup< DomainPartition >( keys::domain );
+  FiniteElementDiscretizationManager const &
+  feDiscretizationManager = domain.getNumericalMethodManager().getFiniteElementDiscretizationManager();
+
+  FiniteElementDiscretization const *
+    feDiscretization = feDiscretizationManager.GetGroup< FiniteElementDiscretization >( m_discretizationName );
+  GEOSX_ERROR_IF( feDiscretization == nullptr, getName() << ": FE discretization not found: " << m_discretizationName );
+  GEOSX_ERROR_IF( feDiscretization->isUniformStrain(),
+                  getName() << ": the UniformStrain formulation of " << m_discretizationName << " is not supported by this solver" );
+}
+
 real64 PhaseFieldDamageFEM::SolverStep( real64 const & time_n,
                                         real64 const & dt,
                                         const int cycleNumber,
@@ -173,6 +173,8 @@ public:
 protected:
   virtual void PostProcessInput() override final;
 
+  virtual void InitializePreSubGroups( Group * const rootGroup ) override final;
+
 private:
   string m_fieldName;
   stabledt m_stabledt;
@@ -83,7 +83,11 @@ public:
                         FE_TYPE const & finiteElementSpace,
                         CONSTITUTIVE_TYPE * const inputConstitutiveType,
                         real64 const dt,
-                        string const & elementListName ):
+                        string const & elementListName,
+                        string const & elementColorsName,
+                        real64 const hourglassDampingCoefficient,
+                        real64 const hourglassStiffnessCoefficient,
+                        string const & hourglassForceName ):
     Base( nodeManager,
           edgeManager,
           faceManager,
@@ -91,7 +95,11 @@ public:
           finiteElementSpace,
           inputConstitutiveType,
           dt,
-          elementListName )
+          elementListName,
+          elementColorsName,
+          hourglassDampingCoefficient,
+          hourglassStiffnessCoefficient,
+          hourglassForceName )
   {}
 
 
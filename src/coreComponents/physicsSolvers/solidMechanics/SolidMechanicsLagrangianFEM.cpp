@@ -17,7 +17,9 @@
  */
 
 #include "SolidMechanicsLagrangianFEM.hpp"
+#include "SolidMechanicsMatrixFreeOperator.hpp"
 #include "SolidMechanicsPoroElasticKernel.hpp"
+#include "SolidMechanicsSmallStrainMatrixFreeKernel.hpp"
 #include "SolidMechanicsSmallStrainQuasiStaticKernel.hpp"
 #include "SolidMechanicsSmallStrainImplicitNewmarkKernel.hpp"
 #include "SolidMechanicsSmallStrainExplicitNewmarkKernel.hpp"
@@ -53,6 +55,9 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const std::string & na
   m_massDamping( 0.0 ),
   m_stiffnessDamping( 0.0 ),
   m_timeIntegrationOption( TimeIntegrationOption::ExplicitDynamic ),
+  m_explicitAssemblyOption( ExplicitAssemblyOption::Atomic ),
+  m_hourglassDamping( 0.1 ),
+  m_hourglassStiffness( 0.05 ),
   m_useVelocityEstimateForQS( 0 ),
   m_maxForce( 0.0 ),
   m_maxNumResolves( 10 ),
@@ -61,7 +66,7 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const std::string & na
 //  m_elemsNotAttachedToSendOrReceiveNodes(),
   m_sendOrReceiveNodes(),
   m_nonSendOrReceiveNodes(),
-  m_iComm(),
+  m_explicitSyncPlan(),
   m_effectiveStress( 0 )
 {
   m_sendOrReceiveNodes.setName( "SolidMechanicsLagrangianFEM::m_sendOrReceiveNodes" );
@@ -93,6 +98,24 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const std::string & na
     setApplyDefaultValue( m_timeIntegrationOption )->
     setDescription( "Time integration method. Options are:\n* " + EnumStrings< TimeIntegrationOption >::concat( "\n* " ) );
 
+  registerWrapper( viewKeyStruct::explicitAssemblyOptionString, &m_explicitAssemblyOption )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( m_explicitAssemblyOption )->
+    setDescription( "Assembly method of the nodal forces for the ExplicitDynamic time integration option. Options are:\n* " +
+                    EnumStrings< ExplicitAssemblyOption >::concat( "\n* " ) );
+
+  registerWrapper( viewKeyStruct::hourglassDampingString, &m_hourglassDamping )->
+    setApplyDefaultValue( 0.1 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Coefficient of the viscous hourglass control of the reduced integration elements (i.e. the "
+                    "UniformStrain formulation of the hexahedron) for the ExplicitDynamic time integration option." );
+
+  registerWrapper( viewKeyStruct::hourglassStiffnessString, &m_hourglassStiffness )->
+    setApplyDefaultValue( 0.05 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Coefficient of the stiffness hourglass control of the reduced integration elements (i.e. the "
+                    "UniformStrain formulation of the hexahedron) for the ExplicitDynamic time integration option." );
+
   registerWrapper( viewKeyStruct::useVelocityEstimateForQSString, &m_useVelocityEstimateForQS )->
     setApplyDefaultValue( 0 )->
     setInputFlag( InputFlags::OPTIONAL )->
@@ -146,6 +169,20 @@ void SolidMechanicsLagrangianFEM::PostProcessInput()
   linParams.isSymmetric = true;
   linParams.dofsPerNode = 3;
   linParams.amg.separateComponents = true;
+
+  if( linParams.matrixFree )
+  {
+    GEOSX_ERROR_IF( m_timeIntegrationOption != TimeIntegrationOption::QuasiStatic,
+                    getName() << ": the matrix-free operator is only available for quasi-static time integration" );
+    GEOSX_ERROR_IF( m_contactRelationName != viewKeyStruct::noContactRelationNameString,
+                    getName() << ": the matrix-free operator is not available with contact" );
+    GEOSX_ERROR_IF( linParams.solverType == LinearSolverParameters::SolverType::direct,
+                    getName() << ": the matrix-free operator requires an iterative linear solver" );
+    GEOSX_ERROR_IF( linParams.preconditionerType != LinearSolverParameters::PreconditionerType::none &&
+                    linParams.preconditionerType != LinearSolverParameters::PreconditionerType::jacobi &&
+                    linParams.preconditionerType != LinearSolverParameters::PreconditionerType::chebyshev,
+                    getName() << ": only the none, jacobi and chebyshev preconditioners are available with the matrix-free operator" );
+  }
 }
 
 SolidMechanicsLagrangianFEM::~SolidMechanicsLagrangianFEM()
@@ -172,6 +209,13 @@ void SolidMechanicsLagrangianFEM::RegisterDataOnMesh( Group * const MeshBodies )
       setDescription( "An array that holds the incremental displacements for the current time step on the nodes." )->
       reference().resizeDimension< 1 >( 3 );
 
+    nodes->registerWrapper< array2d< real64, nodes::INCR_DISPLACEMENT_PERM > >( SolidMechanicsMatrixFreeOperator::inputFieldString )->
+      setPlotLevel( PlotLevel::NOPLOT )->
+      setRestartFlags( RestartFlags::NO_WRITE )->
+      setRegisteringObjects( this->getName())->
+      setDescription( "An array that holds the nodal values of the vector the matrix-free stiffness operator is applied to." )->
+      reference().resizeDimension< 1 >( 3 );
+
     nodes->registerWrapper< array2d< real64, nodes::VELOCITY_PERM > >( keys::Velocity )->
       setPlotLevel( PlotLevel::LEVEL_0 )->
       setRegisteringObjects( this->getName())->
@@ -230,6 +274,14 @@ void SolidMechanicsLagrangianFEM::RegisterDataOnMesh( Group * const MeshBodies )
       subRegion.registerWrapper< SortedArray< localIndex > >( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodes )->
         setPlotLevel( PlotLevel::NOPLOT )->
         setRestartFlags( RestartFlags::NO_WRITE );
+
+      subRegion.registerWrapper< ArrayOfArrays< localIndex > >( viewKeyStruct::elemColorsAttachedToSendOrReceiveNodes )->
+        setPlotLevel( PlotLevel::NOPLOT )->
+        setRestartFlags( RestartFlags::NO_WRITE );
+
+      subRegion.registerWrapper< ArrayOfArrays< localIndex > >( viewKeyStruct::elemColorsNotAttachedToSendOrReceiveNodes )->
+        setPlotLevel( PlotLevel::NOPLOT )->
+        setRestartFlags( RestartFlags::NO_WRITE );
     } );
 
   }
@@ -257,10 +309,90 @@ void SolidMechanicsLagrangianFEM::InitializePreSubGroups( Group * const rootGrou
   FiniteElementDiscretization const *
     feDiscretization = feDiscretizationManager.GetGroup< FiniteElementDiscretization >( m_discretizationName );
   GEOSX_ERROR_IF( feDiscretization == nullptr, getName() << ": FE discretization not found: " << m_discretizationName );
+  GEOSX_ERROR_IF( feDiscretization->isUniformStrain() && m_timeIntegrationOption != TimeIntegrationOption::ExplicitDynamic,
+                  getName() << ": the UniformStrain formulation of " << m_discretizationName <<
+                  " has hourglass control only with explicit dynamics time integration" );
+
+  // The hourglass force is only used by the explicit kernels of the uniform strain elements
+  if( feDiscretization->isUniformStrain() )
+  {
+    for( auto & mesh : domain->getMeshBodies()->GetSubGroups() )
+    {
+      MeshLevel & meshLevel = *Group::group_cast< MeshBody * >( mesh.second )->getMeshLevel( 0 );
+      forTargetSubRegions< CellElementSubRegion >( meshLevel, [&]( localIndex const,
+                                                                   CellElementSubRegion & subRegion )
+      {
+        subRegion.registerWrapper< array3d< real64 > >( viewKeyStruct::hourglassForceString )->
+          setPlotLevel( PlotLevel::NOPLOT )->
+          setRegisteringObjects( this->getName())->
+          setDescription( "Array to hold the generalized stiffness hourglass force of the reduced integration elements" )->
+          reference().resizeDimension< 1, 2 >( 4, 3 );
+      } );
+    }
+  }
 }
 
 
 
+namespace
+{
+
+/**
+ * @brief Group the elements of a list by color, such that elements of the same color do not share any node.
+ * @param elemsToNodes the element to node map of the subregion
+ * @param numNodes the number of nodes in the mesh
+ * @param elementList the list of elements to color
+ * @param elementColors the elements of @p elementList, with one sub-array per color
+ *
+ * The greedy first-fit algorithm used here needs 8 colors on a structured hexahedral mesh.
+ */
+void colorElementList( arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemsToNodes,
+                       localIndex const numNodes,
+                       SortedArrayView< localIndex const > const & elementList,
+                       ArrayOfArrays< localIndex > & elementColors )
+{
+  // bit c of nodeColors[ a ] is set if an element of color c is attached to node a
+  std::vector< std::uint64_t > nodeColors( numNodes, 0 );
+  std::vector< std::vector< localIndex > > elementsOfColor;
+
+  localIndex const numNodesPerElem = elemsToNodes.size( 1 );
+  for( localIndex const k : elementList )
+  {
+    std::uint64_t usedColors = 0;
+    for( localIndex a = 0; a < numNodesPerElem; ++a )
+    {
+      usedColors |= nodeColors[ elemsToNodes( k, a ) ];
+    }
+
+    GEOSX_ERROR_IF( ~usedColors == 0, "More than 64 colors are needed to color the element list" );
+
+    int color = 0;
+    while( ( usedColors >> color ) & 1 )
+    {
+      ++color;
+    }
+
+    if( color >= static_cast< int >( elementsOfColor.size() ) )
+    {
+      elementsOfColor.resize( color + 1 );
+    }
+    elementsOfColor[ color ].emplace_back( k );
+
+    for( localIndex a = 0; a < numNodesPerElem; ++a )
+    {
+      nodeColors[ elemsToNodes( k, a ) ] |= std::uint64_t( 1 ) << color;
+    }
+  }
+
+  elementColors.resize( 0 );
+  for( std::vector< localIndex > const & elements : elementsOfColor )
+  {
+    elementColors.appendArray( elements.begin(), elements.end() );
+  }
+}
+
+} // namespace
+
 template< typename ... PARAMS >
 real64 SolidMechanicsLagrangianFEM::explicitKernelDispatch( PARAMS && ... params )
 {
@@ -451,6 +583,19 @@ void SolidMechanicsLagrangianFEM::InitializePostInitialConditions_PreSubGroups(
           }
         }
       } );
+
+      if( m_explicitAssemblyOption == ExplicitAssemblyOption::Colored )
+      {
+        colorElementList( elemsToNodes,
+                          nodes.size(),
+                          elemsAttachedToSendOrReceiveNodes.toViewConst(),
+                          elementSubRegion.getReference< ArrayOfArrays< localIndex > >( viewKeyStruct::elemColorsAttachedToSendOrReceiveNodes ) );
+
+        colorElementList( elemsToNodes,
+                          nodes.size(),
+                          elemsNotAttachedToSendOrReceiveNodes.toViewConst(),
+                          elementSubRegion.getReference< ArrayOfArrays< localIndex > >( viewKeyStruct::elemColorsNotAttachedToSendOrReceiveNodes ) );
+      }
     } );
   } );
 }
@@ -548,11 +693,16 @@ real64 SolidMechanicsLagrangianFEM::ExplicitStep( real64 const & time_n,
   arrayView2d< real64, nodes::INCR_DISPLACEMENT_USD > const & uhat = nodes.incrementalDisplacement();
   arrayView2d< real64, nodes::ACCELERATION_USD > const & acc = nodes.acceleration();
 
-  std::map< string, string_array > fieldNames;
-  fieldNames["node"].emplace_back( keys::Velocity );
-  fieldNames["node"].emplace_back( keys::Acceleration );
+  // the ghost lists and the synchronized fields only change with the topology, so the plan
+  // (buffer sizes and persistent requests) is rebuilt only when the mesh topology version changes
+  if( !m_explicitSyncPlan.isValid( mesh, domain.getNeighbors() ) )
+  {
+    std::map< string, string_array > fieldNames;
+    fieldNames["node"].emplace_back( keys::Velocity );
+    fieldNames["node"].emplace_back( keys::Acceleration );
 
-  CommunicationTools::SynchronizePackSendRecvSizes( fieldNames, &mesh, domain.getNeighbors(), m_iComm, true );
+    m_explicitSyncPlan.setup( fieldNames, mesh, domain.getNeighbors(), true );
+  }
 
   fsManager.ApplyFieldValue< parallelDevicePolicy< 1024 > >( time_n, &domain, "nodeManager", keys::Acceleration );
 
@@ -598,28 +748,36 @@ real64 SolidMechanicsLagrangianFEM::ExplicitStep( real64 const & time_n,
                           this->getDiscretizationName(),
                           m_solidMaterialNames,
                           dt,
-                          string( viewKeyStruct::elemsAttachedToSendOrReceiveNodes ) );
+                          string( viewKeyStruct::elemsAttachedToSendOrReceiveNodes ),
+                          string( viewKeyStruct::elemColorsAttachedToSendOrReceiveNodes ),
+                          m_hourglassDamping,
+                          m_hourglassStiffness,
+                          string( viewKeyStruct::hourglassForceString ) );
 
   // apply this over a set
   SolidMechanicsLagrangianFEMKernels::velocityUpdate( acc, mass, vel, dt / 2, m_sendOrReceiveNodes.toViewConst() );
 
   fsManager.ApplyFieldValue< parallelDevicePolicy< 1024 > >( time_n, &domain, "nodeManager", keys::Velocity );
 
-  CommunicationTools::SynchronizePackSendRecv( fieldNames, &mesh, domain.getNeighbors(), m_iComm, true );
+  m_explicitSyncPlan.packSendRecv( mesh, domain.getNeighbors() );
 
   explicitKernelDispatch( mesh,
                           targetRegionNames(),
                           this->getDiscretizationName(),
                           m_solidMaterialNames,
                           dt,
-                          string( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodes ) );
+                          string( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodes ),
+                          string( viewKeyStruct::elemColorsNotAttachedToSendOrReceiveNodes ),
+                          m_hourglassDamping,
+                          m_hourglassStiffness,
+                          string( viewKeyStruct::hourglassForceString ) );
 
   // apply this over a set
   SolidMechanicsLagrangianFEMKernels::velocityUpdate( acc, mass, vel, dt / 2, m_nonSendOrReceiveNodes.toViewConst() );
 
   fsManager.ApplyFieldValue< parallelDevicePolicy< 1024 > >( time_n, &domain, "nodeManager", keys::Velocity );
 
-  CommunicationTools::SynchronizeUnpack( &mesh, domain.getNeighbors(), m_iComm, true );
+  m_explicitSyncPlan.unpack( mesh, domain.getNeighbors() );
 
   return dt;
 }
@@ -634,9 +792,18 @@ void SolidMechanicsLagrangianFEM::ApplyDisplacementBC_implicit( real64 const tim
 {
   GEOSX_MARK_FUNCTION;
   string const dofKey = dofManager.getKey( keys::TotalDisplacement );
+  globalIndex const rankOffset = dofManager.rankOffset();
 
   FieldSpecificationManager const & fsManager = FieldSpecificationManager::get();
 
+  // The matrix-free operator needs to know which rows are reduced to their diagonal
+  bool const matrixFree = m_linearSolverParameters.get().matrixFree;
+  if( matrixFree )
+  {
+    m_constrainedDofs.setValues< serialPolicy >( 0 );
+  }
+  arrayView1d< integer > const & constrainedDofs = m_constrainedDofs;
+
   fsManager.Apply( time,
                    &domain,
                    "nodeManager",
@@ -647,13 +814,27 @@ void SolidMechanicsLagrangianFEM::ApplyDisplacementBC_implicit( real64 const tim
                         Group * const targetGroup,
                         string const fieldName )
   {
+    if( matrixFree )
+    {
+      arrayView1d< globalIndex const > const & dofNumber = targetGroup->getReference< globalIndex_array >( dofKey );
+      integer const component = bc->GetComponent();
+      for( localIndex i = 0; i < targetSet.size(); ++i )
+      {
+        globalIndex const localRow = dofNumber[ targetSet[ i ] ] + component - rankOffset;
+        if( component >= 0 && localRow >= 0 && localRow < constrainedDofs.size() )
+        {
+          constrainedDofs[ localRow ] = 1;
+        }
+      }
+    }
+
     bc->ApplyBoundaryConditionToSystem< FieldSpecificationEqual,
                                         parallelDevicePolicy< 32 > >( targetSet,
                                                                       time,
                                                                       targetGroup,
                                                                       fieldName,
                                                                       dofKey,
-                                                                      dofManager.rankOffset(),
+                                                                      rankOffset,
                                                                       localMatrix,
                                                                       localRhs );
   } );
@@ -945,6 +1126,29 @@ void SolidMechanicsLagrangianFEM::SetupSystem( DomainPartition & domain,
   arrayView1d< globalIndex const > const &
   dofNumber = nodeManager.getReference< globalIndex_array >( dofManager.getKey( keys::TotalDisplacement ) );
 
+  if( m_linearSolverParameters.get().matrixFree )
+  {
+    // Only the diagonal is assembled, the operator is applied element by element
+    SparsityPattern< globalIndex > diagonalPattern( dofManager.numLocalDofs(),
+                                                    dofManager.numGlobalDofs(),
+                                                    1 );
+    for( localIndex row = 0; row < dofManager.numLocalDofs(); ++row )
+    {
+      diagonalPattern.insertNonZero( row, dofManager.rankOffset() + row );
+    }
+    diagonalPattern.compress();
+    localMatrix.assimilate< parallelDevicePolicy<> >( std::move( diagonalPattern ) );
+
+    m_constrainedDofs.resize( dofManager.numLocalDofs() );
+    m_precond.reset();
+    m_systemOperator = std::make_unique< SolidMechanicsMatrixFreeOperator >( *this,
+                                                                             domain,
+                                                                             dofManager,
+                                                                             localMatrix.toViewConstSizes(),
+                                                                             m_constrainedDofs.toViewConst() );
+    return;
+  }
+
   SparsityPattern< globalIndex > sparsityPattern( dofManager.numLocalDofs(),
                                                   dofManager.numGlobalDofs(),
                                                   8*8*3*1.2 );
@@ -995,7 +1199,17 @@ void SolidMechanicsLagrangianFEM::AssembleSystem( real64 const GEOSX_UNUSED_PARA
   localMatrix.setValues< parallelDevicePolicy< 32 > >( 0 );
   localRhs.setValues< parallelDevicePolicy< 32 > >( 0 );
 
-  if( m_effectiveStress==1 )
+  if( m_linearSolverParameters.get().matrixFree )
+  {
+    GEOSX_ERROR_IF( m_effectiveStress==1, getName() << ": the matrix-free operator is not available with effective stress" );
+    GEOSX_UNUSED_VAR( dt );
+    AssemblyLaunch< constitutive::SolidBase,
+                    SolidMechanicsLagrangianFEMKernels::QuasiStaticDiagonal >( domain,
+                                                                               dofManager,
+                                                                               localMatrix,
+                                                                               localRhs );
+  }
+  else if( m_effectiveStress==1 )
   {
     GEOSX_UNUSED_VAR( dt );
     AssemblyLaunch< constitutive::PoroElasticBase,
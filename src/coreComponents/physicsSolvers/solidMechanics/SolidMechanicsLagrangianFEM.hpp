@@ -23,6 +23,7 @@
 #include "common/TimingMacros.hpp"
 #include "mesh/MeshForLoopInterface.hpp"
 #include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/PersistentCommPlan.hpp"
 #include "physicsSolvers/SolverBase.hpp"
 
 #include "SolidMechanicsLagrangianFEMKernels.hpp"
@@ -51,6 +52,17 @@ public:
     ExplicitDynamic   //!< ExplicitDynamic
   };
 
+  /**
+   * @enum ExplicitAssemblyOption
+   *
+   * The options for the assembly of the nodal forces in explicit time integration
+   */
+  enum class ExplicitAssemblyOption : integer
+  {
+    Atomic,           //!< Elements are processed concurrently and forces are added with atomics
+    Colored           //!< Elements are processed one color at a time and forces are added without atomics
+  };
+
   /**
    * Constructor
    * @param name The name of the solver instance
@@ -233,6 +245,12 @@ public:
     static constexpr auto maxForce = "maxForce";
     static constexpr auto elemsAttachedToSendOrReceiveNodes = "elemsAttachedToSendOrReceiveNodes";
     static constexpr auto elemsNotAttachedToSendOrReceiveNodes = "elemsNotAttachedToSendOrReceiveNodes";
+    static constexpr auto elemColorsAttachedToSendOrReceiveNodes = "elemColorsAttachedToSendOrReceiveNodes";
+    static constexpr auto elemColorsNotAttachedToSendOrReceiveNodes = "elemColorsNotAttachedToSendOrReceiveNodes";
+    static constexpr auto explicitAssemblyOptionString = "explicitAssembly";
+    static constexpr auto hourglassDampingString = "hourglassDamping";
+    static constexpr auto hourglassStiffnessString = "hourglassStiffness";
+    static constexpr auto hourglassForceString = "hourglassForce";
     static constexpr auto effectiveStress = "effectiveStress";
 
     dataRepository::ViewKey vTilde = { vTildeString };
@@ -278,6 +296,9 @@ protected:
   real64 m_massDamping;
   real64 m_stiffnessDamping;
   TimeIntegrationOption m_timeIntegrationOption;
+  ExplicitAssemblyOption m_explicitAssemblyOption;
+  real64 m_hourglassDamping;
+  real64 m_hourglassStiffness;
   integer m_useVelocityEstimateForQS;
   real64 m_maxForce = 0.0;
   integer m_maxNumResolves;
@@ -286,19 +307,24 @@ protected:
   string m_contactRelationName;
   SortedArray< localIndex > m_sendOrReceiveNodes;
   SortedArray< localIndex > m_nonSendOrReceiveNodes;
-  MPI_iCommData m_iComm;
+  PersistentCommPlan m_explicitSyncPlan;
 
   /// Indicates whether or not to use effective stress when integrating the
   /// stress divergence in the kernels. This means calling the poroelastic
   /// variant of the solid mechanics kernels.
   integer m_effectiveStress;
 
+  /// Flag of each local row constrained by a Dirichlet condition, used by the matrix-free operator
+  array1d< integer > m_constrainedDofs;
+
   SolidMechanicsLagrangianFEM();
 
 };
 
 ENUM_STRINGS( SolidMechanicsLagrangianFEM::TimeIntegrationOption, "QuasiStatic", "ImplicitDynamic", "ExplicitDynamic" )
 
+ENUM_STRINGS( SolidMechanicsLagrangianFEM::ExplicitAssemblyOption, "Atomic", "Colored" )
+
 //**********************************************************************************************************************
 //**********************************************************************************************************************
 //**********************************************************************************************************************
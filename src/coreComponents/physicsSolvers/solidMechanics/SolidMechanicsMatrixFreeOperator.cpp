@@ -0,0 +1,114 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsMatrixFreeOperator.cpp
+ */
+
+#include "SolidMechanicsMatrixFreeOperator.hpp"
+
+#include "SolidMechanicsLagrangianFEM.hpp"
+#include "SolidMechanicsSmallStrainMatrixFreeKernel.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "linearAlgebra/DofManager.hpp"
+#include "managers/DomainPartition.hpp"
+#include "mpiCommunications/CommunicationTools.hpp"
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+SolidMechanicsMatrixFreeOperator::SolidMechanicsMatrixFreeOperator( SolidMechanicsLagrangianFEM const & solver,
+                                                                    DomainPartition & domain,
+                                                                    DofManager const & dofManager,
+                                                                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                                                    arrayView1d< integer const > const & constrainedDofs ):
+  LinearOperator< ParallelVector >(),
+  m_solver( solver ),
+  m_domain( domain ),
+  m_dofManager( dofManager ),
+  m_localMatrix( localMatrix ),
+  m_constrainedDofs( constrainedDofs ),
+  m_localProduct( dofManager.numLocalDofs() )
+{
+  GEOSX_ERROR_IF_NE( m_localMatrix.numRows(), m_localProduct.size() );
+  GEOSX_ERROR_IF_NE( m_constrainedDofs.size(), m_localProduct.size() );
+}
+
+SolidMechanicsMatrixFreeOperator::~SolidMechanicsMatrixFreeOperator() = default;
+
+void SolidMechanicsMatrixFreeOperator::apply( ParallelVector const & src,
+                                              ParallelVector & dst ) const
+{
+  GEOSX_MARK_FUNCTION;
+  GEOSX_LAI_ASSERT_EQ( src.localSize(), m_localProduct.size() );
+  GEOSX_LAI_ASSERT_EQ( dst.localSize(), m_localProduct.size() );
+
+  MeshLevel & mesh = *m_domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  NodeManager const & nodeManager = *mesh.getNodeManager();
+
+  // Scatter the input vector to the nodes, including the ghosts
+  m_dofManager.copyVectorToField( src, keys::TotalDisplacement, inputFieldString, 1.0 );
+
+  std::map< string, string_array > fieldNames;
+  fieldNames["node"].emplace_back( inputFieldString );
+  CommunicationTools::SynchronizeFields( fieldNames, &mesh, m_domain.getNeighbors(), false );
+
+  string const dofKey = m_dofManager.getKey( keys::TotalDisplacement );
+  arrayView1d< globalIndex const > const & dofNumber = nodeManager.getReference< globalIndex_array >( dofKey );
+  arrayView2d< real64 const, nodes::INCR_DISPLACEMENT_USD > const & input =
+    nodeManager.getReference< array2d< real64, nodes::INCR_DISPLACEMENT_PERM > >( inputFieldString );
+
+  arrayView1d< real64 > const & localProduct = m_localProduct;
+  localProduct.setValues< parallelDevicePolicy< 32 > >( 0.0 );
+
+  finiteElement::
+    regionBasedKernelApplication< parallelDevicePolicy< 32 >,
+                                  constitutive::SolidBase,
+                                  CellElementSubRegion,
+                                  SolidMechanicsLagrangianFEMKernels::QuasiStaticMatrixFree >( mesh,
+                                                                                               m_solver.targetRegionNames(),
+                                                                                               m_solver.getDiscretizationName(),
+                                                                                               m_solver.solidMaterialNames(),
+                                                                                               dofNumber,
+                                                                                               m_dofManager.rankOffset(),
+                                                                                               m_localMatrix,
+                                                                                               localProduct,
+                                                                                               input );
+
+  // Constrained rows only keep their diagonal entry, the only entry of the local matrix rows
+  localProduct.move( LvArray::MemorySpace::CPU, false );
+  arrayView1d< integer const > const & constrainedDofs = m_constrainedDofs;
+  CRSMatrixView< real64, globalIndex const > const & localMatrix = m_localMatrix;
+  real64 const * const srcValues = src.extractLocalVector();
+  real64 * const dstValues = dst.extractLocalVector();
+  forAll< parallelHostPolicy >( localProduct.size(), [=]( localIndex const row )
+  {
+    dstValues[row] = constrainedDofs[row] ? localMatrix.getEntries( row )[0] * srcValues[row] : localProduct[row];
+  } );
+}
+
+globalIndex SolidMechanicsMatrixFreeOperator::numGlobalRows() const
+{
+  return m_dofManager.numGlobalDofs();
+}
+
+globalIndex SolidMechanicsMatrixFreeOperator::numGlobalCols() const
+{
+  return m_dofManager.numGlobalDofs();
+}
+
+} /* namespace geosx */
@@ -0,0 +1,109 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsMatrixFreeOperator.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_
+#define GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_
+
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/interfaces/LinearOperator.hpp"
+
+namespace geosx
+{
+
+class DofManager;
+class DomainPartition;
+class SolidMechanicsLagrangianFEM;
+
+/**
+ * @class SolidMechanicsMatrixFreeOperator
+ * @brief Quasi-static small-strain stiffness operator applied element by element.
+ *
+ * The element stiffness matrices are recomputed from the current constitutive state at each
+ * application and multiplied with the element values of the input vector, so that the global
+ * matrix is never assembled. The rows of the degrees of freedom constrained by Dirichlet
+ * conditions are replaced by their diagonal entry, as the assembled system does. The operator
+ * refers to the diagonal-only local matrix assembled by the solver and to its mask of
+ * constrained rows, which must outlive it.
+ */
+class SolidMechanicsMatrixFreeOperator : public LinearOperator< ParallelVector >
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param solver the solid mechanics solver providing the regions, discretization and materials
+   * @param domain the domain partition
+   * @param dofManager the degree-of-freedom manager of the system
+   * @param localMatrix the diagonal-only local matrix of the system
+   * @param constrainedDofs flag of each local row, nonzero if the row is constrained by a Dirichlet condition
+   */
+  SolidMechanicsMatrixFreeOperator( SolidMechanicsLagrangianFEM const & solver,
+                                    DomainPartition & domain,
+                                    DofManager const & dofManager,
+                                    CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                    arrayView1d< integer const > const & constrainedDofs );
+
+  virtual ~SolidMechanicsMatrixFreeOperator() override;
+
+  /**
+   * @brief Apply the stiffness operator to a vector.
+   * @param src Input vector (src).
+   * @param dst Output vector (dst).
+   */
+  virtual void apply( ParallelVector const & src,
+                      ParallelVector & dst ) const override;
+
+  /**
+   * @brief Get the number of global rows.
+   * @return Number of global rows in the operator.
+   */
+  virtual globalIndex numGlobalRows() const override;
+
+  /**
+   * @brief Get the number of global columns.
+   * @return Number of global columns in the operator.
+   */
+  virtual globalIndex numGlobalCols() const override;
+
+  /// Name of the node field holding the input vector during an application
+  static constexpr auto inputFieldString = "matrixFreeInput";
+
+private:
+
+  /// The solid mechanics solver
+  SolidMechanicsLagrangianFEM const & m_solver;
+
+  /// The domain partition
+  DomainPartition & m_domain;
+
+  /// The degree-of-freedom manager
+  DofManager const & m_dofManager;
+
+  /// The diagonal-only local matrix
+  CRSMatrixView< real64, globalIndex const > const m_localMatrix;
+
+  /// Flag of each local row constrained by a Dirichlet condition
+  arrayView1d< integer const > const m_constrainedDofs;
+
+  /// Local products of the element stiffness matrices
+  mutable array1d< real64 > m_localProduct;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_ */
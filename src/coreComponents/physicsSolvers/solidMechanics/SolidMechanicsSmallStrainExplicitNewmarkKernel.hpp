@@ -94,6 +94,16 @@ public:
    * @param dt The time interval for the step.
    * @param elementListName The name of the entry that holds the list of
    *   elements to be processed during this kernel launch.
+   * @param elementColorsName The name of the entry that holds the elements of
+   *   the list grouped by color. If it holds no color, the nodal forces are
+   *   assembled with atomics.
+   * @param hourglassDampingCoefficient The viscous hourglass control
+   *   coefficient, used by elements that have hourglass modes.
+   * @param hourglassStiffnessCoefficient The stiffness hourglass control
+   *   coefficient, used by elements that have hourglass modes.
+   * @param hourglassForceName The name of the entry that holds the
+   *   generalized stiffness hourglass force of each element, only read by
+   *   elements that have hourglass modes.
    */
   ExplicitSmallStrain( NodeManager & nodeManager,
                        EdgeManager const & edgeManager,
@@ -102,7 +112,11 @@ public:
                        FE_TYPE const & finiteElementSpace,
                        CONSTITUTIVE_TYPE * const inputConstitutiveType,
                        real64 const dt,
-                       string const & elementListName ):
+                       string const & elementListName,
+                       string const & elementColorsName,
+                       real64 const hourglassDampingCoefficient,
+                       real64 const hourglassStiffnessCoefficient,
+                       string const & hourglassForceName ):
     Base( elementSubRegion,
           finiteElementSpace,
           inputConstitutiveType ),
@@ -111,7 +125,15 @@ public:
     m_vel( nodeManager.velocity()),
     m_acc( nodeManager.acceleration() ),
     m_dt( dt ),
-    m_elementList( elementSubRegion.template getReference< SortedArray< localIndex > >( elementListName ).toViewConst() )
+    m_elementList( elementSubRegion.template getReference< SortedArray< localIndex > >( elementListName ).toViewConst() ),
+    m_elementColors( elementSubRegion.template getReference< ArrayOfArrays< localIndex > >( elementColorsName ).toViewConst() ),
+    m_colored( m_elementColors.size() > 0 ),
+    m_density( inputConstitutiveType->getDensity() ),
+    m_hourglassDampingCoefficient( hourglassDampingCoefficient ),
+    m_hourglassStiffnessCoefficient( hourglassStiffnessCoefficient ),
+    m_hourglassForce( FE_TYPE::numHourglassModes > 0 ?
+                      elementSubRegion.template getReference< array3d< real64 > >( hourglassForceName ).toView() :
+                      arrayView3d< real64 >() )
   {
     GEOSX_UNUSED_VAR( edgeManager );
     GEOSX_UNUSED_VAR( faceManager );
@@ -255,22 +277,89 @@ public:
    * @copydoc geosx::finiteElement::KernelBase::complete
    *
    * ### ExplicitSmallStrain Description
-   * Performs the distribution of the nodal force out to the rank local arrays.
+   * Adds the hourglass control forces for elements that have hourglass modes,
+   * and performs the distribution of the nodal force out to the rank local
+   * arrays. When the elements are processed by color, no two elements of a launch
+   * share a node and the contributions are added without atomics.
    */
   GEOSX_HOST_DEVICE
   GEOSX_FORCE_INLINE
   real64 complete( localIndex const k,
-                   StackVariables const & stack ) const
+                   StackVariables & stack ) const
   {
+    if( FE_TYPE::numHourglassModes > 0 )
+    {
+      hourglassControl( k, stack );
+    }
+
+    if( m_colored )
+    {
+      for( localIndex a = 0; a < numNodesPerElem; ++a )
+      {
+        localIndex const nodeIndex = m_elemsToNodes( k, a );
+        for( int b = 0; b < numDofPerTestSupportPoint; ++b )
+        {
+          m_acc( nodeIndex, b ) += stack.fLocal[ a ][ b ];
+        }
+      }
+    }
+    else
+    {
+      for( localIndex a = 0; a < numNodesPerElem; ++a )
+      {
+        localIndex const nodeIndex = m_elemsToNodes( k, a );
+        for( int b = 0; b < numDofPerTestSupportPoint; ++b )
+        {
+          RAJA::atomicAdd< parallelDeviceAtomic >( &m_acc( nodeIndex, b ), stack.fLocal[ a ][ b ] );
+        }
+      }
+    }
+    return 0;
+  }
+
+  /**
+   * @brief Add the hourglass control forces of an element to its local nodal
+   *   forces.
+   * @param k The element index.
+   * @param stack The stack variables of the element.
+   *
+   * The hourglass modes are controlled with the P-wave modulus and the density
+   * of the first quadrature point of the element.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void hourglassControl( localIndex const k,
+                         StackVariables & stack ) const
+  {
+    real64 xLocal[ numNodesPerElem ][ 3 ];
+    real64 velLocal[ numNodesPerElem ][ 3 ];
     for( localIndex a = 0; a < numNodesPerElem; ++a )
     {
       localIndex const nodeIndex = m_elemsToNodes( k, a );
-      for( int b = 0; b < numDofPerTestSupportPoint; ++b )
+      for( int i = 0; i < 3; ++i )
       {
-        RAJA::atomicAdd< parallelDeviceAtomic >( &m_acc( nodeIndex, b ), stack.fLocal[ a ][ b ] );
+        xLocal[ a ][ i ] = m_X[ nodeIndex ][ i ];
+        velLocal[ a ][ i ] = m_vel[ nodeIndex ][ i ];
       }
     }
-    return 0;
+
+    real64 dNdX[ numNodesPerElem ][ 3 ];
+    real64 const volume = m_finiteElementSpace.template getGradN< FE_TYPE >( k, 0, stack.xLocal, dNdX );
+
+    real64 stiffness[ 6 ][ 6 ];
+    m_constitutiveUpdate.GetStiffness( k, 0, stiffness );
+
+    FE_TYPE::addHourglassForce( xLocal,
+                                velLocal,
+                                dNdX,
+                                volume,
+                                m_hourglassDampingCoefficient,
+                                m_hourglassStiffnessCoefficient,
+                                m_density( k, 0 ),
+                                stiffness[ 0 ][ 0 ],
+                                m_dt,
+                                m_hourglassForce[ k ],
+                                stack.fLocal );
   }
 
   /**
@@ -278,7 +367,8 @@ public:
    *
    * ### ExplicitSmallStrain Description
    * Copy of the KernelBase::kernelLaunch function without the exclusion of ghost
-   * elements.
+   * elements. If the element list has been colored, one launch is performed
+   * per color.
    */
   template< typename POLICY,
             typename KERNEL_TYPE >
@@ -290,6 +380,29 @@ public:
 
     GEOSX_UNUSED_VAR( numElems );
 
+    if( kernelComponent.m_colored )
+    {
+      localIndex const numColors = kernelComponent.m_elementColors.size();
+      for( localIndex color = 0; color < numColors; ++color )
+      {
+        forAll< POLICY >( kernelComponent.m_elementColors.sizeOfArray( color ),
+                          [=] GEOSX_DEVICE ( localIndex const index )
+        {
+          localIndex const k = kernelComponent.m_elementColors( color, index );
+
+          typename KERNEL_TYPE::StackVariables stack;
+
+          kernelComponent.setup( k, stack );
+          for( integer q=0; q<KERNEL_TYPE::numQuadraturePointsPerElem; ++q )
+          {
+            kernelComponent.quadraturePointKernel( k, q, stack );
+          }
+          kernelComponent.complete( k, stack );
+        } );
+      }
+      return 0;
+    }
+
     localIndex const numProcElems = kernelComponent.m_elementList.size();
     forAll< POLICY >( numProcElems,
                       [=] GEOSX_DEVICE ( localIndex const index )
@@ -329,6 +442,26 @@ protected:
   /// The list of elements to process for the kernel launch.
   SortedArrayView< localIndex const > const m_elementList;
 
+  /// The elements of m_elementList grouped by color, elements of the same
+  /// color do not share any node.
+  ArrayOfArraysView< localIndex const > const m_elementColors;
+
+  /// Whether the elements are processed by color, without atomics.
+  bool const m_colored;
+
+  /// The material density.
+  arrayView2d< real64 const > const m_density;
+
+  /// The viscous hourglass control coefficient.
+  real64 const m_hourglassDampingCoefficient;
+
+  /// The stiffness hourglass control coefficient.
+  real64 const m_hourglassStiffnessCoefficient;
+
+  /// The generalized stiffness hourglass force of each element, indexed as
+  /// (element, mode, component).
+  arrayView3d< real64 > const m_hourglassForce;
+
 
 };
 #undef UPDATE_STRESS
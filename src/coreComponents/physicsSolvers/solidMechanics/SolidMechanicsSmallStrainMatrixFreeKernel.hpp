@@ -0,0 +1,265 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsSmallStrainMatrixFreeKernel.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINMATRIXFREE_HPP_
+#define GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINMATRIXFREE_HPP_
+
+#include "SolidMechanicsSmallStrainQuasiStaticKernel.hpp"
+
+
+namespace geosx
+{
+
+namespace SolidMechanicsLagrangianFEMKernels
+{
+
+/**
+ * @brief Implements the assembly of the residual and of the diagonal of the
+ *   Jacobian for quasi-static equilibrium.
+ * @copydoc QuasiStatic
+ *
+ * ### QuasiStaticDiagonal Description
+ * The element computations are the ones of QuasiStatic, but only the diagonal
+ * entries of the element Jacobian are added to the matrix, which is expected
+ * to have a diagonal sparsity pattern. This is the assembly used when the
+ * stiffness is applied matrix-free by QuasiStaticMatrixFree.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class QuasiStaticDiagonal : public QuasiStatic< SUBREGION_TYPE,
+                                                CONSTITUTIVE_TYPE,
+                                                FE_TYPE >
+{
+public:
+  /// Alias for the base class;
+  using Base = QuasiStatic< SUBREGION_TYPE,
+                            CONSTITUTIVE_TYPE,
+                            FE_TYPE >;
+
+  using Base::numNodesPerElem;
+  using Base::numDofPerTestSupportPoint;
+  using Base::m_dofRankOffset;
+  using Base::m_matrix;
+  using Base::m_rhs;
+
+  using Base::Base;
+
+  /// Stack variables of the base kernel
+  using StackVariables = typename Base::StackVariables;
+
+  /**
+   * @copydoc geosx::finiteElement::ImplicitKernelBase::complete
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    GEOSX_UNUSED_VAR( k );
+    real64 maxForce = 0;
+
+    for( int i = 0; i < numNodesPerElem * numDofPerTestSupportPoint; ++i )
+    {
+      localIndex const dof = LvArray::integerConversion< localIndex >( stack.localRowDofIndex[ i ] - m_dofRankOffset );
+      if( dof < 0 || dof >= m_matrix.numRows() ) continue;
+      m_matrix.template addToRowBinarySearchUnsorted< parallelDeviceAtomic >( dof,
+                                                                              &stack.localRowDofIndex[ i ],
+                                                                              &stack.localJacobian[ i ][ i ],
+                                                                              1 );
+
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[ dof ], stack.localResidual[ i ] );
+      maxForce = fmax( maxForce, fabs( stack.localResidual[ i ] ) );
+    }
+
+    return maxForce;
+  }
+};
+
+/**
+ * @brief Implements the product of the quasi-static Jacobian with a vector
+ *   without assembling the Jacobian.
+ * @copydoc QuasiStatic
+ *
+ * ### QuasiStaticMatrixFree Description
+ * The element Jacobian is computed as in QuasiStatic from the current state of
+ * the constitutive model, which is not updated, and multiplied with the values
+ * of a nodal input field. The products are added to the owned rows of the
+ * output vector, which is passed in place of the residual. The matrix passed
+ * to the base class is not modified.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class QuasiStaticMatrixFree : public QuasiStatic< SUBREGION_TYPE,
+                                                  CONSTITUTIVE_TYPE,
+                                                  FE_TYPE >
+{
+public:
+  /// Alias for the base class;
+  using Base = QuasiStatic< SUBREGION_TYPE,
+                            CONSTITUTIVE_TYPE,
+                            FE_TYPE >;
+
+  using Base::numNodesPerElem;
+  using Base::numDofPerTestSupportPoint;
+  using Base::numDofPerTrialSupportPoint;
+  using Base::m_dofRankOffset;
+  using Base::m_rhs;
+  using Base::m_elemsToNodes;
+  using Base::m_constitutiveUpdate;
+  using Base::m_finiteElementSpace;
+
+  /**
+   * @brief Constructor
+   * @copydoc geosx::finiteElement::ImplicitKernelBase::ImplicitKernelBase
+   * @param inputOutput The output vector, to which the products are added.
+   * @param inputInput The nodal field the Jacobian is applied to.
+   *
+   * Gravity does not contribute to the Jacobian and is set to zero.
+   */
+  QuasiStaticMatrixFree( NodeManager const & nodeManager,
+                         EdgeManager const & edgeManager,
+                         FaceManager const & faceManager,
+                         SUBREGION_TYPE const & elementSubRegion,
+                         FE_TYPE const & finiteElementSpace,
+                         CONSTITUTIVE_TYPE * const inputConstitutiveType,
+                         arrayView1d< globalIndex const > const & inputDofNumber,
+                         globalIndex const rankOffset,
+                         CRSMatrixView< real64, globalIndex const > const & inputMatrix,
+                         arrayView1d< real64 > const & inputOutput,
+                         arrayView2d< real64 const, nodes::INCR_DISPLACEMENT_USD > const & inputInput ):
+    Base( nodeManager,
+          edgeManager,
+          faceManager,
+          elementSubRegion,
+          finiteElementSpace,
+          inputConstitutiveType,
+          inputDofNumber,
+          rankOffset,
+          inputMatrix,
+          inputOutput,
+          { 0.0, 0.0, 0.0 } ),
+    m_input( inputInput )
+  {}
+
+  //*****************************************************************************
+  /**
+   * @class StackVariables
+   * @copydoc QuasiStatic::StackVariables
+   *
+   * Adds a stack array for the input values.
+   */
+  struct StackVariables : public Base::StackVariables
+  {
+public:
+
+    /// Constructor.
+    GEOSX_HOST_DEVICE
+    StackVariables():
+      Base::StackVariables(),
+      inputLocal()
+    {}
+
+    /// Stack storage for the element local input values
+    real64 inputLocal[numNodesPerElem][numDofPerTrialSupportPoint];
+  };
+  //*****************************************************************************
+
+  /**
+   * @copydoc QuasiStatic::setup
+   *
+   * The element local input values are also placed into stack storage.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void setup( localIndex const k,
+              StackVariables & stack ) const
+  {
+    Base::setup( k, stack );
+    for( localIndex a=0; a<numNodesPerElem; ++a )
+    {
+      for( int i=0; i<3; ++i )
+      {
+        stack.inputLocal[ a ][ i ] = m_input[ m_elemsToNodes( k, a ) ][ i ];
+      }
+    }
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::quadraturePointKernel
+   *
+   * Only the contribution to the element Jacobian is computed, from the
+   * constitutive stiffness of the current state.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const
+  {
+    real64 dNdX[ numNodesPerElem ][ 3 ];
+    real64 const detJ = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, dNdX );
+
+    typename CONSTITUTIVE_TYPE::KernelWrapper::DiscretizationOps stiffnessHelper;
+    m_constitutiveUpdate.setDiscretizationOps( k, q, stiffnessHelper );
+
+    stiffnessHelper.template upperBTDB< numNodesPerElem >( dNdX, -detJ, stack.localJacobian );
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::ImplicitKernelBase::complete
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    GEOSX_UNUSED_VAR( k );
+
+    CONSTITUTIVE_TYPE::KernelWrapper::DiscretizationOps::template fillLowerBTDB< numNodesPerElem >( stack.localJacobian );
+
+    for( int i = 0; i < numNodesPerElem * numDofPerTestSupportPoint; ++i )
+    {
+      localIndex const dof = LvArray::integerConversion< localIndex >( stack.localRowDofIndex[ i ] - m_dofRankOffset );
+      if( dof < 0 || dof >= m_rhs.size() ) continue;
+
+      real64 product = 0;
+      for( int b = 0; b < numNodesPerElem; ++b )
+      {
+        for( int j = 0; j < numDofPerTrialSupportPoint; ++j )
+        {
+          product += stack.localJacobian[ i ][ b * numDofPerTrialSupportPoint + j ] * stack.inputLocal[ b ][ j ];
+        }
+      }
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[ dof ], product );
+    }
+
+    return 0;
+  }
+
+protected:
+  /// The nodal field the Jacobian is applied to.
+  arrayView2d< real64 const, nodes::INCR_DISPLACEMENT_USD > const m_input;
+};
+
+} // namespace SolidMechanicsLagrangianFEMKernels
+
+} // namespace geosx
+
+#endif // GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINMATRIXFREE_HPP_
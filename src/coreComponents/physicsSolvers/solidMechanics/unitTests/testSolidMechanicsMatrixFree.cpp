@@ -0,0 +1,289 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "managers/initialization.hpp"
+#include "managers/ProblemManager.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/unitTests/testCompFlowUtils.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Solvers gravityVector=\"0.0, 0.0, 0.0\">\n"
+  "    <SolidMechanics_LagrangianFEM name=\"lagsolve\"\n"
+  "                                  timeIntegrationOption=\"QuasiStatic\"\n"
+  "                                  discretization=\"FE1\"\n"
+  "                                  targetRegions=\"{Region2}\"\n"
+  "                                  solidMaterialNames=\"{shale}\">\n"
+  "      <LinearSolverParameters solverType=\"gmres\"\n"
+  "                              preconditionerType=\"jacobi\"\n"
+  "                              krylovTol=\"1.0e-12\"\n"
+  "                              krylovMaxIter=\"1000\"/>\n"
+  "    </SolidMechanics_LagrangianFEM>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh1\"\n"
+  "                  elementTypes=\"{C3D8}\"\n"
+  "                  xCoords=\"{0, 4}\"\n"
+  "                  yCoords=\"{0, 1}\"\n"
+  "                  zCoords=\"{0, 1}\"\n"
+  "                  nx=\"{4}\"\n"
+  "                  ny=\"{2}\"\n"
+  "                  nz=\"{2}\"\n"
+  "                  cellBlockNames=\"{cb1}\"/>\n"
+  "  </Mesh>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteElements>\n"
+  "      <FiniteElementSpace name=\"FE1\" order=\"1\"/>\n"
+  "    </FiniteElements>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"Region2\" cellBlocks=\"{cb1}\" materialList=\"{shale}\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <LinearElasticIsotropic name=\"shale\"\n"
+  "                            defaultDensity=\"2700\"\n"
+  "                            defaultBulkModulus=\"5.5556e9\"\n"
+  "                            defaultShearModulus=\"4.16667e9\"/>\n"
+  "  </Constitutive>\n"
+  "  <FieldSpecifications>\n"
+  "    <FieldSpecification name=\"xnegconstraint\"\n"
+  "               objectPath=\"nodeManager\"\n"
+  "               fieldName=\"TotalDisplacement\"\n"
+  "               component=\"0\"\n"
+  "               scale=\"0.0\"\n"
+  "               setNames=\"{xneg}\"/>\n"
+  "    <FieldSpecification name=\"ynegconstraint\"\n"
+  "               objectPath=\"nodeManager\"\n"
+  "               fieldName=\"TotalDisplacement\"\n"
+  "               component=\"1\"\n"
+  "               scale=\"0.0\"\n"
+  "               setNames=\"{xneg}\"/>\n"
+  "    <FieldSpecification name=\"znegconstraint\"\n"
+  "               objectPath=\"nodeManager\"\n"
+  "               fieldName=\"TotalDisplacement\"\n"
+  "               component=\"2\"\n"
+  "               scale=\"0.0\"\n"
+  "               setNames=\"{xneg}\"/>\n"
+  "    <FieldSpecification name=\"xposdisplacement\"\n"
+  "               objectPath=\"nodeManager\"\n"
+  "               fieldName=\"TotalDisplacement\"\n"
+  "               component=\"0\"\n"
+  "               scale=\"1.0e-3\"\n"
+  "               setNames=\"{xpos}\"/>\n"
+  "  </FieldSpecifications>\n"
+  "</Problem>";
+
+class SolidMechanicsMatrixFreeTest : public ::testing::Test
+{
+public:
+
+  SolidMechanicsMatrixFreeTest()
+    : problemManager( std::make_unique< ProblemManager >( "Problem", nullptr ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( *problemManager, xmlInput );
+    solver = problemManager->GetPhysicsSolverManager().GetGroup< SolidMechanicsLagrangianFEM >( "lagsolve" );
+  }
+
+  /**
+   * @brief Set up, assemble and constrain the system of the first quasi-static step.
+   * @param matrixFree whether to use the matrix-free operator
+   * @param precondType the preconditioner of the linear solver
+   *
+   * The assembled system must be set up before the matrix-free one, since only the latter
+   * creates the system operator of the solver.
+   */
+  void assembleSystem( bool const matrixFree,
+                       LinearSolverParameters::PreconditionerType const precondType )
+  {
+    LinearSolverParameters & params = solver->getLinearSolverParameters();
+    params.matrixFree = matrixFree;
+    params.preconditionerType = precondType;
+
+    DomainPartition & domain = *problemManager->getDomainPartition();
+    DofManager & dofManager = solver->getDofManager();
+
+    solver->SetupSystem( domain,
+                         dofManager,
+                         solver->getLocalMatrix(),
+                         solver->getLocalRhs(),
+                         solver->getLocalSolution() );
+
+    solver->ImplicitStepSetup( time, dt, domain );
+
+    solver->AssembleSystem( time,
+                            dt,
+                            domain,
+                            dofManager,
+                            solver->getLocalMatrix().toViewConstSizes(),
+                            solver->getLocalRhs() );
+
+    solver->ApplyBoundaryConditions( time,
+                                     dt,
+                                     domain,
+                                     dofManager,
+                                     solver->getLocalMatrix().toViewConstSizes(),
+                                     solver->getLocalRhs() );
+
+    ParallelMatrix & matrix = solver->getSystemMatrix();
+    matrix.create( solver->getLocalMatrix().toViewConst(), MPI_COMM_GEOSX );
+    solver->getSystemRhs().create( solver->getLocalRhs().toViewConst(), MPI_COMM_GEOSX );
+    solver->getSystemSolution().createWithLocalSize( matrix.numLocalCols(), MPI_COMM_GEOSX );
+  }
+
+  /**
+   * @brief Solve the system assembled last.
+   * @return the solution of the system
+   */
+  ParallelVector solveSystem()
+  {
+    solver->SolveSystem( solver->getDofManager(),
+                         solver->getSystemMatrix(),
+                         solver->getSystemRhs(),
+                         solver->getSystemSolution() );
+    return solver->getSystemSolution();
+  }
+
+  static real64 constexpr time = 0.0;
+  static real64 constexpr dt = 1.0;
+
+  std::unique_ptr< ProblemManager > problemManager;
+  SolidMechanicsLagrangianFEM * solver;
+};
+
+real64 constexpr SolidMechanicsMatrixFreeTest::time;
+real64 constexpr SolidMechanicsMatrixFreeTest::dt;
+
+void expectVectorsNear( ParallelVector const & actual,
+                        ParallelVector const & expected,
+                        real64 const relTol )
+{
+  ParallelVector diff( actual );
+  diff.axpy( -1.0, expected );
+  EXPECT_LE( diff.norm2(), relTol * expected.norm2() );
+}
+
+array1d< integer > findConstrainedRows( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                                        globalIndex const rankOffset )
+{
+  // The boundary conditions clear the off-diagonal entries of the rows they constrain
+  array1d< integer > constrainedRows( localMatrix.numRows() );
+  for( localIndex row = 0; row < localMatrix.numRows(); ++row )
+  {
+    arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( row );
+    arraySlice1d< real64 const > const entries = localMatrix.getEntries( row );
+    constrainedRows[row] = 1;
+    for( localIndex j = 0; j < localMatrix.numNonZeros( row ); ++j )
+    {
+      if( columns[j] != rankOffset + row && std::abs( entries[j] ) > 0.0 )
+      {
+        constrainedRows[row] = 0;
+      }
+    }
+  }
+  return constrainedRows;
+}
+
+TEST_F( SolidMechanicsMatrixFreeTest, applyMatchesAssembledMatrix )
+{
+  using PreconditionerType = LinearSolverParameters::PreconditionerType;
+
+  assembleSystem( false, PreconditionerType::jacobi );
+  EXPECT_EQ( solver->getSystemOperator(), nullptr );
+
+  ParallelMatrix const assembledMatrix( solver->getSystemMatrix() );
+  array1d< integer > const constrainedRows = findConstrainedRows( solver->getLocalMatrix().toViewConst(),
+                                                                  solver->getDofManager().rankOffset() );
+  ParallelVector assembledDiagonal;
+  assembledDiagonal.createWithLocalSize( assembledMatrix.numLocalRows(), MPI_COMM_GEOSX );
+  assembledMatrix.extractDiagonal( assembledDiagonal );
+
+  assembleSystem( true, PreconditionerType::jacobi );
+  LinearOperator< ParallelVector > const * const op = solver->getSystemOperator();
+  ASSERT_NE( op, nullptr );
+  ASSERT_EQ( op->numGlobalRows(), assembledMatrix.numGlobalRows() );
+
+  // The diagonal-only local matrix holds the diagonal of the assembled one, Dirichlet rows included
+  ParallelMatrix const & diagonalMatrix = solver->getSystemMatrix();
+  ParallelVector diagonal;
+  diagonal.createWithLocalSize( diagonalMatrix.numLocalRows(), MPI_COMM_GEOSX );
+  diagonalMatrix.extractDiagonal( diagonal );
+  expectVectorsNear( diagonal, assembledDiagonal, 1e-12 );
+
+  // Values at the nodes of the rank boundaries only reach the neighbor elements through the ghost sync
+  ParallelVector x;
+  x.createWithLocalSize( assembledMatrix.numLocalCols(), MPI_COMM_GEOSX );
+  x.rand();
+
+  ParallelVector Ax;
+  Ax.createWithLocalSize( assembledMatrix.numLocalRows(), MPI_COMM_GEOSX );
+  assembledMatrix.apply( x, Ax );
+
+  ParallelVector opx;
+  opx.createWithLocalSize( assembledMatrix.numLocalRows(), MPI_COMM_GEOSX );
+  op->apply( x, opx );
+
+  expectVectorsNear( opx, Ax, 1e-12 );
+
+  // The Dirichlet rows only keep their diagonal entry
+  real64 const * const xValues = x.extractLocalVector();
+  real64 const * const diagValues = diagonal.extractLocalVector();
+  real64 const * const opxValues = opx.extractLocalVector();
+
+  localIndex numConstrainedRows = 0;
+  for( localIndex row = 0; row < constrainedRows.size(); ++row )
+  {
+    if( constrainedRows[row] )
+    {
+      ++numConstrainedRows;
+      EXPECT_DOUBLE_EQ( opxValues[row], diagValues[row] * xValues[row] );
+    }
+  }
+  EXPECT_GT( MpiWrapper::Sum( numConstrainedRows ), 0 );
+}
+
+TEST_F( SolidMechanicsMatrixFreeTest, solveMatchesAssembledSolve )
+{
+  using PreconditionerType = LinearSolverParameters::PreconditionerType;
+
+  assembleSystem( false, PreconditionerType::jacobi );
+  ParallelVector const assembledSolution = solveSystem();
+  ASSERT_GT( assembledSolution.norm2(), 0.0 );
+
+  assembleSystem( true, PreconditionerType::jacobi );
+  ParallelVector const jacobiSolution = solveSystem();
+  expectVectorsNear( jacobiSolution, assembledSolution, 1e-8 );
+
+  assembleSystem( true, PreconditionerType::chebyshev );
+  ParallelVector const chebyshevSolution = solveSystem();
+  expectVectorsNear( chebyshevSolution, assembledSolution, 1e-8 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -110,47 +110,62 @@ void EmbeddedSurfaceGenerator::InitializePostSubGroups( Group * const problemMan
     integer isPositive, isNegative;
     R1Tensor distVec;
 
-    elemManager->forElementSubRegionsComplete< CellElementSubRegion >(
-      [&]( localIndex const er, localIndex const esr, ElementRegionBase &, CellElementSubRegion & subRegion )
+    // Only the cells overlapping the bounding box of the fracture can be cut by it.
+    // They are sorted to add the embedded surfaces in the order of the regions, subregions and cells.
+    R1Tensor boxMin, boxMax;
+    fracture.GetBoundingBox( boxMin, boxMax );
+    std::vector< std::tuple< localIndex, localIndex, localIndex > > candidateCells;
+    meshLevel->getSpatialIndex().forCellsInBox( boxMin, boxMax, [&]( localIndex const er,
+                                                                     localIndex const esr,
+                                                                     localIndex const cellIndex )
     {
-      arrayView2d< localIndex const, cells::NODE_MAP_USD > const cellToNodes = subRegion.nodeList();
-      FixedOneToManyRelation const & cellToEdges = subRegion.edgeList();
-      for( localIndex cellIndex =0; cellIndex<subRegion.size(); cellIndex++ )
+      candidateCells.emplace_back( er, esr, cellIndex );
+    } );
+    std::sort( candidateCells.begin(), candidateCells.end() );
+
+    for( std::tuple< localIndex, localIndex, localIndex > const & candidateCell : candidateCells )
+    {
+      localIndex const er = std::get< 0 >( candidateCell );
+      localIndex const esr = std::get< 1 >( candidateCell );
+      localIndex const cellIndex = std::get< 2 >( candidateCell );
+
+      CellElementSubRegion * const subRegion = elemManager->GetRegion( er )->GetSubRegion< CellElementSubRegion >( esr );
+      arrayView2d< localIndex const, cells::NODE_MAP_USD > const cellToNodes = subRegion->nodeList();
+      FixedOneToManyRelation const & cellToEdges = subRegion->edgeList();
+
+      isPositive = 0;
+      isNegative = 0;
+      for( localIndex kn =0; kn<subRegion->numNodesPerElement(); kn++ )
       {
-        isPositive = 0;
-        isNegative = 0;
-        for( localIndex kn =0; kn<subRegion.numNodesPerElement(); kn++ )
+        nodeIndex = cellToNodes[cellIndex][kn];
+        distVec  = nodesCoord[nodeIndex];
+        distVec -= planeCenter;
+        // check if the dot product is zero
+        if( Dot( distVec, normalVector ) > 0 )
         {
-          nodeIndex = cellToNodes[cellIndex][kn];
-          distVec  = nodesCoord[nodeIndex];
-          distVec -= planeCenter;
-          // check if the dot product is zero
-          if( Dot( distVec, normalVector ) > 0 )
-          {
-            isPositive = 1;
-          }
-          else if( Dot( distVec, normalVector ) < 0 )
-          {
-            isNegative = 1;
-          }
-        } // end loop over nodes
-        if( isPositive * isNegative == 1 )
+          isPositive = 1;
+        }
+        else if( Dot( distVec, normalVector ) < 0 )
         {
+          isNegative = 1;
+        }
+      } // end loop over nodes
+      if( isPositive * isNegative == 1 )
+      {
 
-          bool added = embeddedSurfaceSubRegion->AddNewEmbeddedSurface( cellIndex,
-                                                                        er,
-                                                                        esr,
-                                                                        *nodeManager,
-                                                                        *edgeManager,
-                                                                        cellToEdges,
-                                                                        &fracture );
-          if( added )
-          {
-            GEOSX_LOG_LEVEL_RANK_0( 2, "Element " << cellIndex << " is fractured" );
-          }
+        bool added = embeddedSurfaceSubRegion->AddNewEmbeddedSurface( cellIndex,
+                                                                      er,
+                                                                      esr,
+                                                                      *nodeManager,
+                                                                      *edgeManager,
+                                                                      cellToEdges,
+                                                                      &fracture );
+        if( added )
+        {
+          GEOSX_LOG_LEVEL_RANK_0( 2, "Element " << cellIndex << " is fractured" );
         }
-      } // end loop over cells
-    } );// end loop over subregions
+      }
+    } // end loop over cells
   } );// end loop over thick planes
 
   ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > > const & cellElemGhostRank =
@@ -681,6 +681,12 @@ int SurfaceGenerator::SeparationDriver( DomainPartition & domain,
   }
 
 
+  // splits on any rank modify the ghosting of its neighbors, so the topology version is updated everywhere
+  if( MpiWrapper::Max( rval ) > 0 )
+  {
+    mesh.incrementTopologyVersion();
+  }
+
   real64 ruptureRate = calculateRuptureRate( *(elementManager.GetRegion< FaceElementRegion >( this->m_fractureRegionName )), edgeManager );
 
   GEOSX_LOG_LEVEL_RANK_0( 3, "rupture rate is " << ruptureRate );
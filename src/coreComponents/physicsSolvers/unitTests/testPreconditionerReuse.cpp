@@ -0,0 +1,273 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testPreconditionerReuse.cpp
+ */
+
+#include <gtest/gtest.h>
+
+#include "linearAlgebra/unitTests/testLinearAlgebraUtils.hpp"
+#include "managers/initialization.hpp"
+#include "physicsSolvers/SolverBase.hpp"
+
+using namespace geosx;
+
+/**
+ * @brief Solver exposing the preconditioner reuse state of SolverBase.
+ */
+class PrecondReuseSolver : public SolverBase
+{
+public:
+
+  PrecondReuseSolver():
+    SolverBase( "solver", nullptr )
+  {}
+
+  /// @return the number of solves performed since the last preconditioner setup
+  integer numSolvesSinceSetup() const { return m_precondNumSolves; }
+
+  /// @return the result of the last linear solve
+  LinearSolverResult const & lastResult() const { return m_linearSolverResult; }
+
+  /// @param precond the preconditioner used by the next solves
+  void setPreconditioner( std::unique_ptr< PreconditionerBase< LAInterface > > precond ) { m_precond = std::move( precond ); }
+};
+
+/**
+ * @brief Preconditioner counting the full and the value-only setups of the preconditioner it wraps.
+ */
+class CountingPreconditioner : public PreconditionerBase< LAInterface >
+{
+public:
+
+  using Base = PreconditionerBase< LAInterface >;
+
+  explicit CountingPreconditioner( std::unique_ptr< Base > precond ):
+    m_precond( std::move( precond ) )
+  {}
+
+  virtual void compute( Matrix const & mat,
+                        DofManager const & dofManager ) override
+  {
+    ++numCompute;
+    Base::compute( mat );
+    m_precond->compute( mat, dofManager );
+  }
+
+  virtual void recompute( Matrix const & mat,
+                          DofManager const & dofManager ) override
+  {
+    ++numRecompute;
+    Base::compute( mat );
+    m_precond->recompute( mat, dofManager );
+  }
+
+  virtual void clear() override
+  {
+    m_precond->clear();
+    Base::clear();
+  }
+
+  virtual void apply( Vector const & src,
+                      Vector & dst ) const override
+  {
+    m_precond->apply( src, dst );
+  }
+
+  /// The number of full setups
+  integer numCompute = 0;
+
+  /// The number of value-only setups
+  integer numRecompute = 0;
+
+private:
+
+  std::unique_ptr< Base > m_precond;
+};
+
+class PreconditionerReuseTest : public ::testing::Test
+{
+protected:
+
+  void SetUp() override
+  {
+    compute2DLaplaceOperator( MPI_COMM_GEOSX, n, matrix );
+
+    rhs.createWithLocalSize( matrix.numLocalRows(), MPI_COMM_GEOSX );
+    rhs.rand();
+    solution.createWithLocalSize( matrix.numLocalCols(), MPI_COMM_GEOSX );
+
+    LinearSolverParameters & params = solver.getLinearSolverParameters();
+    params.solverType = LinearSolverParameters::SolverType::cg;
+    params.isSymmetric = true;
+    params.preconditionerType = LinearSolverParameters::PreconditionerType::jacobi;
+    params.krylov.relTolerance = 1e-8;
+    params.krylov.maxIterations = 1000;
+  }
+
+  /**
+   * @brief Solve the system from a zero initial guess.
+   * @return the number of solves performed since the last preconditioner setup
+   */
+  integer solve()
+  {
+    return solve( matrix );
+  }
+
+  /**
+   * @brief Solve a system with the given matrix from a zero initial guess.
+   * @param mat the matrix of the system
+   * @return the number of solves performed since the last preconditioner setup
+   */
+  integer solve( ParallelMatrix const & mat )
+  {
+    solution.zero();
+    solver.SolveSystem( solver.getDofManager(), mat, rhs, solution );
+    return solver.numSolvesSinceSetup();
+  }
+
+  /**
+   * @brief Make the solver use a counting preconditioner.
+   * @return the counting preconditioner, owned by the solver
+   */
+  CountingPreconditioner & setCountingPreconditioner()
+  {
+    std::unique_ptr< CountingPreconditioner > precond =
+      std::make_unique< CountingPreconditioner >( LAInterface::createPreconditioner( solver.getLinearSolverParameters() ) );
+    CountingPreconditioner & counting = *precond;
+    solver.setPreconditioner( std::move( precond ) );
+    return counting;
+  }
+
+  static globalIndex constexpr n = 32;
+
+  PrecondReuseSolver solver;
+  ParallelMatrix matrix;
+  ParallelVector rhs;
+  ParallelVector solution;
+};
+
+globalIndex constexpr PreconditionerReuseTest::n;
+
+TEST_F( PreconditionerReuseTest, reuseUpToMaxReuse )
+{
+  LinearSolverParameters & params = solver.getLinearSolverParameters();
+  params.precondReuse.maxReuse = 2;
+  params.precondReuse.iterFactor = 100.0;
+
+  // The preconditioner computed for the first solve is reused for the next maxReuse solves
+  for( integer cycle = 0; cycle < 2; ++cycle )
+  {
+    EXPECT_EQ( solve(), 1 );
+    EXPECT_EQ( solve(), 2 );
+    EXPECT_EQ( solve(), 3 );
+    EXPECT_TRUE( solver.lastResult().success() );
+  }
+}
+
+TEST_F( PreconditionerReuseTest, recomputeWhenIterationsGrow )
+{
+  LinearSolverParameters & params = solver.getLinearSolverParameters();
+  params.precondReuse.maxReuse = 10;
+  params.precondReuse.iterFactor = 1.5;
+
+  params.krylov.relTolerance = 1e-2;
+  EXPECT_EQ( solve(), 1 );
+  integer const setupIterations = solver.lastResult().numIterations;
+
+  // A tighter tolerance takes more iterations than the factor allows, with the same preconditioner
+  params.krylov.relTolerance = 1e-12;
+  EXPECT_EQ( solve(), 2 );
+  ASSERT_GT( solver.lastResult().numIterations, params.precondReuse.iterFactor * setupIterations );
+
+  // so that the next solve computes the preconditioner again, and reuses it afterwards
+  EXPECT_EQ( solve(), 1 );
+  EXPECT_EQ( solve(), 2 );
+}
+
+TEST_F( PreconditionerReuseTest, recomputeWhenSolveFails )
+{
+  LinearSolverParameters & params = solver.getLinearSolverParameters();
+  params.precondReuse.maxReuse = 10;
+  params.precondReuse.iterFactor = 100.0;
+  params.stopIfError = false;
+
+  EXPECT_EQ( solve(), 1 );
+  EXPECT_EQ( solve(), 2 );
+
+  // A failure with the reused preconditioner triggers a setup and a second attempt within the same solve
+  params.krylov.maxIterations = 2;
+  EXPECT_EQ( solve(), 1 );
+  EXPECT_FALSE( solver.lastResult().success() );
+
+  // The failed solve also forces a setup for the next one
+  params.krylov.maxIterations = 1000;
+  EXPECT_EQ( solve(), 1 );
+  EXPECT_TRUE( solver.lastResult().success() );
+  EXPECT_EQ( solve(), 2 );
+}
+
+TEST_F( PreconditionerReuseTest, refreshValuesAtMaxReuse )
+{
+  LinearSolverParameters & params = solver.getLinearSolverParameters();
+  params.precondReuse.maxReuse = 1;
+  params.precondReuse.iterFactor = 100.0;
+  params.precondReuse.refreshValues = 1;
+  CountingPreconditioner & precond = setCountingPreconditioner();
+
+  // The first setup is full, the ones reaching maxReuse only refresh the values
+  EXPECT_EQ( solve(), 1 );
+  EXPECT_EQ( solve(), 2 );
+  EXPECT_EQ( solve(), 1 );
+  EXPECT_EQ( solve(), 2 );
+  EXPECT_EQ( solve(), 1 );
+  EXPECT_EQ( precond.numCompute, 1 );
+  EXPECT_EQ( precond.numRecompute, 2 );
+  EXPECT_TRUE( solver.lastResult().success() );
+
+  // Another matrix object requires a full setup
+  ParallelMatrix otherMatrix;
+  compute2DLaplaceOperator( MPI_COMM_GEOSX, n, otherMatrix );
+  EXPECT_EQ( solve( otherMatrix ), 1 );
+  EXPECT_EQ( precond.numCompute, 2 );
+  EXPECT_EQ( precond.numRecompute, 2 );
+  EXPECT_TRUE( solver.lastResult().success() );
+
+  // The preconditioner must not outlive the matrix it was computed from
+  precond.clear();
+}
+
+TEST_F( PreconditionerReuseTest, fullSetupAtMaxReuseWithoutRefresh )
+{
+  LinearSolverParameters & params = solver.getLinearSolverParameters();
+  params.precondReuse.maxReuse = 1;
+  params.precondReuse.iterFactor = 100.0;
+  CountingPreconditioner & precond = setCountingPreconditioner();
+
+  EXPECT_EQ( solve(), 1 );
+  EXPECT_EQ( solve(), 2 );
+  EXPECT_EQ( solve(), 1 );
+  EXPECT_EQ( precond.numCompute, 2 );
+  EXPECT_EQ( precond.numRecompute, 0 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,114 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testSolveSystemNativeKrylov.cpp
+ */
+
+#include <gtest/gtest.h>
+
+#include "linearAlgebra/unitTests/testLinearAlgebraUtils.hpp"
+#include "managers/initialization.hpp"
+#include "physicsSolvers/SolverBase.hpp"
+
+using namespace geosx;
+
+/**
+ * @brief Solver exposing which linear solver path SolverBase took.
+ */
+class NativeKrylovSolver : public SolverBase
+{
+public:
+
+  NativeKrylovSolver():
+    SolverBase( "solver", nullptr )
+  {}
+
+  /// @return whether the last solve went through a native Krylov solver
+  bool usedNativeKrylov() const { return m_krylovSolver != nullptr; }
+
+  /// @return the result of the last linear solve
+  LinearSolverResult const & lastResult() const { return m_linearSolverResult; }
+};
+
+class SolveSystemNativeKrylovTest : public ::testing::Test
+{
+protected:
+
+  void SetUp() override
+  {
+    compute2DLaplaceOperator( MPI_COMM_GEOSX, n, matrix );
+
+    solExact.createWithLocalSize( matrix.numLocalCols(), MPI_COMM_GEOSX );
+    solExact.rand();
+    rhs.createWithLocalSize( matrix.numLocalRows(), MPI_COMM_GEOSX );
+    matrix.apply( solExact, rhs );
+    solution.createWithLocalSize( matrix.numLocalCols(), MPI_COMM_GEOSX );
+    solution.zero();
+
+    LinearSolverParameters & params = solver.getLinearSolverParameters();
+    params.isSymmetric = true;
+    params.preconditionerType = LinearSolverParameters::PreconditionerType::jacobi;
+    params.krylov.relTolerance = 1e-10;
+    params.krylov.maxIterations = 1000;
+    params.krylov.maxRestart = 1000;
+  }
+
+  /**
+   * @brief Solve the system through SolverBase and check the solution against the exact one.
+   */
+  void solveAndCheck()
+  {
+    solver.SolveSystem( solver.getDofManager(), matrix, rhs, solution );
+
+    EXPECT_TRUE( solver.usedNativeKrylov() );
+    EXPECT_TRUE( solver.lastResult().success() );
+
+    solution.axpy( -1.0, solExact );
+    EXPECT_LT( solution.norm2() / solExact.norm2(), 1e-7 );
+  }
+
+  static globalIndex constexpr n = 32;
+
+  NativeKrylovSolver solver;
+  ParallelMatrix matrix;
+  ParallelVector rhs;
+  ParallelVector solExact;
+  ParallelVector solution;
+};
+
+globalIndex constexpr SolveSystemNativeKrylovTest::n;
+
+TEST_F( SolveSystemNativeKrylovTest, pipelinedCG )
+{
+  solver.getLinearSolverParameters().solverType = LinearSolverParameters::SolverType::pipecg;
+  solveAndCheck();
+}
+
+TEST_F( SolveSystemNativeKrylovTest, gmresCGS2 )
+{
+  LinearSolverParameters & params = solver.getLinearSolverParameters();
+  params.solverType = LinearSolverParameters::SolverType::gmres;
+  params.krylov.orthogonalization = LinearSolverParameters::Krylov::Orthogonalization::cgs2;
+  solveAndCheck();
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -21,6 +21,10 @@
 // TPL includes
 #include <RAJA/RAJA.hpp>
 
+#if defined(GEOSX_USE_OPENMP)
+#include <omp.h>
+#endif
+
 namespace geosx
 {
 
@@ -105,6 +109,34 @@ RAJA_INLINE void forAll( const localIndex end, LAMBDA && body )
   RAJA::forall< POLICY >( RAJA::TypedRangeSegment< localIndex >( 0, end ), std::forward< LAMBDA >( body ) );
 }
 
+/**
+ * @brief Get the maximum number of threads running the iterations of a parallelHostPolicy loop.
+ * @return the number of threads
+ */
+inline int getMaxHostThreads()
+{
+#if defined(GEOSX_USE_OPENMP)
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+/**
+ * @brief Get the index of the calling thread in a parallelHostPolicy loop.
+ * @return the thread index, between 0 and getMaxHostThreads() - 1, or 0 outside of a parallel loop
+ *
+ * Lets host-only kernels that need a mutable workspace pick one among getMaxHostThreads() copies.
+ */
+inline int getHostThreadIndex()
+{
+#if defined(GEOSX_USE_OPENMP)
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+
 } // namespace geosx
 
 #endif // GEOSX_RAJAINTERFACE_RAJAINTERFACE_HPP